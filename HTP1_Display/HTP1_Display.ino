@@ -8,16 +8,28 @@
 
 #include <WiFi.h>
 #include <ESPmDNS.h>
+#include <esp_wifi.h>
 #include "config.h"
 #include "settings.h"
 #include "display_manager.h"
+#include "layout.h"
 #include "htp1_client.h"
 #include "button_handler.h"
 #include "web_server.h"
+#include "proxy.h"
+#include "recorder.h"
+#include "discovery.h"
+#include "burnin.h"
+#include "power_manager.h"
+#include "ota_manager.h"
+#include "ota_pull.h"
+#include "metrics.h"
+#include "profiler.h"
 
 // --- Global State ---
 static AppSettings settings;
 static bool displayAsleep = false;
+static bool displayDimmed = false;  // Auto-dim applied — don't re-issue it every loop
 static bool apMode = false;
 static volatile bool settingsChangedFlag = false;  // Set by web server callback, handled in loop
 
@@ -25,6 +37,7 @@ static volatile bool settingsChangedFlag = false;  // Set by web server callback
 static unsigned long lastActivityTime = 0;   // Last HTP-1 data or button press
 static unsigned long nvsSavePending = 0;      // 0 = no pending save
 static unsigned long lastRender = 0;
+static unsigned long lastFollow = 0;
 
 // --- Delayed NVS Save ---
 static void schedule_save() {
@@ -40,6 +53,61 @@ static void check_pending_save() {
     }
 }
 
+// --- Follow the HTP-1 to a new address (mDNS) ---
+// A hostname setting connects to wherever the name resolves; an IP setting
+// is rewritten when the processor stops answering there and its hostname
+// now points elsewhere (DHCP lease change).
+static void follow_htp1_address() {
+    char ip[16];
+    if (!discovery_follow(settings.htp1_ip, htp1_target(), htp1_connect_failures(), ip, sizeof(ip))) return;
+    htp1_set_target(ip, settings.htp1_port, settings.volume_offset);
+    if (!discovery_is_hostname(settings.htp1_ip)) {
+        strlcpy(settings.htp1_ip, ip, sizeof(settings.htp1_ip));
+        schedule_save();
+    }
+}
+
+// --- Extra HTP-1 units (second zone, ...) ---
+// Hostnames come from the discovery cache, so this also runs once a second
+// to pick them up when resolved. Unchanged targets are left alone.
+static void apply_extra_units() {
+    for (uint8_t i = 1; i < HTP1_MAX_UNITS; i++) {
+        const char *addr = settings.unit_ip[i - 1];
+        if (!addr[0]) {
+            htp1_clear_target(i);
+            continue;
+        }
+        char target[40];
+        discovery_target_for(addr, target, sizeof(target));
+        if (target[0]) htp1_set_target(target, settings.unit_port[i - 1], settings.volume_offset, i);
+    }
+    htp1_set_active(settings.active_unit);
+}
+
+static uint8_t configured_units() {
+    uint8_t n = 1;
+    for (uint8_t i = 1; i < HTP1_MAX_UNITS; i++) {
+        if (settings.unit_ip[i - 1][0]) n = i + 1;
+    }
+    return n;
+}
+
+// --- Local BTN2 double press: each unit in turn, then all side by side ---
+static void cycle_unit_view() {
+    uint8_t count = htp1_unit_count();
+    if (settings.split_view) {
+        settings.split_view = false;
+        settings.active_unit = 0;
+    } else if (settings.active_unit + 1 < count) {
+        settings.active_unit++;
+    } else {
+        settings.split_view = true;
+    }
+    htp1_set_active(settings.active_unit);
+    settings.active_unit = htp1_active();
+    Serial.printf("[HTP1] Showing %s\n", settings.split_view ? "all units" : htp1_target(htp1_active()));
+}
+
 // --- Settings Changed Callback (from web server) ---
 // Runs in async_tcp task context — must NOT do SPI/display work here
 // or the task watchdog will trigger. Just set a flag for the main loop.
@@ -47,24 +115,75 @@ static void on_settings_changed() {
     settingsChangedFlag = true;
 }
 
+// --- Button mapping: local controls or HTP-1 remote ---
+static void apply_button_mode() {
+    bool remote = settings.button_remote;
+    buttons_set_long_press(remote ? REMOTE_HOLD_MS : 0);
+    buttons_enable_double(1, !remote);  // Theme cycle — would delay volume up in remote mode
+    buttons_enable_double(2, remote || configured_units() > 1);  // Mute / next unit
+}
+
+// --- Remote mode: step size grows the longer a button is held ---
+static int remote_step(uint8_t button) {
+    uint32_t held = buttons_held_ms(button);
+    if (held >= REMOTE_ACCEL_4DB_MS) return 4;
+    if (held >= REMOTE_ACCEL_2DB_MS) return 2;
+    return 1;
+}
+
+static void handle_remote_button(ButtonEvent btn) {
+    switch (btn) {
+        case BTN1_SHORT:
+        case BTN1_LONG:   htp1_volume_step(+1); break;
+        case BTN1_REPEAT: htp1_volume_step(+remote_step(1)); break;
+        case BTN2_SHORT:
+        case BTN2_LONG:   htp1_volume_step(-1); break;
+        case BTN2_REPEAT: htp1_volume_step(-remote_step(2)); break;
+        case BTN2_DOUBLE: htp1_toggle_mute(); break;
+        default: return;
+    }
+    // Optimistic value — rolls to the target now, the echo reconciles later
+    display_render(htp1_get_state(), settings);
+}
+
 // --- Apply settings changes from the main loop ---
 static void apply_settings_change() {
     display_set_brightness(BRIGHTNESS_PRESETS[settings.brightness_level]);
-    htp1_set_target(settings.htp1_ip, settings.htp1_port, settings.volume_offset);
+    char target[40];
+    discovery_target_for(settings.htp1_ip, target, sizeof(target));
+    htp1_set_target(target, settings.htp1_port, settings.volume_offset);
+    apply_extra_units();
+    power_set_low_power(settings.low_power && !apMode);
+    ota_pull_configure(settings.update_url, settings.update_auto);
+    apply_button_mode();
+    proxy_set_enabled(settings.proxy_mode && !apMode);
+    burnin_set_enabled(settings.burnin_protect);
+    display_reload_layout();  // Custom layout may have been uploaded
     display_render(htp1_get_state(), settings);
+    displayDimmed = false;
     lastActivityTime = millis();
 }
 
 // --- Wake display from sleep ---
 static void wake_display() {
     if (displayAsleep) {
+        power_wake_begin();
         display_on();
         displayAsleep = false;
     }
     display_set_brightness(BRIGHTNESS_PRESETS[settings.brightness_level]);
+    displayDimmed = false;
+    power_set_mode(PWR_ACTIVE);
     lastActivityTime = millis();
 }
 
+// --- Put display to sleep ---
+static void sleep_display() {
+    display_off();
+    displayAsleep = true;
+    power_set_mode(PWR_SLEEP);
+}
+
 // --- WiFi Connection ---
 static bool connect_wifi() {
     if (strlen(settings.wifi_ssid) == 0) return false;
@@ -74,7 +193,9 @@ static bool connect_wifi() {
 
     WiFi.setHostname(HOSTNAME);
     WiFi.mode(WIFI_STA);
-    WiFi.begin(settings.wifi_ssid, settings.wifi_password);
+    WiFi.begin(settings.wifi_ssid, settings.wifi_password, 0, nullptr, false);
+    power_prepare_sta();
+    esp_wifi_connect();
 
     unsigned long start = millis();
     while (WiFi.status() != WL_CONNECTED) {
@@ -110,12 +231,18 @@ void setup() {
     delay(100);
     Serial.printf("\n[HTP1] Firmware %s\n", FW_VERSION);
 
+    // OTA rollback bookkeeping — starts the verify watchdog after an update
+    ota_init();
+
     // Load persistent settings
     settings_load(settings);
+    layout_custom_load();
 
     // Initialize hardware
     display_init();
+    burnin_set_enabled(settings.burnin_protect);
     buttons_init();
+    apply_button_mode();
 
     // Splash screen
     display_show_message("HTP-1 Display", FW_VERSION);
@@ -130,14 +257,28 @@ void setup() {
     if (!apMode) {
         if (MDNS.begin(HOSTNAME)) {
             Serial.printf("[mDNS] http://%s.local/\n", HOSTNAME);
+            discovery_begin();
         }
     }
 
+    // Power management (low-power sleep only applies in STA mode)
+    power_init(settings.low_power && !apMode);
+
+    // Loop profiler (compiled out unless LOOP_PROFILER)
+    PROF_INIT();
+
     // Web server (works in both STA and AP mode)
     webserver_begin(&settings, on_settings_changed);
+    proxy_set_enabled(settings.proxy_mode && !apMode);
+
+    // Background update checks (no-op until an update server URL is set)
+    if (!apMode) ota_pull_init(settings.update_url, settings.update_auto);
 
-    // HTP-1 client
-    htp1_init(settings.htp1_ip, settings.htp1_port, settings.volume_offset);
+    // HTP-1 client (a hostname target connects once discovery resolves it)
+    char target[40];
+    discovery_target_for(settings.htp1_ip, target, sizeof(target));
+    htp1_init(target, settings.htp1_port, settings.volume_offset);
+    apply_extra_units();
 
     if (!apMode && strlen(settings.htp1_ip) > 0) {
         display_show_message("Connecting HTP-1...", settings.htp1_ip);
@@ -167,6 +308,12 @@ void setup() {
 // ============================================================
 void loop() {
     unsigned long now = millis();
+    unsigned long loopStartUs = micros();
+    PROF_LOOP_BEGIN();
+
+    // --- Reached the render loop: a freshly updated image is good ---
+    PROF_PHASE(LP_SETTINGS);
+    ota_confirm_boot();
 
     // --- Web UI settings changed (deferred from async_tcp context) ---
     if (settingsChangedFlag) {
@@ -175,8 +322,21 @@ void loop() {
     }
 
     // --- Button Handling ---
-    ButtonEvent btn = buttons_poll();
-    if (btn != BTN_NONE) {
+    PROF_PHASE(LP_BUTTONS);
+    // Drain every queued event — both buttons, even after a long blocking step
+    ButtonEvent btn;
+    while ((btn = buttons_poll()) != BTN_NONE) {
+        if (settings.button_remote) {
+            wake_display();
+            handle_remote_button(btn);
+            power_wake_first_pixel();
+            buttons_action_done();
+            continue;
+        }
+
+        // Hold-repeat has no local action — and must not re-wake the
+        // display right after BTN2_LONG put it to sleep
+        if (btn == BTN1_REPEAT || btn == BTN2_REPEAT) continue;
         wake_display();
 
         switch (btn) {
@@ -196,6 +356,13 @@ void loop() {
                 schedule_save();
                 break;
 
+            case BTN1_DOUBLE:
+                // Cycle color theme
+                settings.color_theme = (ColorTheme)((settings.color_theme + 1) % THEME_COUNT);
+                display_render(htp1_get_state(), settings);
+                schedule_save();
+                break;
+
             case BTN2_SHORT:
                 // Cycle dim-brightness
                 settings.dim_brightness += 5;
@@ -206,52 +373,96 @@ void loop() {
                 schedule_save();
                 break;
 
+            case BTN2_DOUBLE:
+                // Next HTP-1 unit / split view (enabled with several units)
+                cycle_unit_view();
+                display_render(htp1_get_state(), settings);
+                schedule_save();
+                break;
+
             case BTN2_LONG:
                 // Toggle sleep
                 if (displayAsleep) {
                     wake_display();
                 } else {
-                    display_off();
-                    displayAsleep = true;
+                    sleep_display();
                 }
                 break;
 
             default:
                 break;
         }
+        power_wake_first_pixel();
+        buttons_action_done();
     }
 
     // --- HTP-1 Polling ---
-    bool newData = htp1_poll();
-    if (newData) {
+    PROF_PHASE(LP_HTP1);
+    uint8_t changedUnits = htp1_poll();
+    if (!apMode && now - lastFollow >= 1000) {
+        lastFollow = now;
+        follow_htp1_address();
+        apply_extra_units();
+    }
+    PROF_PHASE(LP_RENDER);
+    // Only units on screen wake the display
+    uint8_t shownUnits = settings.split_view ? 0xFF : 1 << htp1_active();
+    if (changedUnits & shownUnits) {
         wake_display();
         display_render(htp1_get_state(), settings);
-        htp1_clear_changed();
+        power_wake_first_pixel();
     }
 
     // --- Auto-dim ---
     // Re-read millis so it's never behind lastActivityTime (set by wake_display)
+    PROF_PHASE(LP_AUTODIM);
     now = millis();
     if (!displayAsleep) {
         unsigned long elapsed = now - lastActivityTime;
 
         // Sleep (display off) after sleep timeout
         if (settings.sleep_enabled && elapsed > settings.sleep_timeout) {
-            display_off();
-            displayAsleep = true;
+            sleep_display();
         }
-        // Auto-dim after dim timeout
-        else if (elapsed > settings.autodim_timeout) {
+        // Auto-dim after dim timeout (once — the fade runs in the background)
+        else if (!displayDimmed && elapsed > settings.autodim_timeout) {
             display_set_brightness(settings.dim_brightness);
+            displayDimmed = true;
+            power_set_mode(PWR_DIMMED);
         }
     }
 
+    // --- Animation frame clock (volume roll, fades, mode transitions) ---
+    PROF_PHASE(LP_ANIM);
+    display_tick();
+
     // --- Periodic re-render (every 1s to catch web UI changes) ---
+    // Cheap when nothing changed: display_render returns without drawing.
+    PROF_PHASE(LP_RENDER);
     if (!displayAsleep && !apMode && (now - lastRender > 1000)) {
         lastRender = now;
         display_render(htp1_get_state(), settings);
     }
 
+    // --- Live status push to web UI subscribers ---
+    PROF_PHASE(LP_WEB);
+    webserver_poll();
+    proxy_poll();
+
     // --- Delayed NVS save ---
+    PROF_PHASE(LP_NVS);
     check_pending_save();
+
+    // --- Reboot after a successful OTA (deferred from the web handler) ---
+    PROF_PHASE(LP_OTA);
+    ota_poll();
+
+    // --- Power budget report + low-power idle ---
+    PROF_PHASE(LP_POWER);
+    power_poll();
+    PROF_LOOP_END();
+    metrics_loop_pass(micros() - loopStartUs);  // Idle wait below is not loop work
+    if (displayAsleep) {
+        power_idle();  // Blocks until HTP-1 data or POWER_IDLE_WAIT_MS (low-power mode only)
+    }
 }
@@ -0,0 +1,147 @@
+#include "brightness.h"
+#include "config.h"
+#include "rm67162.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static portMUX_TYPE brtMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t fadeTask = nullptr;
+
+// Fade parameters — written by the caller, read by the fade task (brtMux).
+// The fade task is the only writer of the register after init.
+static uint8_t target = 0;
+static volatile bool fading = false;
+static uint32_t fadeSeq = 0;               // Bumped per fade, detects supersession
+static float fadeFromP = 0, fadeToP = 0;   // Perceptual levels (0..1)
+static unsigned long fadeStartMs = 0, fadeDurMs = 0;
+
+static volatile uint8_t current = 0;
+static volatile uint32_t commandCount = 0;
+
+// --- Perceptual <-> register mapping ---
+// The register drives luminance roughly linearly; perceived lightness
+// follows a ~2.2 power law, so fades interpolate in perceptual space.
+static float to_perceptual(uint8_t raw) {
+    return powf(raw / 255.0f, 1.0f / BRIGHTNESS_GAMMA);
+}
+
+static uint8_t to_raw(float p) {
+    return (uint8_t)lroundf(255.0f * powf(p, BRIGHTNESS_GAMMA));
+}
+
+// --- Write the register only on change ---
+static void write_level(uint8_t raw) {
+    if (raw == current) return;
+    current = raw;
+    lcd_brightness(raw);
+    commandCount++;
+}
+
+// --- One fade step; returns false once the fade is complete ---
+static bool fade_step() {
+    portENTER_CRITICAL(&brtMux);
+    bool active = fading;
+    uint32_t seq = fadeSeq;
+    uint8_t tgt = target;
+    float fromP = fadeFromP, toP = fadeToP;
+    unsigned long start = fadeStartMs, dur = fadeDurMs;
+    portEXIT_CRITICAL(&brtMux);
+
+    if (!active) return false;
+
+    unsigned long elapsed = millis() - start;
+    bool done = elapsed >= dur;
+    write_level(done ? tgt : to_raw(fromP + (toP - fromP) * ((float)elapsed / dur)));
+    if (!done) return true;
+
+    portENTER_CRITICAL(&brtMux);
+    if (fadeSeq == seq) fading = false;   // Unless a new fade superseded it
+    active = fading;
+    portEXIT_CRITICAL(&brtMux);
+    return active;
+}
+
+static float commands_per_hour() {
+    unsigned long ms = millis();
+    if (ms == 0) return 0;
+    return commandCount * 3600000.0f / ms;
+}
+
+// --- Fade task: sleeps until notified, then steps on a fixed period ---
+static void fade_task(void *arg) {
+    const TickType_t reportTicks = pdMS_TO_TICKS(BRIGHTNESS_REPORT_INTERVAL_MS);
+    TickType_t lastReport = xTaskGetTickCount();
+    for (;;) {
+        // Sleep until a fade starts or the next report is due
+        TickType_t since = xTaskGetTickCount() - lastReport;
+        bool notified = ulTaskNotifyTake(pdTRUE, since < reportTicks ? reportTicks - since : 0) > 0;
+
+        // Due even when fades keep waking the task before the timeout
+        if (xTaskGetTickCount() - lastReport >= reportTicks) {
+            lastReport = xTaskGetTickCount();
+            Serial.printf("[BRT] %u brightness commands (%.1f/h)\n",
+                          commandCount, commands_per_hour());
+        }
+        if (!notified) continue;
+
+        TickType_t wake = xTaskGetTickCount();
+        while (fade_step()) {
+            vTaskDelayUntil(&wake, pdMS_TO_TICKS(BRIGHTNESS_STEP_MS));
+        }
+    }
+}
+
+static void start_fade(uint8_t raw, uint16_t ms) {
+    float fromP = to_perceptual(current);
+    float toP   = to_perceptual(raw);
+
+    portENTER_CRITICAL(&brtMux);
+    target      = raw;
+    fadeFromP   = fromP;
+    fadeToP     = toP;
+    fadeStartMs = millis();
+    fadeDurMs   = ms;
+    fadeSeq++;
+    fading      = true;
+    portEXIT_CRITICAL(&brtMux);
+
+    if (fadeTask) xTaskNotifyGive(fadeTask);
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void brightness_init(uint8_t raw) {
+    current = raw;
+    target = raw;
+    lcd_brightness(raw);
+    commandCount++;
+
+    if (!fadeTask) {
+        xTaskCreatePinnedToCore(fade_task, "brightness", 3072, nullptr, 2, &fadeTask, 1);
+    }
+}
+
+void brightness_fade_to(uint8_t raw, uint16_t ms) {
+    if (raw == target) return;
+    start_fade(raw, ms);
+}
+
+uint8_t brightness_current() {
+    return current;
+}
+
+uint8_t brightness_target() {
+    return target;
+}
+
+bool brightness_fading() {
+    return fading;
+}
+
+void brightness_report_metrics(Print &out) {
+    out.printf("# HELP htp1_brightness_commands_total Panel brightness register writes\n"
+               "# TYPE htp1_brightness_commands_total counter\n"
+               "htp1_brightness_commands_total %u\n", commandCount);
+}
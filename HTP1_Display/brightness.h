@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Brightness controller — owns the panel brightness register (0x51).
+// Tracks the current level, writes the register only when the value
+// changes, and runs perceptually linear (gamma-corrected) fades on a
+// background task so fades never block rendering.
+
+// Set the initial level and start the fade task (call once, after rm67162_init)
+void brightness_init(uint8_t raw);
+
+// Fade to a level over `ms`. No-op if already at / fading to that level.
+void brightness_fade_to(uint8_t raw, uint16_t ms);
+
+// Level currently written to the panel
+uint8_t brightness_current();
+
+// Level the controller is heading to (== current when idle)
+uint8_t brightness_target();
+
+// Is a fade in progress?
+bool brightness_fading();
+
+// Register writes since boot in Prometheus text format (for /metrics)
+void brightness_report_metrics(Print &out);
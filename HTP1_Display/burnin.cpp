@@ -0,0 +1,244 @@
+#include "burnin.h"
+#include "config.h"
+#include "metrics.h"
+#include <Preferences.h>
+
+#define WEAR_COLS ((DISPLAY_WIDTH + BURNIN_CELL_PX - 1) / BURNIN_CELL_PX)
+#define WEAR_ROWS ((DISPLAY_HEIGHT + BURNIN_CELL_PX - 1) / BURNIN_CELL_PX)
+#define WEAR_CELLS (WEAR_COLS * WEAR_ROWS)
+#define WEAR_FRAC 64            // Wear units per full-on second (uint32: ~2 years per cell)
+#define SAMPLE_STRIDE 2         // Every 2nd pixel of every 2nd row
+
+static const char *NS = "htp1wear";
+static const char *KEY_MAP = "map";
+
+// Idle shift positions, visited in order (index 0 = home)
+static const int8_t IDLE_POS[][2] = {
+    { 0, 0 },
+    { -BURNIN_IDLE_SHIFT_X, -BURNIN_IDLE_SHIFT_Y },
+    {  BURNIN_IDLE_SHIFT_X,  BURNIN_IDLE_SHIFT_Y },
+    {  BURNIN_IDLE_SHIFT_X, -BURNIN_IDLE_SHIFT_Y },
+    { -BURNIN_IDLE_SHIFT_X,  BURNIN_IDLE_SHIFT_Y },
+};
+#define IDLE_POS_COUNT (sizeof(IDLE_POS) / sizeof(IDLE_POS[0]))
+
+// --- Offset policy (loop) ---
+static bool enabled = true;
+static uint8_t orbitIdx = 0;
+static uint8_t idleIdx = 0;
+static unsigned long lastOrbitStep = 0;
+static unsigned long lastActivity = 0;
+static unsigned long lastIdleShift = 0;
+
+// --- Wear map (written by the loop, read by the web server) ---
+static uint32_t wear[WEAR_CELLS];
+static uint32_t wearRem[WEAR_CELLS];      // Carry below one wear unit (not saved)
+static uint8_t sampleCount[WEAR_CELLS];   // Sampled pixels per cell (edge cells are smaller)
+static unsigned long lastSample = 0;
+static unsigned long lastSave = 0;
+static bool dirty = false;
+static volatile bool resetPending = false;
+
+// --- Stats ---
+static uint32_t orbitSteps = 0;
+static uint32_t idleShifts = 0;
+static uint32_t samples = 0;
+static uint64_t sampleUs = 0;
+static uint32_t saves = 0;
+static uint32_t saveErrors = 0;
+
+// Position `i` on the perimeter of the orbit square (8 * R positions)
+static void orbit_pos(uint8_t i, int8_t &x, int8_t &y) {
+    const int r = BURNIN_ORBIT_PX;
+    int side = i / (2 * r), k = i % (2 * r);
+    switch (side) {
+        case 0:  x = -r + k; y = -r;     break;   // Top, left to right
+        case 1:  x = r;      y = -r + k; break;   // Right, downwards
+        case 2:  x = r - k;  y = r;      break;   // Bottom, right to left
+        default: x = -r;     y = r - k;  break;   // Left, upwards
+    }
+}
+
+static void current_offset(int8_t &dx, int8_t &dy) {
+    dx = dy = 0;
+    if (!enabled) return;
+    if (BURNIN_ORBIT_PX > 0) orbit_pos(orbitIdx, dx, dy);
+    dx += IDLE_POS[idleIdx][0];
+    dy += IDLE_POS[idleIdx][1];
+}
+
+static void save_map() {
+    metrics_inc(MET_NVS_WRITES);
+    Preferences prefs;
+    prefs.begin(NS, false);
+    bool ok = prefs.putBytes(KEY_MAP, wear, sizeof(wear)) == sizeof(wear);
+    prefs.end();
+    if (ok) {
+        saves++;
+        dirty = false;
+    } else {
+        saveErrors++;
+        Serial.println("[BURNIN] Wear map save failed");
+    }
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void burnin_init() {
+    for (int y = 0; y < DISPLAY_HEIGHT; y += SAMPLE_STRIDE) {
+        for (int x = 0; x < DISPLAY_WIDTH; x += SAMPLE_STRIDE) {
+            sampleCount[(y / BURNIN_CELL_PX) * WEAR_COLS + x / BURNIN_CELL_PX]++;
+        }
+    }
+
+    Preferences prefs;
+    prefs.begin(NS, true);
+    bool loaded = prefs.isKey(KEY_MAP) && prefs.getBytesLength(KEY_MAP) == sizeof(wear) &&
+                  prefs.getBytes(KEY_MAP, wear, sizeof(wear)) == sizeof(wear);
+    prefs.end();
+    if (!loaded) memset(wear, 0, sizeof(wear));
+    Serial.printf("[BURNIN] Wear map %dx%d %s\n", WEAR_COLS, WEAR_ROWS, loaded ? "loaded" : "new");
+
+    lastActivity = lastOrbitStep = lastSave = millis();
+}
+
+void burnin_set_enabled(bool on) {
+    enabled = on;
+}
+
+bool burnin_enabled() {
+    return enabled;
+}
+
+void burnin_activity() {
+    lastActivity = millis();
+    idleIdx = 0;
+}
+
+void burnin_offset(int8_t &dx, int8_t &dy) {
+    if (!enabled) {
+        dx = dy = 0;
+        return;
+    }
+    unsigned long now = millis();
+
+    if (BURNIN_ORBIT_PX > 0 && now - lastOrbitStep >= BURNIN_ORBIT_STEP_MS) {
+        lastOrbitStep = now;
+        orbitIdx = (orbitIdx + 1) % (8 * BURNIN_ORBIT_PX);
+        orbitSteps++;
+    }
+    if (now - lastActivity >= BURNIN_IDLE_MS &&
+        (idleIdx == 0 || now - lastIdleShift >= BURNIN_IDLE_SHIFT_MS)) {
+        lastIdleShift = now;
+        idleIdx = idleIdx % (IDLE_POS_COUNT - 1) + 1;   // Never back to home while idle
+        idleShifts++;
+    }
+    current_offset(dx, dy);
+}
+
+void burnin_account(const uint8_t *fb, uint8_t brightness) {
+    unsigned long now = millis();
+    if (resetPending) {
+        resetPending = false;
+        memset(wear, 0, sizeof(wear));
+        memset(wearRem, 0, sizeof(wearRem));
+        save_map();
+        Serial.println("[BURNIN] Wear map cleared");
+    }
+    if (dirty && now - lastSave >= BURNIN_WEAR_SAVE_MS) {
+        lastSave = now;
+        save_map();
+    }
+
+    if (now - lastSample < BURNIN_WEAR_SAMPLE_MS) return;
+    uint32_t dtMs = now - lastSample;
+    lastSample = now;
+    if (!fb || brightness == 0) return;   // Panel dark: no wear
+
+    // The frame is taken as what was shown for the whole interval
+    unsigned long startUs = micros();
+    uint8_t lit[WEAR_CELLS] = {};
+    for (int y = 0; y < DISPLAY_HEIGHT; y += SAMPLE_STRIDE) {
+        const uint8_t *row = fb + y * (DISPLAY_WIDTH / 2);
+        uint8_t *cells = lit + (y / BURNIN_CELL_PX) * WEAR_COLS;
+        for (int x = 0; x < DISPLAY_WIDTH; x += SAMPLE_STRIDE) {
+            if (row[x / 2] & 0xF0) cells[x / BURNIN_CELL_PX]++;   // Even x: high nibble
+        }
+    }
+    // Whole units go to the map, the rest carries over: a dim, sparsely
+    // lit cell earns less than one unit per sample but still wears
+    for (int i = 0; i < WEAR_CELLS; i++) {
+        if (!lit[i]) continue;
+        uint64_t num = (uint64_t)lit[i] * brightness * dtMs * WEAR_FRAC + wearRem[i];
+        uint32_t den = (uint32_t)sampleCount[i] * 255 * 1000;
+        wearRem[i] = num % den;
+        if (num >= den) {
+            wear[i] += num / den;
+            dirty = true;
+        }
+    }
+    samples++;
+    sampleUs += micros() - startUs;
+}
+
+void burnin_reset() {
+    resetPending = true;
+}
+
+static void wear_stats(uint32_t &maxW, uint64_t &sum) {
+    maxW = 0;
+    sum = 0;
+    for (int i = 0; i < WEAR_CELLS; i++) {
+        uint32_t w = wear[i];
+        if (w > maxW) maxW = w;
+        sum += w;
+    }
+}
+
+void burnin_write_json(Print &out) {
+    uint32_t maxW;
+    uint64_t sum;
+    wear_stats(maxW, sum);
+    int8_t dx, dy;
+    current_offset(dx, dy);
+
+    out.printf("{\"enabled\":%s,\"offset\":[%d,%d],\"idle\":%s,\"cell\":%d,\"cols\":%d,\"rows\":%d,"
+               "\"max_s\":%u,\"mean_s\":%u,\"cells\":[",
+               enabled ? "true" : "false", dx, dy, idleIdx ? "true" : "false",
+               BURNIN_CELL_PX, WEAR_COLS, WEAR_ROWS,
+               maxW / WEAR_FRAC, (uint32_t)(sum / WEAR_CELLS / WEAR_FRAC));
+    for (int i = 0; i < WEAR_CELLS; i++) {
+        out.printf(i ? ",%u" : "%u", wear[i] / WEAR_FRAC);
+    }
+    out.print("]}");
+}
+
+void burnin_report_metrics(Print &out) {
+    uint32_t maxW;
+    uint64_t sum;
+    wear_stats(maxW, sum);
+
+    out.printf("# HELP htp1_burnin_orbit_steps_total One-pixel layout orbit steps\n"
+               "# TYPE htp1_burnin_orbit_steps_total counter\n"
+               "htp1_burnin_orbit_steps_total %u\n", orbitSteps);
+    out.printf("# HELP htp1_burnin_idle_shifts_total Idle layout shifts\n"
+               "# TYPE htp1_burnin_idle_shifts_total counter\n"
+               "htp1_burnin_idle_shifts_total %u\n", idleShifts);
+    out.printf("# HELP htp1_burnin_wear_seconds Wear map cell on-time, full-on seconds (brightness weighted)\n"
+               "# TYPE htp1_burnin_wear_seconds gauge\n"
+               "htp1_burnin_wear_seconds{stat=\"max\"} %.1f\n"
+               "htp1_burnin_wear_seconds{stat=\"mean\"} %.1f\n",
+               (double)maxW / WEAR_FRAC, (double)sum / WEAR_CELLS / WEAR_FRAC);
+    out.printf("# HELP htp1_burnin_samples_total Framebuffer samples taken for the wear map\n"
+               "# TYPE htp1_burnin_samples_total counter\n"
+               "htp1_burnin_samples_total %u\n", samples);
+    out.printf("# HELP htp1_burnin_sample_seconds_total Time spent sampling the framebuffer\n"
+               "# TYPE htp1_burnin_sample_seconds_total counter\n"
+               "htp1_burnin_sample_seconds_total %.6f\n", sampleUs / 1e6);
+    out.printf("# HELP htp1_burnin_saves_total Wear map NVS saves by result\n"
+               "# TYPE htp1_burnin_saves_total counter\n"
+               "htp1_burnin_saves_total{result=\"ok\"} %u\n"
+               "htp1_burnin_saves_total{result=\"failed\"} %u\n", saves, saveErrors);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+
+// AMOLED burn-in mitigation.
+//
+// Offsets the whole layout so static content (the volume digits in
+// MODE_VOLUME_ONLY, labels) does not sit on the same pixels forever:
+//   - Orbit: every BURNIN_ORBIT_STEP_MS the anchors move one pixel along
+//     the perimeter of a +/-BURNIN_ORBIT_PX square. One-pixel steps are
+//     pushed as the bands of the ops that moved, not as full frames.
+//   - Idle shift: after BURNIN_IDLE_MS without a content change the
+//     layout jumps between a few larger offsets every BURNIN_IDLE_SHIFT_MS,
+//     and snaps home on the next change.
+// The display clamps the offset to the free room around what it draws, so
+// labels anchored at a screen edge move less in that direction instead of
+// being cut off.
+//
+// A wear map accumulates on-time per BURNIN_CELL_PX cell, weighted by
+// panel brightness ("full-on seconds": one second of a fully lit cell at
+// brightness 255). It is sampled from the framebuffer, saved to NVS about
+// hourly and served by GET /burnin.
+
+// Load the wear map from NVS
+void burnin_init();
+
+// Orbit / idle shift on or off (off: offset snaps to 0,0; wear map keeps counting)
+void burnin_set_enabled(bool on);
+bool burnin_enabled();
+
+// Visible content changed — ends an idle shift
+void burnin_activity();
+
+// Offset to draw the layout at now (advances orbit / idle shift)
+void burnin_offset(int8_t &dx, int8_t &dy);
+
+// Wear accounting: call every loop with the framebuffer (4-bit indexed,
+// left pixel in the high nibble, pen 0 = black) and the current panel
+// brightness (0 while the panel is off). Self-throttled to
+// BURNIN_WEAR_SAMPLE_MS; also saves the map every BURNIN_WEAR_SAVE_MS and
+// applies a reset.
+void burnin_account(const uint8_t *fb, uint8_t brightness);
+
+// Clear the wear map (applied on the next burnin_account) — safe from any task
+void burnin_reset();
+
+// Wear map as JSON (for GET /burnin)
+void burnin_write_json(Print &out);
+
+// Burn-in counters in Prometheus text format (for /metrics)
+void burnin_report_metrics(Print &out);
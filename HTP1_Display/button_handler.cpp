@@ -1,68 +1,275 @@
 #include "button_handler.h"
 #include "config.h"
+#include <atomic>
+#include <esp_timer.h>
+#include <soc/gpio_reg.h>
 
 #define DEBOUNCE_MS      50
 #define LONG_PRESS_MS    1000
+#define DOUBLE_PRESS_MS  250    // Second press within this of a release = double
+#define REPEAT_MS        150    // Hold-repeat period after the long press
+#define EDGE_QUEUE_SIZE  32     // Power of two
+#define EVENT_QUEUE_SIZE 8      // Power of two
 
-struct ButtonState {
+#define DEBOUNCE_US      (DEBOUNCE_MS * 1000UL)
+#define DOUBLE_US        (DOUBLE_PRESS_MS * 1000UL)
+#define REPEAT_US        (REPEAT_MS * 1000UL)
+
+struct Button {
     uint8_t pin;
+    ButtonEvent shortEvt, longEvt, doubleEvt, repeatEvt;
+    bool doubleEnabled;
+
+    // Debounced state (loop only)
     bool pressed;
     bool longFired;
-    unsigned long pressTime;
-    unsigned long lastChange;
+    bool shortPending;     // Released; waiting to see whether a second press follows
+    bool secondPress;      // Current press is the second half of a double
+    uint32_t lastEdgeUs;   // Last accepted edge
+    uint32_t pressUs;
+    uint32_t releaseUs;
+    uint32_t nextRepeatUs;
+};
+
+// [0] = btn1 (GPIO 21, PIN_BUTTON_2), [1] = btn2 (GPIO 0, PIN_BUTTON_1)
+static Button buttons[2];
+static uint32_t longPressUs = LONG_PRESS_MS * 1000UL;
+
+// --- Edge queue: GPIO ISR (producer) -> buttons_poll (consumer) ---
+// Head is only written by the ISR, tail only by the loop. Indices are
+// free-running uint8_t; the queue size divides 256 so wrap-around is exact.
+struct Edge {
+    uint32_t us;        // esp_timer timestamp, low 32 bits
+    uint8_t button;
+    bool pressed;
 };
+static Edge edgeQueue[EDGE_QUEUE_SIZE];
+static std::atomic<uint8_t> edgeHead{0};
+static std::atomic<uint8_t> edgeTail{0};
+static std::atomic<uint32_t> edgesDropped{0};
+static bool irqAttached = false;
+
+// --- Classified events (loop only) ---
+struct QueuedEvent {
+    ButtonEvent evt;
+    uint32_t us;        // When the event became due — latency reference
+};
+static QueuedEvent eventQueue[EVENT_QUEUE_SIZE];
+static uint8_t eventHead = 0, eventTail = 0;
+static uint32_t eventsDropped = 0;
+
+// Press-to-action latency
+static ButtonEvent pendingEvt = BTN_NONE;
+static uint32_t pendingActionUs = 0;
+static uint32_t eventCount = 0;
+static uint32_t latencyMaxUs = 0;
+static uint64_t latencyTotalUs = 0;
+
+// Serial latency summary — one line per interval, not per (auto-repeat) event
+static uint32_t windowEvents = 0;
+static uint32_t windowMaxUs = 0;
+static uint64_t windowTotalUs = 0;
+static unsigned long lastReport = 0;
+
+// Runs in interrupt context. Reads the level straight from GPIO_IN_REG
+// (both button pins are < 32) so nothing here lives in flash.
+static void IRAM_ATTR on_edge(void *arg) {
+    uint8_t i = (uint8_t)(uintptr_t)arg;
+    uint8_t head = edgeHead.load(std::memory_order_relaxed);
+    if ((uint8_t)(head - edgeTail.load(std::memory_order_acquire)) >= EDGE_QUEUE_SIZE) {
+        edgesDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Edge &e = edgeQueue[head & (EDGE_QUEUE_SIZE - 1)];
+    e.us = (uint32_t)esp_timer_get_time();
+    e.button = i;
+    e.pressed = !((REG_READ(GPIO_IN_REG) >> buttons[i].pin) & 1);  // Active-low
+    edgeHead.store(head + 1, std::memory_order_release);
+}
+
+static void push_event(ButtonEvent evt, uint32_t us) {
+    if ((uint8_t)(eventHead - eventTail) >= EVENT_QUEUE_SIZE) {
+        eventsDropped++;
+        return;
+    }
+    eventQueue[eventHead++ & (EVENT_QUEUE_SIZE - 1)] = { evt, us };
+}
+
+// Fire the time-based events (long press, repeat, expired double window)
+// that were due at or before `t`
+static void advance(Button &b, uint32_t t) {
+    if (b.shortPending && t - b.releaseUs >= DOUBLE_US) {
+        b.shortPending = false;
+        push_event(b.shortEvt, b.releaseUs);
+    }
+    if (!b.pressed) return;
+    if (!b.longFired && t - b.pressUs >= longPressUs) {
+        b.longFired = true;
+        b.secondPress = false;
+        b.nextRepeatUs = b.pressUs + longPressUs + REPEAT_US;
+        push_event(b.longEvt, b.pressUs + longPressUs);
+    }
+    // After a stall, one catch-up repeat instead of a burst
+    if (b.longFired && (int32_t)(t - b.nextRepeatUs) >= 0) {
+        push_event(b.repeatEvt, b.nextRepeatUs);
+        b.nextRepeatUs += REPEAT_US;
+        if ((int32_t)(t - b.nextRepeatUs) >= 0) b.nextRepeatUs = t + REPEAT_US;
+    }
+}
+
+// Debounced state change at time `t`
+static void change(Button &b, bool pressed, uint32_t t) {
+    advance(b, t);
+    b.pressed = pressed;
+    b.lastEdgeUs = t;
+
+    if (pressed) {
+        b.pressUs = t;
+        b.longFired = false;
+        b.secondPress = b.shortPending;   // Window still open (advance() closes expired ones)
+        b.shortPending = false;
+    } else if (b.longFired) {
+        // Long press / repeats already reported
+    } else if (b.secondPress) {
+        b.secondPress = false;
+        push_event(b.doubleEvt, t);
+    } else if (b.doubleEnabled) {
+        b.shortPending = true;
+        b.releaseUs = t;
+    } else {
+        push_event(b.shortEvt, t);
+    }
+}
+
+// Leading-edge debounce: the first edge of a bounce burst counts, edges
+// within DEBOUNCE_MS of it are ignored
+static void on_queued_edge(const Edge &e) {
+    Button &b = buttons[e.button];
+    if (e.pressed == b.pressed) return;
+    if (e.us - b.lastEdgeUs < DEBOUNCE_US) return;
+    change(b, e.pressed, e.us);
+}
+
+static void attach_irq() {
+    for (int i = 0; i < 2; i++) {
+        attachInterruptArg(buttons[i].pin, on_edge, (void*)(uintptr_t)i, CHANGE);
+    }
+    irqAttached = true;
+}
 
-static ButtonState btn1;  // GPIO 21 (PIN_BUTTON_2)
-static ButtonState btn2;  // GPIO 0  (PIN_BUTTON_1)
+// ============================================================
+// Public API
+// ============================================================
 
 void buttons_init() {
     pinMode(PIN_BUTTON_1, INPUT_PULLUP);
     pinMode(PIN_BUTTON_2, INPUT_PULLUP);
     pinMode(PIN_LED, OUTPUT);
 
-    btn1 = { PIN_BUTTON_2, false, false, 0, 0 };
-    btn2 = { PIN_BUTTON_1, false, false, 0, 0 };
+    buttons[0] = {};
+    buttons[0].pin = PIN_BUTTON_2;
+    buttons[0].shortEvt = BTN1_SHORT;  buttons[0].longEvt = BTN1_LONG;
+    buttons[0].doubleEvt = BTN1_DOUBLE; buttons[0].repeatEvt = BTN1_REPEAT;
+
+    buttons[1] = {};
+    buttons[1].pin = PIN_BUTTON_1;
+    buttons[1].shortEvt = BTN2_SHORT;  buttons[1].longEvt = BTN2_LONG;
+    buttons[1].doubleEvt = BTN2_DOUBLE; buttons[1].repeatEvt = BTN2_REPEAT;
+
+    attach_irq();
+}
+
+void buttons_enable_double(uint8_t button, bool enable) {
+    if (button < 1 || button > 2) return;
+    buttons[button - 1].doubleEnabled = enable;
+}
+
+void buttons_set_long_press(uint16_t ms) {
+    longPressUs = (ms ? ms : LONG_PRESS_MS) * 1000UL;
+}
+
+uint32_t buttons_held_ms(uint8_t button) {
+    if (button < 1 || button > 2) return 0;
+    const Button &b = buttons[button - 1];
+    if (!b.pressed) return 0;
+    return ((uint32_t)esp_timer_get_time() - b.pressUs) / 1000;
 }
 
-static ButtonEvent poll_button(ButtonState &b, ButtonEvent shortEvt, ButtonEvent longEvt) {
-    bool reading = (digitalRead(b.pin) == LOW);
-    unsigned long now = millis();
-    ButtonEvent evt = BTN_NONE;
-
-    // Debounce
-    if (reading != b.pressed && (now - b.lastChange) >= DEBOUNCE_MS) {
-        b.lastChange = now;
-        b.pressed = reading;
-
-        if (b.pressed) {
-            // Button just pressed
-            b.pressTime = now;
-            b.longFired = false;
-        } else {
-            // Button just released
-            if (!b.longFired) {
-                evt = shortEvt;
-            }
+ButtonEvent buttons_poll() {
+    // Drain the edge queue in arrival order
+    uint8_t tail = edgeTail.load(std::memory_order_relaxed);
+    uint8_t head = edgeHead.load(std::memory_order_acquire);
+    while (tail != head) {
+        on_queued_edge(edgeQueue[tail & (EDGE_QUEUE_SIZE - 1)]);
+        tail++;
+        edgeTail.store(tail, std::memory_order_release);
+    }
+
+    uint32_t now = (uint32_t)esp_timer_get_time();
+    for (Button &b : buttons) {
+        // Level check: catches a release inside the debounce window and is
+        // the only input while the interrupts are suspended
+        bool level = digitalRead(b.pin) == LOW;
+        if (level != b.pressed && now - b.lastEdgeUs >= DEBOUNCE_US &&
+            edgeTail.load(std::memory_order_relaxed) == edgeHead.load(std::memory_order_acquire)) {
+            change(b, level, now);
         }
+        advance(b, now);
     }
 
-    // Long press detection while held
-    if (b.pressed && !b.longFired && (now - b.pressTime) >= LONG_PRESS_MS) {
-        b.longFired = true;
-        evt = longEvt;
+    if (windowEvents && millis() - lastReport >= BUTTON_REPORT_INTERVAL_MS) {
+        Serial.printf("[BTN] %u events: %u us avg, %u us max press-to-action\n", windowEvents,
+                      (uint32_t)(windowTotalUs / windowEvents), windowMaxUs);
+        windowEvents = 0;
+        windowMaxUs = 0;
+        windowTotalUs = 0;
+        lastReport = millis();
     }
 
-    return evt;
+    if (eventTail == eventHead) return BTN_NONE;
+    QueuedEvent &q = eventQueue[eventTail++ & (EVENT_QUEUE_SIZE - 1)];
+    pendingEvt = q.evt;
+    pendingActionUs = q.us;
+    return q.evt;
 }
 
-ButtonEvent buttons_poll() {
-    ButtonEvent e;
+void buttons_action_done() {
+    if (pendingEvt == BTN_NONE) return;
+
+    uint32_t us = (uint32_t)esp_timer_get_time() - pendingActionUs;
+    eventCount++;
+    latencyTotalUs += us;
+    if (us > latencyMaxUs) latencyMaxUs = us;
+    if (windowEvents++ == 0) lastReport = millis();   // Window opens with its first event
+    windowTotalUs += us;
+    if (us > windowMaxUs) windowMaxUs = us;
+    pendingEvt = BTN_NONE;
+}
 
-    e = poll_button(btn1, BTN1_SHORT, BTN1_LONG);
-    if (e != BTN_NONE) return e;
+void buttons_suspend_irq() {
+    if (!irqAttached) return;
+    for (Button &b : buttons) detachInterrupt(b.pin);
+    irqAttached = false;
+}
 
-    e = poll_button(btn2, BTN2_SHORT, BTN2_LONG);
-    if (e != BTN_NONE) return e;
+void buttons_rearm_irq() {
+    if (irqAttached) return;
+    attach_irq();
+}
 
-    return BTN_NONE;
+void buttons_report_metrics(Print &out) {
+    out.printf("# HELP htp1_button_events_total Button events acted on\n"
+               "# TYPE htp1_button_events_total counter\n"
+               "htp1_button_events_total %u\n", eventCount);
+    out.printf("# HELP htp1_button_latency_seconds_total Press-to-action latency, summed\n"
+               "# TYPE htp1_button_latency_seconds_total counter\n"
+               "htp1_button_latency_seconds_total %.6f\n", latencyTotalUs / 1e6);
+    out.printf("# HELP htp1_button_latency_max_seconds Worst press-to-action latency since boot\n"
+               "# TYPE htp1_button_latency_max_seconds gauge\n"
+               "htp1_button_latency_max_seconds %.6f\n", latencyMaxUs / 1e6);
+    out.printf("# HELP htp1_button_dropped_total Edges / events lost to a full queue\n"
+               "# TYPE htp1_button_dropped_total counter\n"
+               "htp1_button_dropped_total{queue=\"edge\"} %u\n"
+               "htp1_button_dropped_total{queue=\"event\"} %u\n",
+               edgesDropped.load(std::memory_order_relaxed), eventsDropped);
 }
@@ -9,10 +9,44 @@ enum ButtonEvent : uint8_t {
     BTN1_LONG,    // GPIO 21 long press  — cycle display mode
     BTN2_SHORT,   // GPIO 0  short press — toggle LED
     BTN2_LONG,    // GPIO 0  long press  — toggle sleep
+    BTN1_DOUBLE,  // GPIO 21 double press (only if enabled)
+    BTN1_REPEAT,  // GPIO 21 still held after LONG, every REPEAT_MS
+    BTN2_DOUBLE,  // GPIO 0  double press (only if enabled)
+    BTN2_REPEAT,  // GPIO 0  still held after LONG
 };
 
-// Initialize button GPIOs
+// Buttons are sampled by GPIO interrupts: every edge is timestamped in the
+// ISR and queued (lock-free, single producer / single consumer), and
+// debounce, long-press, double-press and hold-repeat are classified from
+// those timestamps in buttons_poll(). A loop that blocks for a while loses
+// nothing — the presses are classified late but in order, for both buttons.
+
+// Initialize button GPIOs and attach the edge interrupts
 void buttons_init();
 
-// Poll buttons — call from loop(). Returns event if one fired.
+// Detect double presses on a button (1 or 2). A short press on it is then
+// only reported once DOUBLE_PRESS_MS passed without a second press.
+void buttons_enable_double(uint8_t button, bool enable);
+
+// Hold time before LONG (and the start of REPEAT). 0 = default LONG_PRESS_MS.
+void buttons_set_long_press(uint16_t ms);
+
+// How long a button (1 or 2) has been held, 0 if released
+uint32_t buttons_held_ms(uint8_t button);
+
+// Next classified event, or BTN_NONE — call from loop() until BTN_NONE
 ButtonEvent buttons_poll();
+
+// The event last returned by buttons_poll() has been acted on — records
+// the press-to-action latency
+void buttons_action_done();
+
+// Light sleep reprograms the button GPIOs as level wake sources, which
+// would retrigger the edge interrupt while a button is held. Detach the
+// interrupts before, re-arm them after; in between buttons_poll() falls
+// back to reading the pin levels.
+void buttons_suspend_irq();
+void buttons_rearm_irq();
+
+// Event / latency / dropped-edge counters in Prometheus text format
+void buttons_report_metrics(Print &out);
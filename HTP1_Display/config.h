@@ -23,6 +23,7 @@
 #define TFT_WIDTH             240
 #define TFT_HEIGHT            536
 #define SEND_BUF_SIZE         (0x4000)
+#define LCD_BOUNCE_BYTES      16384  // Indexed push: RGB565 expansion buffer, two halves (DMA ping-pong)
 
 // Display pins (SPI)
 #define TFT_TE                9
@@ -54,23 +55,142 @@ static const uint8_t BRIGHTNESS_PRESETS[BRIGHTNESS_LEVELS] = {
     7, 20, 25, 30, 50, 55, 60
 };
 #define BRIGHTNESS_DEFAULT    3      // Index into BRIGHTNESS_PRESETS
+#define BRIGHTNESS_GAMMA      2.2f   // Perceptual curve for fades
+#define BRIGHTNESS_STEP_MS    10     // Fade task period (100 Hz)
+#define BRIGHTNESS_REPORT_INTERVAL_MS 3600000  // Serial command-count report
+
+// --- Proxy mode (one display relays the HTP-1 to other local clients) ---
+#define PROXY_MAX_CLIENTS     8      // Local /ws/controller clients
+#define PROXY_CMD_QUEUE       8      // Client -> HTP-1 commands waiting for the loop
+#define PROXY_CMD_MAX_LEN     512    // Longest client command relayed
+#define PROXY_SNAPSHOT_INTERVAL_MS 1000  // Min gap between upstream getmso requests
+
+// --- Traffic recorder (raw HTP-1 frames to LittleFS, see recorder.h) ---
+#define REC_DIR               "/rec"
+#define REC_SEGMENTS          4              // Segment files in the ring
+#define REC_SEGMENT_BYTES     (256 * 1024)   // Next segment once a record would pass this
+#define REC_FLUSH_INTERVAL_MS 2000
+#define REC_RING_BYTES        (64 * 1024)    // RAM queue loop -> writer task (power of 2; PSRAM if present)
+
+// --- Web UI live status (Server-Sent Events) ---
+#define SSE_MIN_INTERVAL_MS   100    // Max 10 pushes/s — changes in between are coalesced
+#define SSE_MAX_BACKLOG       4      // Skip a client while it has this many queued (resynced later)
+#define SSE_MAX_CLIENTS       8      // /events subscribers tracked; more are refused
+#define SSE_RSSI_INTERVAL_MS  10000  // RSSI sample period
+#define SSE_RSSI_DELTA        3      // dB change that counts as a link change
+#define SSE_KEEPALIVE_MS      15000  // Comment line so proxies keep the stream open
+
+// --- OTA ---
+#define OTA_REQUIRE_SHA256    1       // Reject uploads without a SHA-256 digest
+#define OTA_VERIFY_TIMEOUT_MS 120000  // New image must reach loop() within this, or roll back
+#define OTA_REBOOT_DELAY_MS   1000    // Delay between the HTTP reply and the reboot
+
+// --- Pull OTA (update server) ---
+#define OTA_PULL_INTERVAL_MS  21600000  // Manifest check every 6 h (when enabled)
+#define OTA_PULL_FIRST_CHECK_MS 60000   // First check after boot
+#define OTA_PULL_CHUNK        1024      // Download / flash write chunk
+#define OTA_PULL_TIMEOUT_MS   15000     // Stalled download gives up
+#define OTA_HS_WINDOW         10        // heatshrink window (2^10 bytes) — matches tools/update_server.py
+#define OTA_HS_LOOKAHEAD      4         // heatshrink lookahead (2^4 bytes)
 
 // --- Display Defaults ---
 #define DISPLAY_WIDTH         536
 #define DISPLAY_HEIGHT        240
 
+// --- Animation ---
+#define ANIM_FPS              60     // Frame budget while animating
+#define ANIM_VOL_STEP_MS      40     // Volume roll time per step
+#define ANIM_VOL_MAX_MS       250    // Cap on a single volume roll
+#define ANIM_FADE_MS          300    // Brightness fade (dim / brighten)
+#define ANIM_MODE_FADE_MS     200    // Mode change: fade-out, then fade-in
+#define ANIM_REPORT_INTERVAL_MS 30000  // Serial fps / frame-time report
+
+// --- Burn-in mitigation (AMOLED, see burnin.h) ---
+#define BURNIN_ORBIT_PX       3        // Anchor orbit: square of +/- this many pixels
+#define BURNIN_ORBIT_STEP_MS  60000    // One pixel along the orbit per step
+#define BURNIN_IDLE_MS        600000   // No content change this long = idle
+#define BURNIN_IDLE_SHIFT_MS  300000   // While idle, jump to the next shift position this often
+#define BURNIN_IDLE_SHIFT_X   24       // Idle shift range (px, each way)
+#define BURNIN_IDLE_SHIFT_Y   8
+#define BURNIN_CELL_PX        16       // Wear map cell size (34 x 15 cells)
+#define BURNIN_WEAR_SAMPLE_MS 10000    // Framebuffer sampled for the wear map this often
+#define BURNIN_WEAR_SAVE_MS   3600000  // Wear map saved to NVS this often
+
+// --- Loop Profiler (build flag) ---
+// Per-phase loop timing + stall detection, reported on serial and /metrics.
+// Off by default; enable here or with -DLOOP_PROFILER=1. Compiles to nothing when 0.
+#ifndef LOOP_PROFILER
+#define LOOP_PROFILER         0
+#endif
+#define PROF_STALL_US         100000  // Loop pass longer than this is logged as a stall
+#define PROF_SAMPLE_US        997     // Phase sampler period (prime — doesn't beat with 1 ms timers)
+#define PROF_REPORT_INTERVAL_MS 60000 // Serial phase table
+
 // --- Timing Defaults ---
 #define AUTODIM_TIMEOUT_MS    3000   // ms before auto-dim
 #define DIM_BRIGHTNESS        7      // Brightness when dimmed
 #define SLEEP_TIMEOUT_MS      60000  // ms before sleep (display off)
 #define RECONNECT_INTERVAL_MS 5000   // ms between HTP-1 reconnect attempts
+#define RECONNECT_MAX_MS      60000  // ...doubling per failure up to this
 #define WIFI_CONNECT_TIMEOUT  30000  // ms to wait for WiFi before AP fallback
 #define NVS_SAVE_DELAY_MS     5000   // Delayed NVS write to reduce flash wear
+#define HTTP_POLL_INTERVAL_MS 3000   // ms between /ircmd full state refreshes
+#define HTTP_POLL_SLEEP_MS    30000  // Slower /ircmd refresh while asleep in low-power mode
+
+// --- Power Management (low-power mode) ---
+#define POWER_CPU_MAX_MHZ     240
+#define POWER_CPU_MIN_MHZ     80     // DFS floor when the CPU is idle
+#define WIFI_LISTEN_INTERVAL  10     // DTIM beacons between radio wakes in max modem sleep
+#define POWER_IDLE_WAIT_MS    50     // Max loop block while asleep (button poll granularity)
+#define POWER_REPORT_INTERVAL_MS 600000  // Serial power-budget report interval
 
 // --- HTP-1 Defaults ---
 #define HTP1_DEFAULT_PORT     80
 #define HTP1_WS_PATH          "/ws/controller"
+#define HTP1_CONNECT_TIMEOUT_MS 500  // TCP connect (WebSocket, /ircmd) — blocks the loop
 #define HTP1_VOLUME_OFFSET    7      // Reference level offset
+#define HTP1_VOLUME_MIN       -100   // Remote volume clamp (raw HTP-1 dB)
+#define HTP1_VOLUME_MAX       0      // Raise if the HTP-1 allows gain above reference
+#define HTP1_MAX_HOOKS        2      // Raw traffic observers (proxy, recorder)
+#define HTP1_MAX_UNITS        2      // Processors followed at once (unit 0 + extras)
+#define HTP1_FRAME_RESERVE    1024   // Shared WebSocket receive buffer, reserved at init
+#define HTP1_FRAME_KEEP_BYTES 4096   // ...capacity kept between frames (larger is released)
+
+// --- HTP-1 discovery (mDNS / DNS-SD, see discovery.h) ---
+#define DISCOVERY_SERVICE     "_http"   // Service the HTP-1 advertises
+#define DISCOVERY_PROTO       "_tcp"
+#define DISCOVERY_NAME_MATCH  "htp"     // Instance or host name must contain this (any case)
+#define DISCOVERY_MAX_DEVICES 8
+#define DISCOVERY_QUERY_MS    3000      // One browse / resolve
+#define DISCOVERY_FIRST_BROWSE_MS 5000  // After boot
+#define DISCOVERY_BROWSE_INTERVAL_MS 300000
+#define DISCOVERY_HOST_TTL_MS 120000    // Cache lifetime of a resolved hostname
+#define DISCOVERY_RESOLVE_AFTER_FAILS 3 // Connect failures before an IP target is re-resolved
+#define DISCOVERY_RESOLVE_INTERVAL_MS 30000
+
+// --- Interned strings (HTP1State text fields, see str_table.h) ---
+#define STR_TABLE_SLOT_BITS   6      // 64 strings; the other 10 id bits are a slot generation
+#define STR_TABLE_ARENA       2048   // Bytes of text (NUL-terminated), compacted when full
+#define STR_TABLE_MAX_LEN     127    // Longest value kept (HTP-1 names are well under this)
+
+// --- HTP-1 state mirror (full mso document, see mso_mirror.h) ---
+#define MSO_MAX_NODES         3072   // Values in the tree, 16 bytes each (< 65535)
+#define MSO_NODE_BUCKETS      2048   // (parent, key) hash buckets — power of 2
+#define MSO_MAX_KEYS          512    // Distinct object keys
+#define MSO_KEY_ARENA         6144   // Bytes of key text
+#define MSO_STR_ARENA         16384  // Bytes of string values, compacted when full (< 65536)
+#define MSO_MAX_DEPTH         12     // Deepest nesting kept
+#define MSO_MAX_TOKEN         48     // Longest JSON-pointer segment
+#define MSO_RESYNC_INTERVAL_MS 10000 // Min gap between getmso after a patch failed
+
+// --- Button Remote Control (volume / mute from the display buttons) ---
+#define REMOTE_HOLD_MS        400    // Hold this long to start repeating
+#define REMOTE_ACCEL_2DB_MS   1500   // Held this long: 2 dB per repeat
+#define REMOTE_ACCEL_4DB_MS   3000   // ...then 4 dB per repeat
+#define REMOTE_CMD_INTERVAL_MS 60    // Min gap between volume commands
+#define REMOTE_ECHO_TIMEOUT_MS 1000  // No echo by then: resync to the HTP-1's value
+#define API_CMD_INTERVAL_MS   100    // REST mute / input / power: min gap between commands
+#define BUTTON_REPORT_INTERVAL_MS 60000  // Serial press-to-action latency summary
 
 // --- WiFi AP Fallback ---
 #define AP_SSID               "HTP1-Display-Setup"
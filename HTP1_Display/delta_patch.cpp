@@ -0,0 +1,219 @@
+#include "delta_patch.h"
+#include "config.h"
+
+static const char BSDIFF_MAGIC[16] = { 'E','N','D','S','L','E','Y','/','B','S','D','I','F','F','4','3' };
+
+#define HS_WINDOW_SIZE  (1 << OTA_HS_WINDOW)
+#define HS_WINDOW_MASK  (HS_WINDOW_SIZE - 1)
+#define HS_BACKREF_BITS (1 + OTA_HS_WINDOW + OTA_HS_LOOKAHEAD)
+#define OLD_CACHE_SIZE  512
+
+static DeltaReadFn readOld = nullptr;
+static DeltaWriteFn sink = nullptr;
+static uint32_t oldSize = 0;
+static uint32_t newSize = 0;
+static const char *error = nullptr;
+
+// --- heatshrink decoder state ---
+static uint8_t window[HS_WINDOW_SIZE];
+static uint32_t windowHead = 0;       // Bytes decoded so far (window index = head & mask)
+static uint32_t bitBuf = 0;
+static uint8_t bitCount = 0;
+
+// --- bspatch state ---
+enum PatchPhase : uint8_t { PH_HEADER = 0, PH_CTRL, PH_DIFF, PH_EXTRA, PH_DONE };
+static PatchPhase phase = PH_HEADER;
+static uint8_t field[24];              // Header / control triple being collected
+static uint8_t fieldLen = 0;
+static int64_t addLeft = 0, copyLeft = 0, seek = 0;
+static int64_t oldPos = 0;
+static uint32_t newPos = 0;
+
+// --- Old-image read cache + output buffer ---
+static uint8_t oldCache[OLD_CACHE_SIZE];
+static uint32_t oldCacheStart = 0, oldCacheLen = 0;
+static uint8_t outBuf[OTA_PULL_CHUNK];
+static size_t outLen = 0;
+
+static void set_error(const char *msg) {
+    if (!error) error = msg;
+}
+
+// bsdiff offsets: 63-bit magnitude little-endian, sign in the top bit
+static int64_t offtin(const uint8_t *b) {
+    int64_t y = b[7] & 0x7F;
+    for (int i = 6; i >= 0; i--) y = (y << 8) | b[i];
+    return (b[7] & 0x80) ? -y : y;
+}
+
+static bool old_byte(uint32_t pos, uint8_t &out) {
+    if (pos < oldCacheStart || pos >= oldCacheStart + oldCacheLen) {
+        if (pos >= oldSize) return false;
+        oldCacheStart = pos;
+        oldCacheLen = min((uint32_t)OLD_CACHE_SIZE, oldSize - pos);
+        if (!readOld(oldCacheStart, oldCache, oldCacheLen)) {
+            oldCacheLen = 0;
+            return false;
+        }
+    }
+    out = oldCache[pos - oldCacheStart];
+    return true;
+}
+
+static void emit(uint8_t b) {
+    outBuf[outLen++] = b;
+    newPos++;
+    if (outLen == sizeof(outBuf)) {
+        if (!sink(outBuf, outLen)) set_error("sink write failed");
+        outLen = 0;
+    }
+}
+
+// Called after a control triple or data run completes
+static void next_phase() {
+    while (!error) {
+        if (phase == PH_DIFF && addLeft == 0) {
+            phase = PH_EXTRA;
+        } else if (phase == PH_EXTRA && copyLeft == 0) {
+            oldPos += seek;
+            phase = newPos == newSize ? PH_DONE : PH_CTRL;
+            fieldLen = 0;
+        } else {
+            return;
+        }
+    }
+}
+
+// --- One decompressed patch byte ---
+static void patch_byte(uint8_t b) {
+    switch (phase) {
+        case PH_HEADER:
+        case PH_CTRL:
+            field[fieldLen++] = b;
+            if (phase == PH_HEADER && fieldLen == 24) {
+                if (memcmp(field, BSDIFF_MAGIC, sizeof(BSDIFF_MAGIC)) != 0) {
+                    set_error("bad patch magic");
+                } else if (offtin(field + 16) != (int64_t)newSize) {
+                    set_error("patch size mismatch");
+                }
+                phase = newSize ? PH_CTRL : PH_DONE;
+                fieldLen = 0;
+            } else if (phase == PH_CTRL && fieldLen == 24) {
+                addLeft  = offtin(field);
+                copyLeft = offtin(field + 8);
+                seek     = offtin(field + 16);
+                if (addLeft < 0 || copyLeft < 0 ||
+                    newPos + addLeft + copyLeft > newSize ||
+                    oldPos < 0 || oldPos + addLeft > oldSize) {
+                    set_error("corrupt control block");
+                    return;
+                }
+                phase = PH_DIFF;
+                next_phase();
+            }
+            break;
+
+        case PH_DIFF: {
+            uint8_t o;
+            if (!old_byte((uint32_t)oldPos, o)) {
+                set_error("old image read failed");
+                return;
+            }
+            emit((uint8_t)(b + o));
+            oldPos++;
+            addLeft--;
+            next_phase();
+            break;
+        }
+
+        case PH_EXTRA:
+            emit(b);
+            copyLeft--;
+            next_phase();
+            break;
+
+        case PH_DONE:
+            set_error("trailing patch data");
+            break;
+    }
+}
+
+static void hs_output(uint8_t b) {
+    window[windowHead++ & HS_WINDOW_MASK] = b;
+    patch_byte(b);
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void delta_begin(DeltaReadFn read, uint32_t oldBytes, DeltaWriteFn write, uint32_t newBytes) {
+    readOld = read;
+    sink = write;
+    oldSize = oldBytes;
+    newSize = newBytes;
+    error = nullptr;
+
+    memset(window, 0, sizeof(window));
+    windowHead = 0;
+    bitBuf = 0;
+    bitCount = 0;
+
+    phase = PH_HEADER;
+    fieldLen = 0;
+    addLeft = copyLeft = seek = 0;
+    oldPos = 0;
+    newPos = 0;
+    oldCacheStart = oldCacheLen = 0;
+    outLen = 0;
+}
+
+bool delta_feed(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len && !error; i++) {
+        bitBuf = (bitBuf << 8) | data[i];
+        bitCount += 8;
+
+        // Decode every complete token in the bit buffer (MSB first)
+        while (!error) {
+            if (bitCount < 1) break;
+            if ((bitBuf >> (bitCount - 1)) & 1) {
+                // Literal: tag 1 + 8 bits
+                if (bitCount < 9) break;
+                bitCount -= 9;
+                hs_output((uint8_t)(bitBuf >> bitCount));
+            } else {
+                // Back-reference: tag 0 + offset + count
+                if (bitCount < HS_BACKREF_BITS) break;
+                bitCount -= HS_BACKREF_BITS;
+                uint32_t token = bitBuf >> bitCount;
+                uint16_t count  = (token & ((1 << OTA_HS_LOOKAHEAD) - 1)) + 1;
+                uint16_t offset = ((token >> OTA_HS_LOOKAHEAD) & HS_WINDOW_MASK) + 1;
+                if (offset > windowHead) {
+                    set_error("heatshrink back-reference out of range");
+                    break;
+                }
+                for (uint16_t k = 0; k < count && !error; k++) {
+                    hs_output(window[(windowHead - offset) & HS_WINDOW_MASK]);
+                }
+            }
+        }
+    }
+    return !error;
+}
+
+bool delta_finish() {
+    if (!error && outLen > 0) {
+        if (!sink(outBuf, outLen)) set_error("sink write failed");
+        outLen = 0;
+    }
+    if (!error && phase != PH_DONE) set_error("patch truncated");
+    return !error;
+}
+
+const char* delta_error() {
+    return error;
+}
+
+uint32_t delta_produced() {
+    return newPos;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Streaming delta patcher for pull OTA.
+//
+// Input is an ENDSLEY/BSDIFF43 patch wrapped in a heatshrink bitstream
+// (window 2^OTA_HS_WINDOW, lookahead 2^OTA_HS_LOOKAHEAD), as produced by
+// tools/update_server.py. Bytes are decompressed and patched against the
+// old image as they arrive; the new image comes out through a sink in
+// OTA_PULL_CHUNK-sized pieces. RAM use is fixed (window + read cache +
+// output buffer), independent of the image size.
+
+// Read `len` bytes of the old image at `offset` (returns false on error)
+typedef bool (*DeltaReadFn)(uint32_t offset, uint8_t *buf, size_t len);
+
+// Receive a piece of the new image (returns false to abort)
+typedef bool (*DeltaWriteFn)(const uint8_t *data, size_t len);
+
+// Start a patch. `oldSize` bounds reads of the old image; `newSize` is the
+// expected output size (checked against the patch header).
+void delta_begin(DeltaReadFn readOld, uint32_t oldSize, DeltaWriteFn sink, uint32_t newSize);
+
+// Feed compressed patch bytes. Returns false once an error occurred.
+bool delta_feed(const uint8_t *data, size_t len);
+
+// Flush buffered output. True if the whole new image was produced.
+bool delta_finish();
+
+// Error description, or nullptr
+const char* delta_error();
+
+// New-image bytes produced so far
+uint32_t delta_produced();
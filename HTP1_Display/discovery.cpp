@@ -0,0 +1,288 @@
+#include "discovery.h"
+#include "config.h"
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include <mdns.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+struct Device {
+    char name[40];          // DNS-SD instance name ("" if only resolved by hostname)
+    char host[32];          // mDNS hostname without ".local" ("" = free slot)
+    char ip[16];
+    uint16_t port;
+    unsigned long seenMs;
+    uint32_t ttlMs;         // Valid until seenMs + ttlMs
+};
+
+static TaskHandle_t discTask = nullptr;
+
+// Cache — written by the task, read by the loop and the web server (devMux)
+static portMUX_TYPE devMux = portMUX_INITIALIZER_UNLOCKED;
+static Device devices[DISCOVERY_MAX_DEVICES];
+static char resolveHost[32] = "";     // Re-resolution requested by the loop
+static volatile bool scanning = false;
+
+// --- Follow-up (loop) ---
+static char followFor[40] = "";       // Configured address the state below belongs to
+static char followHost[32] = "";      // Its hostname: typed, or learned from the cache
+static char movedTo[16] = "";         // Last address the client was moved to
+static unsigned long lastResolveReq = 0;
+static bool resolveRequested = false;
+
+// --- Stats ---
+static uint32_t browses = 0;
+static uint32_t resolvesOk = 0;
+static uint32_t resolvesFailed = 0;
+static uint32_t moves = 0;
+
+// "HTP-1.local." -> "HTP-1"
+static void strip_local(const char *in, char *out, size_t len) {
+    strlcpy(out, in, len);
+    size_t n = strlen(out);
+    if (n && out[n - 1] == '.') out[--n] = '\0';
+    if (n > 6 && strcasecmp(out + n - 6, ".local") == 0) out[n - 6] = '\0';
+}
+
+static bool name_matches(const char *s) {
+    size_t m = strlen(DISCOVERY_NAME_MATCH);
+    for (; *s; s++) {
+        if (strncasecmp(s, DISCOVERY_NAME_MATCH, m) == 0) return true;
+    }
+    return false;
+}
+
+static bool expired(const Device &d, unsigned long now) {
+    return now - d.seenMs >= d.ttlMs;
+}
+
+// Add or refresh a device; null name / zero port keep the cached values
+static void upsert(const char *name, const char *host, const char *ip, uint16_t port, uint32_t ttlMs) {
+    unsigned long now = millis();
+    portENTER_CRITICAL(&devMux);
+    Device *slot = nullptr;
+    for (Device &d : devices) {
+        if (d.host[0] && strcasecmp(d.host, host) == 0) { slot = &d; break; }
+    }
+    if (!slot) {
+        // A free slot, else the one that expired or was seen longest ago
+        for (Device &d : devices) {
+            if (!d.host[0]) { slot = &d; break; }
+            if (!slot || (expired(d, now) && !expired(*slot, now)) ||
+                (long)(d.seenMs - slot->seenMs) < 0) slot = &d;
+        }
+        memset(slot, 0, sizeof(*slot));
+        strlcpy(slot->host, host, sizeof(slot->host));
+    }
+    if (name) strlcpy(slot->name, name, sizeof(slot->name));
+    if (port) slot->port = port;
+    strlcpy(slot->ip, ip, sizeof(slot->ip));
+    slot->seenMs = now;
+    slot->ttlMs = ttlMs;
+    portEXIT_CRITICAL(&devMux);
+}
+
+// Cached address of `host` (optionally also an expired one)
+static bool lookup(const char *host, char *ip, size_t len, bool stale = false) {
+    bool found = false;
+    unsigned long now = millis();
+    portENTER_CRITICAL(&devMux);
+    for (const Device &d : devices) {
+        if (d.host[0] && strcasecmp(d.host, host) == 0 && (stale || !expired(d, now))) {
+            strlcpy(ip, d.ip, len);
+            found = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&devMux);
+    return found;
+}
+
+// Hostname last seen at `ip` (expired entries still tell us the name)
+static bool host_of(const char *ip, char *host, size_t len) {
+    bool found = false;
+    portENTER_CRITICAL(&devMux);
+    for (const Device &d : devices) {
+        if (d.host[0] && strcmp(d.ip, ip) == 0) {
+            strlcpy(host, d.host, len);
+            found = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&devMux);
+    return found;
+}
+
+// ============================================================
+// Discovery task (blocking mDNS queries)
+// ============================================================
+
+static void browse() {
+    scanning = true;
+    mdns_result_t *results = nullptr;
+    esp_err_t err = mdns_query_ptr(DISCOVERY_SERVICE, DISCOVERY_PROTO, DISCOVERY_QUERY_MS,
+                                   DISCOVERY_MAX_DEVICES * 2, &results);
+    browses++;
+    if (err == ESP_OK) {
+        for (mdns_result_t *r = results; r; r = r->next) {
+            const char *name = r->instance_name ? r->instance_name : "";
+            if (!r->hostname || (!name_matches(name) && !name_matches(r->hostname))) continue;
+            for (mdns_ip_addr_t *a = r->addr; a; a = a->next) {
+                if (a->addr.type != ESP_IPADDR_TYPE_V4) continue;
+                String ip = IPAddress(a->addr.u_addr.ip4.addr).toString();
+                upsert(name, r->hostname, ip.c_str(), r->port, r->ttl * 1000);
+                break;
+            }
+        }
+        mdns_query_results_free(results);
+    }
+    scanning = false;
+}
+
+static void resolve(const char *host) {
+    esp_ip4_addr_t addr;
+    if (mdns_query_a(host, DISCOVERY_QUERY_MS, &addr) != ESP_OK) {
+        resolvesFailed++;
+        Serial.printf("[mDNS] %s.local did not answer\n", host);
+        return;
+    }
+    resolvesOk++;
+    String ip = IPAddress(addr.addr).toString();
+    upsert(nullptr, host, ip.c_str(), 0, DISCOVERY_HOST_TTL_MS);
+    Serial.printf("[mDNS] %s.local -> %s\n", host, ip.c_str());
+}
+
+// --- Sleeps until the browse interval, a rescan or a resolve request ---
+static void discovery_task(void *arg) {
+    TickType_t wait = pdMS_TO_TICKS(DISCOVERY_FIRST_BROWSE_MS);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, wait);
+        wait = pdMS_TO_TICKS(DISCOVERY_BROWSE_INTERVAL_MS);
+        if (WiFi.status() != WL_CONNECTED) continue;
+
+        char host[sizeof(resolveHost)];
+        portENTER_CRITICAL(&devMux);
+        strlcpy(host, resolveHost, sizeof(host));
+        resolveHost[0] = '\0';
+        portEXIT_CRITICAL(&devMux);
+
+        // A moved processor answers its hostname even if it is not browsable
+        if (host[0]) resolve(host);
+        browse();
+    }
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void discovery_begin() {
+    if (!discTask) {
+        xTaskCreatePinnedToCore(discovery_task, "discovery", 4096, nullptr, 1, &discTask, 0);
+    }
+}
+
+void discovery_rescan() {
+    if (discTask) xTaskNotifyGive(discTask);
+}
+
+bool discovery_is_hostname(const char *addr) {
+    IPAddress ip;
+    return addr[0] && !ip.fromString(addr);
+}
+
+void discovery_target_for(const char *configured, char *ip, size_t len) {
+    if (!discovery_is_hostname(configured)) {
+        strlcpy(ip, configured, len);
+        return;
+    }
+    char host[sizeof(followHost)];
+    strip_local(configured, host, sizeof(host));
+    // A stale address beats none: following corrects it once re-resolved
+    if (!lookup(host, ip, len, true)) ip[0] = '\0';
+}
+
+bool discovery_follow(const char *configured, const char *current, uint16_t failures,
+                      char *ip, size_t len) {
+    if (!discTask || !configured[0]) return false;
+    bool byName = discovery_is_hostname(configured);
+
+    // New setting: forget the learned name, unless we just moved the IP there
+    if (strcmp(configured, followFor) != 0) {
+        if (byName || strcmp(configured, movedTo) != 0) followHost[0] = '\0';
+        strlcpy(followFor, configured, sizeof(followFor));
+    }
+    if (byName) strip_local(configured, followHost, sizeof(followHost));
+    else if (!followHost[0]) host_of(configured, followHost, sizeof(followHost));
+    if (!followHost[0]) return false;
+
+    // A hostname follows its address at once; an IP only once it stops answering
+    bool failing = failures >= DISCOVERY_RESOLVE_AFTER_FAILS;
+    char found[16];
+    bool known = lookup(followHost, found, sizeof(found));
+    if (known && strcmp(found, current) != 0 && (byName || failing)) {
+        Serial.printf("[mDNS] %s.local is at %s, following\n", followHost, found);
+        strlcpy(movedTo, found, sizeof(movedTo));
+        strlcpy(ip, found, len);
+        moves++;
+        return true;
+    }
+
+    if (((byName && !known) || failing) &&
+        (!resolveRequested || millis() - lastResolveReq >= DISCOVERY_RESOLVE_INTERVAL_MS)) {
+        resolveRequested = true;
+        lastResolveReq = millis();
+        portENTER_CRITICAL(&devMux);
+        strlcpy(resolveHost, followHost, sizeof(resolveHost));
+        portEXIT_CRITICAL(&devMux);
+        xTaskNotifyGive(discTask);
+    }
+    return false;
+}
+
+String discovery_json() {
+    Device snap[DISCOVERY_MAX_DEVICES];
+    portENTER_CRITICAL(&devMux);
+    memcpy(snap, devices, sizeof(snap));
+    portEXIT_CRITICAL(&devMux);
+
+    JsonDocument doc;
+    doc["scanning"] = (bool)scanning;
+    JsonArray list = doc["devices"].to<JsonArray>();
+    unsigned long now = millis();
+    for (const Device &d : snap) {
+        if (!d.host[0] || expired(d, now)) continue;
+        JsonObject o = list.add<JsonObject>();
+        o["name"]  = d.name;
+        o["host"]  = String(d.host) + ".local";
+        o["ip"]    = d.ip;
+        o["port"]  = d.port ? d.port : HTP1_DEFAULT_PORT;
+        o["ttl_s"] = (d.ttlMs - (now - d.seenMs)) / 1000;
+    }
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+void discovery_report_metrics(Print &out) {
+    int live = 0;
+    unsigned long now = millis();
+    portENTER_CRITICAL(&devMux);
+    for (const Device &d : devices) live += d.host[0] && !expired(d, now);
+    portEXIT_CRITICAL(&devMux);
+
+    out.printf("# HELP htp1_discovery_devices HTP-1 processors in the mDNS cache (unexpired)\n"
+               "# TYPE htp1_discovery_devices gauge\n"
+               "htp1_discovery_devices %d\n", live);
+    out.printf("# HELP htp1_discovery_browses_total DNS-SD browses for " DISCOVERY_SERVICE "." DISCOVERY_PROTO "\n"
+               "# TYPE htp1_discovery_browses_total counter\n"
+               "htp1_discovery_browses_total %u\n", browses);
+    out.printf("# HELP htp1_discovery_resolves_total Hostname re-resolutions by result\n"
+               "# TYPE htp1_discovery_resolves_total counter\n"
+               "htp1_discovery_resolves_total{result=\"ok\"} %u\n"
+               "htp1_discovery_resolves_total{result=\"failed\"} %u\n", resolvesOk, resolvesFailed);
+    out.printf("# HELP htp1_discovery_moves_total Times the client followed the HTP-1 to a new address\n"
+               "# TYPE htp1_discovery_moves_total counter\n"
+               "htp1_discovery_moves_total %u\n", moves);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+
+// HTP-1 discovery over mDNS / DNS-SD.
+//
+// A low-priority task on core 0 browses for DISCOVERY_SERVICE instances
+// whose instance or host name contains DISCOVERY_NAME_MATCH, and caches
+// each one's address until its record TTL runs out. Queries block only
+// that task; the loop reads the cache.
+//
+// The configured HTP-1 address may be an IP or an mDNS hostname
+// ("htp-1.local"). For a hostname the client connects to the discovered
+// address. For an IP the hostname behind it is learned from the cache; if
+// connecting then keeps failing, the hostname is re-resolved and the
+// client follows the processor to its new address.
+
+// Start the background task (STA mode; MDNS.begin() must have run)
+void discovery_begin();
+
+// Browse now (web UI "Find")
+void discovery_rescan();
+
+// Is `addr` a hostname rather than a dotted IPv4 address?
+bool discovery_is_hostname(const char *addr);
+
+// Address for the client to use: `configured` itself for an IP, the
+// last cached address for a hostname ("" until it has been resolved)
+void discovery_target_for(const char *configured, char *ip, size_t len);
+
+// Loop follow-up (about once a second). `current` is the client's target,
+// `failures` its consecutive connect failures. Queues re-resolution when
+// needed; returns true and fills `ip` when the client should move.
+bool discovery_follow(const char *configured, const char *current, uint16_t failures,
+                      char *ip, size_t len);
+
+// Discovered devices as JSON (for GET /discover) — safe from any task
+String discovery_json();
+
+// Discovery counters in Prometheus text format (for /metrics)
+void discovery_report_metrics(Print &out);
@@ -2,11 +2,17 @@
 #include "config.h"
 #include "htp1_client.h"
 #include "rm67162.h"
+#include "brightness.h"
+#include "layout.h"
+#include "metrics.h"
+#include "burnin.h"
 #include <TFT_eSPI.h>
 
 static TFT_eSPI tft = TFT_eSPI();
 static TFT_eSprite sprite = TFT_eSprite(&tft);
 
+#define MUTE_COLOR 0xF800  // Red for mute / standby indication
+
 // --- Theme Color Table (RGB565) ---
 static uint16_t theme_color(ColorTheme t) {
     switch (t) {
@@ -31,27 +37,123 @@ static uint16_t theme_dim(ColorTheme t) {
     }
 }
 
-// --- Push sprite to hardware ---
+// --- Palette ---
+// The sprite is 4-bit indexed: it holds pens, and the panel push expands
+// them to RGB565 through this palette. Pens 1-3 follow the layout's
+// ColorRole order. Every frame uses at most black, the theme colours,
+// mute red and a message colour, so 16 entries leave room to spare.
+enum Pen : uint8_t { PEN_BLACK = 0, PEN_FG, PEN_DIM, PEN_ALERT, PEN_MESSAGE };
+
+#define FB_STRIDE (DISPLAY_WIDTH / 2)   // Bytes per sprite row
+
+static uint16_t palette[16];
+
+static void set_theme(ColorTheme t) {
+    palette[PEN_FG]    = theme_color(t);
+    palette[PEN_DIM]   = theme_dim(t);
+    palette[PEN_ALERT] = MUTE_COLOR;
+}
+
+// ============================================================
+// Dirty-span push
+// ============================================================
+// Frames are mostly black. The lit extent each push left on every panel
+// row is kept (in 32-bit words of the sprite, 8 pixels each), and a push
+// sends only the columns that are lit now or were lit before: rows black
+// on both sides are skipped, and old content is cleared by the black
+// pixels around the new. Consecutive rows become one window, bridging
+// short gaps since every window costs a few command transactions.
+
+#define SPAN_WORD_PX  8                   // 4-bit pixels per 32-bit word
+#define SPAN_WORDS    (FB_STRIDE / 4)     // Words per sprite row
+#define SPAN_GAP_ROWS 4                   // Black rows bridged inside a window
+
+struct RowSpan {
+    uint8_t lo, hi;                       // Lit words [lo, hi); lo >= hi = black
+};
+
+static RowSpan panelSpan[DISPLAY_HEIGHT];   // What the panel shows now
+static uint32_t spanWindows = 0;
+static uint32_t spanRowsSkipped = 0;
+
+// Contents unknown (power-up GRAM): the next push sends every row in full
+static void span_invalidate() {
+    for (RowSpan &r : panelSpan) r = { 0, SPAN_WORDS };
+}
+
+static RowSpan scan_row(const uint32_t *row) {
+    int lo = 0, hi = SPAN_WORDS;
+    while (lo < hi && !row[lo]) lo++;
+    while (hi > lo && !row[hi - 1]) hi--;
+    return { (uint8_t)lo, (uint8_t)hi };
+}
+
+static void push_window(int y, int h, int lo, int hi) {
+    int x = lo * SPAN_WORD_PX, w = (hi - lo) * SPAN_WORD_PX;
+    lcd_PushIndexed(x, y, w, h, (const uint8_t*)sprite.getPointer(), FB_STRIDE, palette);
+    metrics_add(MET_PUSH_SENT_BYTES, (uint32_t)w * h * 2);
+    spanWindows++;
+}
+
+// --- Push sprite rows [y, y+h) to hardware ---
+static void push_rows(int y, int h) {
+    if (y < 0) { h += y; y = 0; }
+    if (y + h > DISPLAY_HEIGHT) h = DISPLAY_HEIGHT - y;
+    if (h <= 0) return;
+    metrics_add(MET_PUSH_FULL_BYTES, (uint32_t)DISPLAY_WIDTH * h * 2);
+
+    const uint32_t *fb = (const uint32_t*)sprite.getPointer();
+    int runY = -1, runLo = 0, runHi = 0, gap = 0;
+    for (int r = y; r < y + h; r++) {
+        RowSpan now = scan_row(fb + r * SPAN_WORDS);
+        RowSpan was = panelSpan[r];
+        panelSpan[r] = now;
+
+        // Columns to send: lit now, or lit on the panel and to be cleared
+        int lo = SPAN_WORDS, hi = 0;
+        if (now.lo < now.hi) { lo = now.lo; hi = now.hi; }
+        if (was.lo < was.hi) { lo = min(lo, (int)was.lo); hi = max(hi, (int)was.hi); }
+
+        if (lo >= hi) {
+            spanRowsSkipped++;
+            if (runY >= 0 && ++gap > SPAN_GAP_ROWS) {
+                push_window(runY, r - gap + 1 - runY, runLo, runHi);
+                runY = -1;
+            }
+            continue;
+        }
+        if (runY < 0) {
+            runY = r;
+            runLo = lo;
+            runHi = hi;
+        } else {
+            spanRowsSkipped -= gap;   // Bridged rows are sent after all
+            runLo = min(runLo, lo);
+            runHi = max(runHi, hi);
+        }
+        gap = 0;
+    }
+    if (runY >= 0) push_window(runY, y + h - gap - runY, runLo, runHi);
+}
+
 static void push() {
-    lcd_PushColors(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT,
-                   (uint16_t*)sprite.getPointer());
+    push_rows(0, DISPLAY_HEIGHT);
 }
 
 // --- Draw volume string ---
 // textSize: 5=240px (full height), 3=144px, 2=96px with font 7
-static void draw_volume(const HTP1State &state, uint16_t color, int y, uint8_t textSize) {
-    sprite.setTextColor(color, TFT_BLACK);
+static void draw_volume(int volume, bool muted, uint8_t pen, const DrawOp &op) {
+    sprite.setTextColor(pen, PEN_BLACK);
+    sprite.setTextDatum(op.datum);
 
-    if (state.muted) {
+    if (muted) {
         // Font 7 is 7-segment (digits only) — use font 4 for "MUTE"
-        sprite.setTextDatum(TC_DATUM);
-        sprite.setTextSize(textSize > 3 ? 4 : textSize);
-        sprite.drawString("MUTE", DISPLAY_WIDTH / 2, y, 4);
+        sprite.setTextSize(op.size > 3 ? 4 : op.size);
+        sprite.drawString("MUTE", op.x, op.y, 4);
     } else {
-        String vol = String(state.volume + state.volumeOffset);
-        sprite.setTextDatum(TC_DATUM);
-        sprite.setTextSize(textSize);
-        sprite.drawString(vol, DISPLAY_WIDTH / 2, y, 7);
+        String vol = String(volume);
+        sprite.setTextSize(op.size);
+        sprite.drawString(vol, op.x, op.y, op.font);
     }
     sprite.setTextDatum(TL_DATUM);  // Reset
 }
@@ -89,137 +191,620 @@ static const char* lookup_input_name(const char* code, const AppSettings &settin
     return code;  // Fall back to raw code
 }
 
+// --- Resolved layout for the current settings ---
+static DrawList drawList;
+
+// Per-op text (name mapping, abbreviation) and auto-shrink decision,
+// keyed by the interned ids behind it and rebuilt only when they change
+#define OP_KEY_NONE 0xFFFFFFFF
+static uint32_t opKey[LAYOUT_MAX_OPS];
+static String opText[LAYOUT_MAX_OPS];
+static uint8_t shrinkSize[LAYOUT_MAX_OPS];
+
+static bool layoutStale = false;   // Custom layout changed underneath us
+
+// Rows the draw list can use at zero offset — reserved even while a field
+// is blank (e.g. STANDBY), so the burn-in offset never pushes them off screen
+static int16_t bandY0 = 0, bandY1 = DISPLAY_HEIGHT;
+
+static void resolve_layout(const AppSettings &settings) {
+    layout_resolve(settings, drawList);
+    layoutStale = false;
+    bandY0 = DISPLAY_HEIGHT;
+    bandY1 = 0;
+    for (int i = 0; i < LAYOUT_MAX_OPS; i++) {
+        opKey[i] = OP_KEY_NONE;
+        shrinkSize[i] = 0;
+        if (i < drawList.count) {
+            const DrawOp &op = drawList.ops[i];
+            bandY0 = min<int16_t>(bandY0, layout_op_top(op));
+            bandY1 = max<int16_t>(bandY1, layout_op_top(op) + op.h);
+        }
+    }
+}
+
 // --- Draw secondary info line ---
-static void draw_label(const char* text, uint16_t color, int x, int y, uint8_t font, uint8_t size) {
-    sprite.setTextColor(color, TFT_BLACK);
+// Shrinks one size step if wider than the op's maxWidth.
+static void draw_label(const String &text, uint8_t pen, const DrawOp &op, int idx) {
+    uint8_t size = op.size;
+    if (op.maxWidth > 0 && op.size > 1) {
+        if (shrinkSize[idx] == 0) {
+            sprite.setTextSize(op.size);
+            shrinkSize[idx] = sprite.textWidth(text, op.font) > op.maxWidth ? op.size - 1 : op.size;
+        }
+        size = shrinkSize[idx];
+    }
+    sprite.setTextColor(pen, PEN_BLACK);
     sprite.setTextSize(size);
-    sprite.drawString(text, x, y, font);
+    sprite.setTextDatum(op.datum);
+    sprite.drawString(text, op.x, op.y, op.font);
+    sprite.setTextDatum(TL_DATUM);
 }
 
-// ============================================================
-// Public API
-// ============================================================
+// --- Text for a label field ---
+static String field_text(LayoutField field, const HTP1State &state, const AppSettings &settings) {
+    switch (field) {
+        case FIELD_INPUT:      return lookup_input_name(str_get(state.inputLabel), settings);
+        case FIELD_CODEC:      return build_codec_string(str_get(state.codecName), str_get(state.programFormat));
+        case FIELD_SURROUND:   return str_get(state.surroundMode);
+        case FIELD_LISTEN_FMT: return str_get(state.listeningFormat);
+        case FIELD_POWER:      return "STANDBY";
+        default:               return "";
+    }
+}
 
-void display_init() {
-    rm67162_init();
-    lcd_setRotation(1);
-    sprite.createSprite(DISPLAY_WIDTH, DISPLAY_HEIGHT);
-    sprite.setSwapBytes(1);
-    lcd_brightness(BRIGHTNESS_PRESETS[BRIGHTNESS_DEFAULT]);
+// --- Interned ids a label field is built from ---
+static uint32_t field_key(LayoutField field, const HTP1State &state) {
+    switch (field) {
+        case FIELD_INPUT:      return state.inputLabel;
+        case FIELD_CODEC:      return (uint32_t)state.codecName << 16 | state.programFormat;
+        case FIELD_SURROUND:   return state.surroundMode;
+        case FIELD_LISTEN_FMT: return state.listeningFormat;
+        default:               return 0;
+    }
 }
 
-void display_render(const HTP1State &state, const AppSettings &settings) {
-    ColorTheme theme = settings.color_theme;
-    DisplayMode mode = settings.display_mode;
-    uint8_t volSize   = settings.vol_sizes[mode];
-    uint8_t labelSize = settings.label_sizes[mode];
+// --- Cached text for op `idx` ---
+static const String& op_text(int idx, LayoutField field, const HTP1State &state, const AppSettings &settings) {
+    uint32_t key = field_key(field, state);
+    if (key != opKey[idx]) {
+        opKey[idx] = key;
+        opText[idx] = field_text(field, state, settings);
+        shrinkSize[idx] = 0;
+    }
+    return opText[idx];
+}
+
+// Volume band of the last composed frame (rows to push for a volume roll)
+static int volBandY = 0;
+static int volBandH = DISPLAY_HEIGHT;
+
+// Burn-in offset the layout is drawn at (see burnin.h)
+static int8_t offX = 0, offY = 0;
+
+// Content box of the last composed frame at zero offset: lit columns (to
+// the 8 px span word) and lit rows plus the draw list bands. The burn-in
+// offset is clamped to the room around it, so orbit and idle shift never
+// cut off edge-anchored labels.
+static int16_t boxX0 = 0, boxX1 = 0, boxY0 = 0, boxY1 = 0;
+
+static void measure_frame(bool bands) {
+    const uint32_t *fb = (const uint32_t*)sprite.getPointer();
+    int x0 = SPAN_WORDS, x1 = 0, y0 = DISPLAY_HEIGHT, y1 = 0;
+    for (int r = 0; r < DISPLAY_HEIGHT; r++) {
+        RowSpan row = scan_row(fb + r * SPAN_WORDS);
+        if (row.lo >= row.hi) continue;
+        x0 = min(x0, (int)row.lo);
+        x1 = max(x1, (int)row.hi);
+        if (y0 == DISPLAY_HEIGHT) y0 = r;
+        y1 = r + 1;
+    }
+    if (x0 < x1) {
+        boxX0 = x0 * SPAN_WORD_PX - offX;
+        boxX1 = x1 * SPAN_WORD_PX - offX;
+        boxY0 = y0 - offY;
+        boxY1 = y1 - offY;
+    } else {
+        boxX0 = boxX1 = boxY0 = boxY1 = 0;
+    }
+    if (bands && bandY0 < bandY1) {
+        boxY0 = boxY0 < boxY1 ? min(boxY0, bandY0) : bandY0;
+        boxY1 = max(boxY1, bandY1);
+    }
+}
+
+// Offset `d` limited to the room around content [lo, hi) on a `size` axis
+static int8_t clamp_axis(int8_t d, int lo, int hi, int size) {
+    if (lo >= hi) return d;   // Nothing drawn
+    return constrain((int)d, -max(lo, 0), max(size - hi, 0));
+}
 
-    uint16_t fg = theme_color(theme);
-    uint16_t dim = theme_dim(theme);
-    uint16_t muteColor = 0xF800;  // Red for mute indication
+// Burn-in offset to draw at now, clamped to the content box
+static void get_offset(int8_t &dx, int8_t &dy) {
+    burnin_offset(dx, dy);
+    dx = clamp_axis(dx, boxX0, boxX1, DISPLAY_WIDTH);
+    dy = clamp_axis(dy, boxY0, boxY1, DISPLAY_HEIGHT);
+}
 
-    const char* inputDisplay = lookup_input_name(state.inputLabel, settings);
+// --- Compose a full frame into the sprite ---
+// Walks the precomputed draw list at the burn-in offset; `volume` is the
+// (possibly animated) value to show. Records the volume band for partial
+// pushes.
+static void compose(const HTP1State &state, const AppSettings &settings, int volume) {
+    set_theme(settings.color_theme);
 
     static unsigned long lastDebugRender = 0;
     if (millis() - lastDebugRender > 5000) {
         lastDebugRender = millis();
-        Serial.printf("[DISP] mode=%d theme=%d vol=%d vsz=%d lsz=%d input='%s'->'%s' codec='%s'\n",
-                      mode, theme, state.volume + state.volumeOffset,
-                      volSize, labelSize,
-                      state.inputLabel, inputDisplay, state.codecName);
+        Serial.printf("[DISP] mode=%d theme=%d vol=%d ops=%d input='%s'->'%s' codec='%s'\n",
+                      settings.display_mode, settings.color_theme, volume, drawList.count,
+                      str_get(state.inputLabel), lookup_input_name(str_get(state.inputLabel), settings),
+                      str_get(state.codecName));
+    }
+
+    sprite.fillSprite(PEN_BLACK);
+
+    for (int i = 0; i < drawList.count; i++) {
+        DrawOp op = drawList.ops[i];
+        op.x += offX;
+        op.y += offY;
+
+        if (op.field == FIELD_VOLUME) {
+            draw_volume(volume, state.muted, state.muted ? PEN_ALERT : PEN_FG + op.color, op);
+            volBandY = layout_op_top(op);
+            volBandH = op.h;
+        } else if (op.field != FIELD_POWER || !state.powerIsOn) {
+            draw_label(op_text(i, op.field, state, settings), PEN_FG + op.color, op, i);
+        }
     }
+    measure_frame(true);
+}
+
+// ============================================================
+// Animation scheduler
+// ============================================================
+// Animations are time-based: each frame samples progress at the current
+// time, so frames that miss their deadline are simply skipped rather than
+// queued. Volume rolls push only the rows covering the volume digits.
+// Brightness fades run on the brightness controller's own task; the frame
+// clock only watches them to sequence mode transitions.
+
+#define FRAME_US (1000000UL / ANIM_FPS)
+#define ANIM_HIST_BUCKETS 6   // <2, <4, <8, <16, <33, >=33 ms
+
+static const uint16_t HIST_BOUNDS_MS[ANIM_HIST_BUCKETS - 1] = { 2, 4, 8, 16, 33 };
+
+// --- Compose a frame and push rows [y, y+h), timed for /metrics ---
+static void redraw(const HTP1State &state, const AppSettings &settings, int volume, int y, int h) {
+    unsigned long startUs = micros();
+    compose(state, settings, volume);
+    push_rows(y, h);
+    metrics_observe(MET_RENDERS, MET_RENDER_US, micros() - startUs);
+}
 
-    sprite.fillSprite(TFT_BLACK);
+// HTP-1 fields each layout field is drawn from
+static uint16_t field_deps(LayoutField field) {
+    switch (field) {
+        case FIELD_VOLUME:     return HF_BIT(HF_VOLUME) | HF_BIT(HF_VOLUME_OFFSET) | HF_BIT(HF_MUTED);
+        case FIELD_INPUT:      return HF_BIT(HF_INPUT);
+        case FIELD_CODEC:      return HF_BIT(HF_CODEC) | HF_BIT(HF_PROGRAM_FORMAT);
+        case FIELD_SURROUND:   return HF_BIT(HF_SURROUND);
+        case FIELD_LISTEN_FMT: return HF_BIT(HF_LISTEN_FMT);
+        case FIELD_POWER:      return HF_BIT(HF_POWER);
+        default:               return 0;
+    }
+}
 
-    uint16_t volColor = state.muted ? muteColor : fg;
+// --- Compose a frame and push only the bands of ops drawn from `mask` ---
+// The sprite always holds the whole frame, so any subset of rows is valid.
+static void redraw_fields(const HTP1State &state, const AppSettings &settings, int volume, uint16_t mask) {
+    unsigned long startUs = micros();
+    compose(state, settings, volume);
+    for (int i = 0; i < drawList.count; i++) {
+        const DrawOp &op = drawList.ops[i];
+        if (field_deps(op.field) & mask) push_rows(layout_op_top(op) + offY, op.h);
+    }
+    metrics_observe(MET_RENDERS, MET_RENDER_US, micros() - startUs);
+    metrics_inc(MET_RENDERS_PARTIAL);
+}
 
-    // Font 7 height per textSize unit: 48px
-    // Font 4 height per textSize unit: ~26px
-    int volH   = volSize * 48;
-    int labelH = labelSize * 26;
+// Last rendered inputs — used to detect what actually changed
+static bool layoutValid = false;
+static const HTP1State *lastState = nullptr;   // Unit on screen (each has a fixed state)
+static uint32_t lastGen = 0;       // HTP1State generation on screen
+static AppSettings lastSettings;
+static const HTP1State *curState = nullptr;
+static const AppSettings *curSettings = nullptr;
+
+// Volume roll
+static bool volAnim = false;
+static int volFrom = 0, volTo = 0, volShown = 0;
+static unsigned long volStartUs = 0, volDurUs = 0;
+
+// Mode transition: fade out, swap layout, fade back in
+enum TransPhase : uint8_t { TRANS_NONE = 0, TRANS_OUT, TRANS_IN };
+static TransPhase transPhase = TRANS_NONE;
+static uint8_t transBrightness = 0;   // Brightness to restore after the swap
+
+// Frame clock + statistics. Written by the loop; the 32-bit fields are
+// read as they stand by the /metrics scrape.
+struct AnimStats {
+    uint32_t frames;                    // Frames rendered
+    uint32_t dropped;                   // Frames skipped on missed deadlines
+    float    fps;                       // Achieved frame rate while animating (last report window)
+    uint32_t hist[ANIM_HIST_BUCKETS];   // Frame-time histogram
+};
+
+static unsigned long nextFrameUs = 0;
+static unsigned long lastTickUs = 0;
+static AnimStats stats;
+static uint32_t windowFrames = 0;
+static unsigned long windowActiveUs = 0;
+static unsigned long lastAnimReport = 0;
+
+static bool anim_active() {
+    return volAnim || transPhase != TRANS_NONE;
+}
 
-    switch (mode) {
-        case MODE_VOLUME_ONLY: {
-            int y = (DISPLAY_HEIGHT - volH) / 2;
-            draw_volume(state, volColor, y, volSize);
-            break;
+static void start_volume_roll(int to) {
+    int from = volAnim ? volShown : volTo;
+    volFrom    = from;
+    volTo      = to;
+    volShown   = from;
+    volStartUs = micros();
+    volDurUs   = (unsigned long)min(abs(to - from) * ANIM_VOL_STEP_MS, ANIM_VOL_MAX_MS) * 1000;
+    volAnim    = true;
+}
+
+// Ease-out quadratic, t in [0,1]
+static float ease_out(float t) {
+    return 1.0f - (1.0f - t) * (1.0f - t);
+}
+
+static float progress(unsigned long startUs, unsigned long durUs, unsigned long now) {
+    if (durUs == 0) return 1.0f;
+    float t = (float)(now - startUs) / durUs;
+    return t >= 1.0f ? 1.0f : t;
+}
+
+static void record_frame(unsigned long frameUs) {
+    stats.frames++;
+    windowFrames++;
+    metrics_add(MET_ANIM_FRAME_US, frameUs);
+    uint32_t ms = frameUs / 1000;
+    int b = 0;
+    while (b < ANIM_HIST_BUCKETS - 1 && ms >= HIST_BOUNDS_MS[b]) b++;
+    stats.hist[b]++;
+}
+
+static void report_stats() {
+    if (millis() - lastAnimReport < ANIM_REPORT_INTERVAL_MS) return;
+    lastAnimReport = millis();
+
+    // Dirty-span savings since the last report
+    static uint64_t lastRequested = 0, lastSent = 0;
+    uint64_t requested = metrics_sum(MET_PUSH_FULL_BYTES), sentTotal = metrics_sum(MET_PUSH_SENT_BYTES);
+    if (requested != lastRequested) {
+        uint64_t full = requested - lastRequested, sent = sentTotal - lastSent;
+        Serial.printf("[DISP] pushed %llu of %llu KB (%.0f%%) as dirty spans\n",
+                      (unsigned long long)(sent / 1024), (unsigned long long)(full / 1024),
+                      100.0 * sent / full);
+        lastRequested = requested;
+        lastSent = sentTotal;
+    }
+    if (windowFrames == 0) return;
+
+    stats.fps = windowActiveUs ? windowFrames * 1000000.0f / windowActiveUs : 0;
+    Serial.printf("[ANIM] fps=%.1f frames=%u dropped=%u hist(ms) <2:%u <4:%u <8:%u <16:%u <33:%u >=33:%u\n",
+                  stats.fps, stats.frames, stats.dropped,
+                  stats.hist[0], stats.hist[1], stats.hist[2],
+                  stats.hist[3], stats.hist[4], stats.hist[5]);
+    windowFrames = 0;
+    windowActiveUs = 0;
+}
+
+// --- Render one animation frame at time `now` ---
+static void render_frame(unsigned long now) {
+    // Mode transition: swap the layout once faded out
+    bool fading = brightness_fading();
+    if (transPhase == TRANS_OUT && !fading) {
+        if (curState && curSettings) {
+            volAnim = false;
+            volTo = volShown = curState->volume + curState->volumeOffset;
+            lastState = curState;
+            lastGen = curState->generation;
+            memcpy(&lastSettings, curSettings, sizeof(lastSettings));
+            resolve_layout(*curSettings);
+            get_offset(offX, offY);
+            redraw(*curState, *curSettings, volShown, 0, DISPLAY_HEIGHT);
         }
+        transPhase = TRANS_IN;
+        brightness_fade_to(transBrightness, ANIM_MODE_FADE_MS);
+    } else if (transPhase == TRANS_IN && !fading) {
+        transPhase = TRANS_NONE;
+    }
 
-        case MODE_VOLUME_SOURCE: {
-            draw_label(inputDisplay, dim, 10, 0, 4, labelSize);
-            int y = labelH + 4;
-            draw_volume(state, volColor, y, volSize);
-            break;
+    // Volume roll — only rows covering the digits are pushed
+    if (volAnim && transPhase == TRANS_NONE && curState && curSettings) {
+        float t = progress(volStartUs, volDurUs, now);
+        int v = volFrom + (int)lroundf((volTo - volFrom) * ease_out(t));
+        if (v != volShown) {
+            volShown = v;
+            redraw(*curState, *curSettings, v, volBandY, volBandH);
         }
+        if (t >= 1.0f) volAnim = false;
+    }
+}
+
+// ============================================================
+// Split view — every configured HTP-1 unit side by side
+// ============================================================
+// One column per unit: input name on top, volume (or MUTE / STANDBY /
+// offline) below. Redrawn in full whenever a unit publishes or its link
+// changes; volume rolls and partial pushes belong to the single-unit
+// layouts.
+
+static bool splitValid = false;
+static uint8_t splitCount = 0;
+static uint32_t splitGen[HTP1_MAX_UNITS];
+static bool splitLink[HTP1_MAX_UNITS];
+
+static void compose_split(const AppSettings &settings, uint8_t n) {
+    set_theme(settings.color_theme);
+    int colW = DISPLAY_WIDTH / n;
+    int volY = DISPLAY_HEIGHT / 2 + 24 + offY;
+
+    sprite.fillSprite(PEN_BLACK);
+    sprite.setTextDatum(MC_DATUM);
+    for (uint8_t u = 0; u < n; u++) {
+        const HTP1State &st = htp1_get_state(u);
+        int cx = u * colW + colW / 2 + offX;
+        if (u > 0) sprite.drawFastVLine(u * colW + offX, 16 + offY, DISPLAY_HEIGHT - 32, PEN_DIM);
 
-        case MODE_VOLUME_CODEC: {
-            draw_volume(state, volColor, 0, volSize);
-            // Codec / format anchored at bottom
-            String codecLine = build_codec_string(state.codecName, state.programFormat);
-            sprite.setTextDatum(BC_DATUM);
-            // Auto-shrink if too wide
-            sprite.setTextSize(labelSize);
-            int cw = sprite.textWidth(codecLine, 4);
-            uint8_t csz = (cw > DISPLAY_WIDTH - 20 && labelSize > 1) ? labelSize - 1 : labelSize;
-            draw_label(codecLine.c_str(), dim, DISPLAY_WIDTH / 2, DISPLAY_HEIGHT - 2, 4, csz);
-            sprite.setTextDatum(TL_DATUM);
-            break;
+        // Input name, smaller font if it does not fit the column
+        const char *name = lookup_input_name(str_get(st.inputLabel), settings);
+        sprite.setTextSize(1);
+        sprite.setTextColor(PEN_DIM, PEN_BLACK);
+        sprite.drawString(name, cx, 36 + offY, sprite.textWidth(name, 4) > colW - 12 ? 2 : 4);
+
+        if (!htp1_connected(u) || !st.powerIsOn) {
+            sprite.setTextColor(PEN_DIM, PEN_BLACK);
+            sprite.drawString(htp1_connected(u) ? "STANDBY" : "offline", cx, volY, 4);
+        } else if (st.muted) {
+            sprite.setTextColor(PEN_ALERT, PEN_BLACK);
+            sprite.setTextSize(2);
+            sprite.drawString("MUTE", cx, volY, 4);
+        } else {
+            sprite.setTextColor(PEN_FG, PEN_BLACK);
+            sprite.setTextSize(colW >= 260 ? 2 : 1);   // Font 7: 64 / 32 px per digit
+            sprite.drawString(String(st.volume + st.volumeOffset), cx, volY, 7);
         }
+    }
+    sprite.setTextSize(1);
+    sprite.setTextDatum(TL_DATUM);
+    measure_frame(false);
+}
 
-        case MODE_FULL_STATUS: {
-            // Top row: source left, codec right
-            draw_label(inputDisplay, dim, 10, 0, 4, labelSize);
-            {
-                String codec = build_codec_string(state.codecName, state.programFormat);
-                sprite.setTextSize(labelSize);
-                int codecWidth = sprite.textWidth(codec, 4);
-                // Auto-shrink if codec overlaps with input label
-                uint8_t csz = (codecWidth > DISPLAY_WIDTH / 2 && labelSize > 1) ? labelSize - 1 : labelSize;
-                if (csz < labelSize) {
-                    sprite.setTextSize(csz);
-                    codecWidth = sprite.textWidth(codec, 4);
-                }
-                draw_label(codec.c_str(), dim, DISPLAY_WIDTH - codecWidth - 10, 0, 4, csz);
-            }
+static void render_split(const AppSettings &settings, uint8_t n) {
+    bool changed = !splitValid || n != splitCount ||
+                   memcmp(&settings, &lastSettings, sizeof(settings)) != 0;
+    for (uint8_t u = 0; u < n; u++) {
+        uint32_t gen = htp1_get_state(u).generation;
+        bool link = htp1_connected(u);
+        if (gen != splitGen[u] || link != splitLink[u]) changed = true;
+        splitGen[u] = gen;
+        splitLink[u] = link;
+    }
+    if (!changed) return;
 
-            // Volume: centered between top and bottom labels
-            int topY = labelH + 2;
-            int botLabelY = DISPLAY_HEIGHT - labelH;
-            int volY = topY + (botLabelY - topY - volH) / 2;
-            if (volY < topY) volY = topY;
-            draw_volume(state, volColor, volY, volSize);
-
-            // Bottom row: surround left, listening format right
-            draw_label(state.surroundMode, dim, 10, botLabelY, 4, labelSize);
-            {
-                sprite.setTextSize(labelSize);
-                int lfWidth = sprite.textWidth(state.listeningFormat, 4);
-                draw_label(state.listeningFormat, dim,
-                           DISPLAY_WIDTH - lfWidth - 10, botLabelY, 4, labelSize);
+    burnin_activity();
+    get_offset(offX, offY);
+    unsigned long startUs = micros();
+    compose_split(settings, n);
+    push();
+    metrics_observe(MET_RENDERS, MET_RENDER_US, micros() - startUs);
+
+    memcpy(&lastSettings, &settings, sizeof(lastSettings));
+    splitCount = n;
+    splitValid = true;
+    layoutValid = false;   // Leaving the split view redraws in full
+    volAnim = false;
+}
+
+// ============================================================
+// Burn-in offset
+// ============================================================
+// The orbit moves the layout one pixel at a time: each op's band of rows,
+// widened by the step, covers both where it was and where it is now, so
+// a step pushes only those rows. Idle shifts (and turning the mitigation
+// off) jump further and push the whole frame. Deferred while a roll or
+// transition is running, and while the panel is off.
+
+static bool panelOn = true;
+
+static void apply_offset() {
+    int8_t dx, dy;
+    get_offset(dx, dy);
+    if (dx == offX && dy == offY) return;
+    if (!panelOn || (!layoutValid && !splitValid) || !lastState) return;
+
+    bool step = abs(dx - offX) <= 1 && abs(dy - offY) <= 1;
+    int top = min(offY, dy), grow = abs(dy - offY);
+    offX = dx;
+    offY = dy;
+
+    unsigned long startUs = micros();
+    if (splitValid) {
+        compose_split(lastSettings, splitCount);
+        push();
+    } else {
+        compose(*lastState, lastSettings, volShown);
+        if (step) {
+            for (int i = 0; i < drawList.count; i++) {
+                const DrawOp &op = drawList.ops[i];
+                push_rows(layout_op_top(op) + top, op.h + grow);
             }
-            break;
+            metrics_inc(MET_RENDERS_PARTIAL);
+        } else {
+            push();
         }
+    }
+    metrics_observe(MET_RENDERS, MET_RENDER_US, micros() - startUs);
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void display_init() {
+    rm67162_init();
+    lcd_setRotation(1);
+    sprite.setColorDepth(4);
+    sprite.createSprite(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    span_invalidate();
+    Serial.printf("[DISP] Framebuffer 4-bit indexed: %u bytes (RGB565: %u) + %u bounce\n",
+                  FB_STRIDE * DISPLAY_HEIGHT, DISPLAY_WIDTH * DISPLAY_HEIGHT * 2, LCD_BOUNCE_BYTES);
+    brightness_init(BRIGHTNESS_PRESETS[BRIGHTNESS_DEFAULT]);
+    burnin_init();
+}
 
-        default: {
-            int y = (DISPLAY_HEIGHT - volH) / 2;
-            draw_volume(state, volColor, y, volSize);
-            break;
+void display_render(const HTP1State &state, const AppSettings &settings) {
+    curState = &state;
+    curSettings = &settings;
+    int volume = state.volume + state.volumeOffset;
+
+    // Split view (needs more than one configured unit)
+    uint8_t units = htp1_unit_count();
+    if (settings.split_view && units > 1) {
+        if (transPhase == TRANS_NONE) render_split(settings, units);
+        return;
+    }
+    splitValid = false;
+
+    // Mode change: cross-fade through black, layout swaps at the bottom
+    if (layoutValid && settings.display_mode != lastSettings.display_mode) {
+        if (transPhase == TRANS_NONE) {
+            transBrightness = brightness_target();
+            transPhase = TRANS_OUT;
+            brightness_fade_to(0, ANIM_MODE_FADE_MS);
+        }
+        return;
+    }
+    if (transPhase != TRANS_NONE) return;  // Picked up at the swap
+
+    // Same layout and unit: redraw only what the HTP-1 changed since the
+    // last render. Volume rolls; other fields push just their own rows.
+    if (layoutValid && !layoutStale && &state == lastState &&
+        memcmp(&settings, &lastSettings, sizeof(settings)) == 0) {
+        uint16_t mask = htp1_changed_since(state, lastGen);
+        if (!mask) return;  // Nothing visible changed
+
+        // Content changed: ends an idle shift. Snapping back from one
+        // moves everything, so that takes the full redraw below.
+        burnin_activity();
+        int8_t dx, dy;
+        get_offset(dx, dy);
+        if (dx == offX && dy == offY) {
+            lastGen = state.generation;
+            const uint16_t rolled = HF_BIT(HF_VOLUME) | HF_BIT(HF_VOLUME_OFFSET);
+            if (mask & ~rolled) redraw_fields(state, settings, volShown, mask & ~rolled);
+            if (mask & rolled) start_volume_roll(volume);
+            return;
         }
     }
 
-    // Power-off indicator
-    if (!state.powerIsOn) {
-        sprite.setTextDatum(BC_DATUM);
-        draw_label("STANDBY", muteColor, DISPLAY_WIDTH / 2, DISPLAY_HEIGHT - 5, 4, 1);
-        sprite.setTextDatum(TL_DATUM);
+    // Full redraw — snaps any running volume roll to the new value.
+    // The layout is re-resolved only when settings changed.
+    burnin_activity();
+    get_offset(offX, offY);
+    memcpy(&lastSettings, &settings, sizeof(lastSettings));
+    resolve_layout(settings);
+    lastState = &state;
+    lastGen = state.generation;
+    volAnim = false;
+    volTo = volShown = volume;
+    redraw(state, settings, volume, 0, DISPLAY_HEIGHT);
+    layoutValid = true;
+}
+
+void display_reload_layout() {
+    layoutStale = true;
+}
+
+void display_tick() {
+    burnin_account(panelOn ? (const uint8_t*)sprite.getPointer() : nullptr,
+                   panelOn ? brightness_current() : 0);
+
+    unsigned long now = micros();
+    if (!anim_active()) {
+        apply_offset();
+        lastTickUs = 0;
+        report_stats();
+        return;
     }
 
-    push();
+    if (lastTickUs) {
+        windowActiveUs += now - lastTickUs;
+    } else if ((long)(now - nextFrameUs) > 0) {
+        nextFrameUs = now;  // First frame of a new animation renders immediately
+    }
+    lastTickUs = now;
+
+    // Not due yet
+    if ((long)(now - nextFrameUs) < 0) return;
+
+    // Deadline-aware: if we fell behind, drop the frames we missed instead
+    // of rendering them late — progress is time-based so nothing is lost.
+    unsigned long late = now - nextFrameUs;
+    unsigned long missed = late / FRAME_US;
+    stats.dropped += missed;
+    nextFrameUs += (missed + 1) * FRAME_US;
+
+    render_frame(now);
+    record_frame(micros() - now);
+    report_stats();
+}
+
+void display_report_metrics(Print &out) {
+    out.printf("# HELP htp1_display_buffer_bytes Display memory: indexed sprite, DMA bounce buffer, RGB565 sprite it replaces\n"
+               "# TYPE htp1_display_buffer_bytes gauge\n"
+               "htp1_display_buffer_bytes{buffer=\"sprite\"} %u\n"
+               "htp1_display_buffer_bytes{buffer=\"bounce\"} %u\n"
+               "htp1_display_buffer_bytes{buffer=\"rgb565\"} %u\n",
+               sprite.created() ? FB_STRIDE * DISPLAY_HEIGHT : 0, LCD_BOUNCE_BYTES,
+               DISPLAY_WIDTH * DISPLAY_HEIGHT * 2);
+    out.printf("# HELP htp1_push_windows_total Windowed panel transfers\n"
+               "# TYPE htp1_push_windows_total counter\n"
+               "htp1_push_windows_total %u\n", spanWindows);
+    out.printf("# HELP htp1_push_rows_skipped_total Rows black on the panel and in the frame, not sent\n"
+               "# TYPE htp1_push_rows_skipped_total counter\n"
+               "htp1_push_rows_skipped_total %u\n", spanRowsSkipped);
+
+    out.printf("# HELP htp1_anim_frames_total Animation frames rendered / skipped on missed deadlines\n"
+               "# TYPE htp1_anim_frames_total counter\n"
+               "htp1_anim_frames_total{result=\"rendered\"} %u\n"
+               "htp1_anim_frames_total{result=\"dropped\"} %u\n", stats.frames, stats.dropped);
+    out.printf("# HELP htp1_anim_fps Achieved animation frame rate over the last report window\n"
+               "# TYPE htp1_anim_fps gauge\n"
+               "htp1_anim_fps %.1f\n", stats.fps);
+    out.printf("# HELP htp1_anim_frame_seconds Render time per animation frame\n"
+               "# TYPE htp1_anim_frame_seconds histogram\n");
+    uint32_t cum = 0;
+    for (int b = 0; b < ANIM_HIST_BUCKETS - 1; b++) {
+        cum += stats.hist[b];
+        out.printf("htp1_anim_frame_seconds_bucket{le=\"%g\"} %u\n", HIST_BOUNDS_MS[b] / 1e3, cum);
+    }
+    cum += stats.hist[ANIM_HIST_BUCKETS - 1];
+    out.printf("htp1_anim_frame_seconds_bucket{le=\"+Inf\"} %u\n"
+               "htp1_anim_frame_seconds_sum %.6f\n"
+               "htp1_anim_frame_seconds_count %u\n",
+               cum, metrics_sum(MET_ANIM_FRAME_US) / 1e6, cum);
 }
 
 void display_show_message(const char* line1, const char* line2, uint16_t color) {
-    sprite.fillSprite(TFT_BLACK);
-    sprite.setTextColor(color, TFT_BLACK);
+    palette[PEN_MESSAGE] = color;
+    sprite.fillSprite(PEN_BLACK);
+    sprite.setTextColor(PEN_MESSAGE, PEN_BLACK);
     sprite.setTextDatum(MC_DATUM);
 
     if (line2) {
@@ -234,16 +819,31 @@ void display_show_message(const char* line1, const char* line2, uint16_t color)
 
     sprite.setTextDatum(TL_DATUM);
     push();
+
+    // Messages replace the layout — next render must redraw in full
+    layoutValid = false;
+    splitValid = false;
+    volAnim = false;
+    if (transPhase != TRANS_NONE) {
+        transPhase = TRANS_NONE;
+        brightness_fade_to(transBrightness, ANIM_MODE_FADE_MS);
+    }
 }
 
 void display_set_brightness(uint8_t raw) {
-    lcd_brightness(raw);
+    if (transPhase != TRANS_NONE) {
+        transBrightness = raw;  // Applied when the transition fades back in
+        return;
+    }
+    brightness_fade_to(raw, ANIM_FADE_MS);
 }
 
 void display_on() {
     lcd_display_on();
+    panelOn = true;
 }
 
 void display_off() {
     lcd_display_off();
+    panelOn = false;
 }
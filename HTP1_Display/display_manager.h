@@ -9,14 +9,27 @@ struct HTP1State;
 // Initialize the display hardware (rm67162 + sprite)
 void display_init();
 
-// Render current HTP-1 state using the given theme & mode
+// Render current HTP-1 state using the given theme & mode.
+// Volume-only changes start an animated roll; mode changes cross-fade.
+// Returns immediately if nothing visible changed since the last render.
 void display_render(const HTP1State &state, const AppSettings &settings);
 
+// Re-resolve the layout on the next render (e.g. custom layout uploaded)
+void display_reload_layout();
+
+// Advance animations (volume roll, brightness fades, mode transitions)
+// on the ANIM_FPS frame clock. Call every loop() iteration.
+void display_tick();
+
+// Buffer sizes, push counters and animation frame stats in Prometheus
+// text format (for /metrics)
+void display_report_metrics(Print &out);
+
 // Show a simple centered message (for splash / status / errors)
 void display_show_message(const char* line1, const char* line2 = nullptr,
                           uint16_t color = 0xFFFF);
 
-// Brightness control
+// Brightness control — fades to the new level over ANIM_FADE_MS
 void display_set_brightness(uint8_t raw);
 
 // Display power
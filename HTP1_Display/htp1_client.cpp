@@ -1,270 +1,810 @@
 #include "htp1_client.h"
 #include "config.h"
+#include "metrics.h"
+#include "mso_mirror.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <WebSocketClient.h>
 #include <ArduinoJson.h>
+#include <lwip/sockets.h>
+#include <atomic>
 
-static WiFiClient tcpClient;
-static WebSocketClient wsClient;
-static HTP1State state;
-static char targetIP[40];
-static uint16_t targetPort;
-static unsigned long lastConnectAttempt = 0;
-static unsigned long lastHttpPoll = 0;
-static bool wsConnected = false;
+// ============================================================
+// Units
+// ============================================================
+// Everything about one processor connection. Units are allocated
+// statically, so an extra processor costs sizeof(HTP1Unit) plus its
+// socket's lwIP buffers while connected (measured as heapCost).
+
+// Command slots (REST API -> loop): filled from the web server task,
+// drained by htp1_poll() on the loop, which owns the sockets. One slot per
+// kind: a request that arrives before the previous one was sent replaces
+// it (the last volume set wins).
+enum CmdSlot : uint8_t { SLOT_VOLUME = 0, SLOT_MUTE, SLOT_INPUT, SLOT_POWER };
+
+struct HTP1Unit {
+    uint8_t index;
+    char tag[8];                      // Log prefix: "HTP1", "HTP1#2", ...
+    WiFiClient tcp;
+    WebSocketClient ws;
+    HTP1State state;                  // Working copy (loop)
+    HTP1State published;              // Latest generation, read via htp1_snapshot()
+    std::atomic<uint32_t> pubSeq;     // Seqlock: odd while publishing
+    uint16_t dirty;                   // Fields changed since the last publish
+    char targetIP[40];
+    uint16_t targetPort;
+    bool configured;                  // Has a target (unit counts towards htp1_unit_count)
+    bool wsConnected;
+    uint16_t connectFailures;         // Consecutive, reset on connect / new target
+    uint32_t heapCost;                // Free heap taken by the open connection
+    unsigned long lastConnectAttempt;
+    unsigned long lastHttpPoll;
+    unsigned long lastMsoRequest;
+
+    // --- Remote volume (button -> changemso) ---
+    // At most one volume command is in flight. Steps made meanwhile only
+    // move the target, so a long hold sends one command per echo (and no
+    // more than one per REMOTE_CMD_INTERVAL_MS) instead of one per repeat.
+    // The display shows the target until the echo of the last command.
+    bool volPending;                  // Target not yet confirmed by the HTP-1
+    int volTarget;
+    int volSent;
+    bool volInFlight;
+    unsigned long volSentMs;
+    unsigned long volSentUs;
+    unsigned long lastCmdMs;
+    int deviceVolume;                 // Last value the HTP-1 reported
+    uint16_t gestureSteps, gestureCmds;
+    uint32_t gestureRttMaxUs;
+
+    // --- Command slots (cmdMux) ---
+    uint8_t cmdPending;               // Bit per CmdSlot
+    bool cmdVolumeAbs;                // Absolute value set (else cmdVolume is a delta)
+    int cmdVolume;
+    int8_t cmdMute;                   // 1 = mute, 0 = unmute, -1 = toggle
+    char cmdInput[16];
+    bool cmdPower;
+    unsigned long lastApiCmdMs;
+};
+
+static HTP1Unit units[HTP1_MAX_UNITS];
+static uint8_t activeUnit = 0;
+static portMUX_TYPE cmdMux = portMUX_INITIALIZER_UNLOCKED;   // Command slots of every unit
+static unsigned long httpPollInterval = HTTP_POLL_INTERVAL_MS;
+
+// Unit 0 is the primary: it feeds the mso document mirror and the raw hooks
+#define IS_PRIMARY(u) ((u).index == 0)
+
+static HTP1Unit& unit_at(uint8_t unit) {
+    return units[unit < HTP1_MAX_UNITS ? unit : activeUnit];
+}
 
-void htp1_init(const char* ip, uint16_t port, int8_t volumeOffset) {
-    memset(&state, 0, sizeof(state));
-    state.powerIsOn = true;
-    state.volumeOffset = volumeOffset;
-    strlcpy(targetIP, ip, sizeof(targetIP));
-    targetPort = port;
+// --- Shared frame buffer ---
+// The loop reads one frame at a time, whichever unit it comes from, so
+// all units receive into one buffer. It keeps its capacity between frames
+// up to HTP1_FRAME_KEEP_BYTES; a larger frame (an mso dump) is released
+// once handled, so it does not pin its size.
+static String frameBuf;
+static size_t frameKept = 0;
+static size_t framePeak = 0;
+
+// Raw traffic observers: every upstream WebSocket frame / /ircmd payload
+struct RawHooks {
+    HTP1RawHook frame;
+    HTP1RawHook ircmd;
+};
+static RawHooks hooks[HTP1_MAX_HOOKS];
+static uint8_t hookCount = 0;
+
+// --- Field setters: a field is marked dirty only if its value changes ---
+template <typename T>
+static bool set_field(HTP1Unit &u, T &field, T value, HTP1Field f) {
+    if (field == value) return false;
+    field = value;
+    u.dirty |= HF_BIT(f);
+    return true;
 }
 
-void htp1_set_target(const char* ip, uint16_t port, int8_t volumeOffset) {
-    strlcpy(targetIP, ip, sizeof(targetIP));
-    targetPort = port;
-    state.volumeOffset = volumeOffset;
+// Point a text field at an interned value
+static bool set_text(HTP1Unit &u, StrId &field, JsonVariantConst value, HTP1Field f) {
+    StrId id = str_intern(value | "");
+    if (id == field) {
+        str_release(id);
+        return false;
+    }
+    str_release(field);
+    field = id;
+    u.dirty |= HF_BIT(f);
+    return true;
+}
+
+// --- Publish the working state as a new generation (seqlock write) ---
+static bool publish(HTP1Unit &u) {
+    if (!u.dirty) return false;
+    u.state.generation++;
+    for (uint8_t f = 0; f < HF_COUNT; f++) {
+        if (u.dirty & HF_BIT(f)) u.state.fieldGen[f] = u.state.generation;
+    }
+    u.dirty = 0;
+
+    u.pubSeq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&u.published, &u.state, sizeof(u.published));
+    std::atomic_thread_fence(std::memory_order_release);
+    u.pubSeq.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+static void set_target(HTP1Unit &u, const char* ip, uint16_t port) {
+    if (strcmp(ip, u.targetIP) != 0 || port != u.targetPort) {
+        if (IS_PRIMARY(u)) mso_clear();
+        u.connectFailures = 0;
+        if (u.wsConnected || u.tcp.connected()) {
+            u.tcp.stop();
+            u.wsConnected = false;
+        }
+    }
+    strlcpy(u.targetIP, ip, sizeof(u.targetIP));
+    u.targetPort = port;
+    if (ip[0]) u.configured = true;
 }
 
 // --- HTTP: fetch full state from /ircmd ---
-static bool fetch_state_http() {
-    if (strlen(targetIP) == 0) return false;
+static bool fetch_state_http(HTP1Unit &u) {
+    if (strlen(u.targetIP) == 0) return false;
 
     HTTPClient http;
     String url = "http://";
-    url += targetIP;
+    url += u.targetIP;
+    if (u.targetPort != HTP1_DEFAULT_PORT) {   // A stand-in (replay / mock) on one port
+        url += ':';
+        url += u.targetPort;
+    }
     url += "/ircmd";
 
+    unsigned long startUs = micros();
+    http.setConnectTimeout(HTP1_CONNECT_TIMEOUT_MS);
     http.setTimeout(2000);
     http.begin(url);
     int code = http.GET();
 
     if (code != 200) {
         http.end();
+        metrics_inc(MET_HTTP_RESYNC_ERRORS);
+        metrics_observe(MET_HTTP_RESYNCS, MET_HTTP_RESYNC_US, micros() - startUs);
         return false;
     }
 
     String payload = http.getString();
     http.end();
+    metrics_observe(MET_HTTP_RESYNCS, MET_HTTP_RESYNC_US, micros() - startUs);
+    if (IS_PRIMARY(u)) {
+        for (uint8_t i = 0; i < hookCount; i++) {
+            if (hooks[i].ircmd) hooks[i].ircmd(payload);
+        }
+    }
 
     JsonDocument doc;
     DeserializationError err = deserializeJson(doc, payload);
     if (err) {
-        Serial.printf("[HTP1] HTTP JSON error: %s\n", err.c_str());
+        Serial.printf("[%s] HTTP JSON error: %s\n", u.tag, err.c_str());
+        metrics_inc(MET_HTTP_RESYNC_ERRORS);
         return false;
     }
 
+    HTP1State &s = u.state;
     bool updated = false;
 
     if (doc["volume"].is<int>()) {
         int v = doc["volume"].as<int>();
-        if (v != state.volume) { state.volume = v; updated = true; }
+        if (u.volPending) u.deviceVolume = v;  // Keep showing the remote target
+        else updated |= set_field(u, s.volume, v, HF_VOLUME);
     }
     if (doc["muted"].is<bool>()) {
-        bool m = doc["muted"].as<bool>();
-        if (m != state.muted) { state.muted = m; updated = true; }
+        updated |= set_field(u, s.muted, doc["muted"].as<bool>(), HF_MUTED);
     }
     if (doc["input"].is<const char*>()) {
-        const char* inp = doc["input"] | "";
-        if (strcmp(inp, state.inputLabel) != 0) {
-            strlcpy(state.inputLabel, inp, sizeof(state.inputLabel));
-            updated = true;
-        }
+        updated |= set_text(u, s.inputLabel, doc["input"], HF_INPUT);
     }
 
     JsonObject status = doc["status"];
     if (status) {
-        if (status["DECSourceProgram"].is<const char*>()) {
-            const char* v = status["DECSourceProgram"] | "";
-            if (strcmp(v, state.codecName) != 0) {
-                strlcpy(state.codecName, v, sizeof(state.codecName));
-                updated = true;
-            }
-        }
-        if (status["DECProgramFormat"].is<const char*>()) {
-            const char* v = status["DECProgramFormat"] | "";
-            if (strcmp(v, state.programFormat) != 0) {
-                strlcpy(state.programFormat, v, sizeof(state.programFormat));
-                updated = true;
-            }
-        }
-        if (status["SurroundMode"].is<const char*>()) {
-            const char* v = status["SurroundMode"] | "";
-            if (strcmp(v, state.surroundMode) != 0) {
-                strlcpy(state.surroundMode, v, sizeof(state.surroundMode));
-                updated = true;
-            }
-        }
-        if (status["ENCListeningFormat"].is<const char*>()) {
-            const char* v = status["ENCListeningFormat"] | "";
-            if (strcmp(v, state.listeningFormat) != 0) {
-                strlcpy(state.listeningFormat, v, sizeof(state.listeningFormat));
-                updated = true;
-            }
-        }
+        if (status["DECSourceProgram"].is<const char*>())
+            updated |= set_text(u, s.codecName, status["DECSourceProgram"], HF_CODEC);
+        if (status["DECProgramFormat"].is<const char*>())
+            updated |= set_text(u, s.programFormat, status["DECProgramFormat"], HF_PROGRAM_FORMAT);
+        if (status["SurroundMode"].is<const char*>())
+            updated |= set_text(u, s.surroundMode, status["SurroundMode"], HF_SURROUND);
+        if (status["ENCListeningFormat"].is<const char*>())
+            updated |= set_text(u, s.listeningFormat, status["ENCListeningFormat"], HF_LISTEN_FMT);
     }
 
-    if (updated) state.changed = true;
     return updated;
 }
 
+// --- Remote volume: the HTP-1 reported a volume while a change is pending ---
+static void on_volume_echo(HTP1Unit &u, int v) {
+    u.deviceVolume = v;
+    if (!u.volInFlight || v != u.volSent) return;  // Echo of an older command
+
+    uint32_t rtt = micros() - u.volSentUs;
+    u.volInFlight = false;
+    metrics_observe(MET_REMOTE_ECHOES, MET_REMOTE_RTT_US, rtt);
+    if (rtt > u.gestureRttMaxUs) u.gestureRttMaxUs = rtt;
+
+    if (u.volTarget == u.volSent) {
+        u.volPending = false;
+        Serial.printf("[%s] Remote volume %d: %u steps in %u commands, max RTT %u ms\n",
+                      u.tag, v, u.gestureSteps, u.gestureCmds, u.gestureRttMaxUs / 1000);
+    }
+}
+
 // --- WebSocket: parse a single JSON patch object ---
-static bool parse_patch(JsonObject obj) {
+static bool parse_patch(HTP1Unit &u, JsonObject obj) {
     const char* path = obj["path"];
     if (!path) return false;
 
+    HTP1State &s = u.state;
     bool updated = false;
 
     if (strcmp(path, "/volume") == 0) {
-        state.volume = obj["value"].as<int>();
-        updated = true;
+        int v = obj["value"].as<int>();
+        if (u.volPending) on_volume_echo(u, v);
+        else updated = set_field(u, s.volume, v, HF_VOLUME);
     }
     else if (strcmp(path, "/muted") == 0) {
-        state.muted = obj["value"].as<bool>();
-        updated = true;
+        updated = set_field(u, s.muted, obj["value"].as<bool>(), HF_MUTED);
     }
     else if (strcmp(path, "/inputLabel") == 0) {
-        strlcpy(state.inputLabel, obj["value"] | "", sizeof(state.inputLabel));
-        updated = true;
+        updated = set_text(u, s.inputLabel, obj["value"], HF_INPUT);
     }
     else if (strcmp(path, "/status/DECSourceProgram") == 0) {
-        strlcpy(state.codecName, obj["value"] | "", sizeof(state.codecName));
-        updated = true;
+        updated = set_text(u, s.codecName, obj["value"], HF_CODEC);
     }
     else if (strcmp(path, "/status/DECProgramFormat") == 0) {
-        strlcpy(state.programFormat, obj["value"] | "", sizeof(state.programFormat));
-        updated = true;
+        updated = set_text(u, s.programFormat, obj["value"], HF_PROGRAM_FORMAT);
     }
     else if (strcmp(path, "/status/SurroundMode") == 0) {
-        strlcpy(state.surroundMode, obj["value"] | "", sizeof(state.surroundMode));
-        updated = true;
+        updated = set_text(u, s.surroundMode, obj["value"], HF_SURROUND);
     }
     else if (strcmp(path, "/status/ENCListeningFormat") == 0) {
-        strlcpy(state.listeningFormat, obj["value"] | "", sizeof(state.listeningFormat));
-        updated = true;
+        updated = set_text(u, s.listeningFormat, obj["value"], HF_LISTEN_FMT);
     }
     else if (strcmp(path, "/powerIsOn") == 0) {
-        state.powerIsOn = obj["value"].as<bool>();
-        updated = true;
+        updated = set_field(u, s.powerIsOn, obj["value"].as<bool>(), HF_POWER);
     }
 
     return updated;
 }
 
 // --- WebSocket: connect ---
-static bool ws_connect() {
-    wsConnected = false;
-    tcpClient.stop();
+static bool ws_connect(HTP1Unit &u) {
+    u.wsConnected = false;
+    u.tcp.stop();
+    u.heapCost = 0;
 
-    Serial.printf("[HTP1] WebSocket connecting to %s:%d...\n", targetIP, targetPort);
+    Serial.printf("[%s] WebSocket connecting to %s:%d...\n", u.tag, u.targetIP, u.targetPort);
 
-    if (!tcpClient.connect(targetIP, targetPort)) {
-        Serial.println("[HTP1] TCP connection failed");
+    uint32_t heapBefore = ESP.getFreeHeap();
+    if (!u.tcp.connect(u.targetIP, u.targetPort, HTP1_CONNECT_TIMEOUT_MS)) {
+        Serial.printf("[%s] TCP connection failed\n", u.tag);
+        u.connectFailures++;
         return false;
     }
 
-    wsClient.path = (char*)HTP1_WS_PATH;
-    wsClient.host = targetIP;
+    u.ws.path = (char*)HTP1_WS_PATH;
+    u.ws.host = u.targetIP;
 
-    if (!wsClient.handshake(tcpClient)) {
-        Serial.println("[HTP1] WebSocket handshake failed");
-        tcpClient.stop();
+    if (!u.ws.handshake(u.tcp)) {
+        Serial.printf("[%s] WebSocket handshake failed\n", u.tag);
+        u.tcp.stop();
+        u.connectFailures++;
         return false;
     }
 
-    Serial.println("[HTP1] WebSocket connected");
-    wsConnected = true;
-    lastConnectAttempt = millis();
+    uint32_t heapAfter = ESP.getFreeHeap();
+    u.heapCost = heapBefore > heapAfter ? heapBefore - heapAfter : 0;
+    Serial.printf("[%s] WebSocket connected (%u bytes heap)\n", u.tag, u.heapCost);
+    u.wsConnected = true;
+    u.connectFailures = 0;
+    u.lastConnectAttempt = millis();
+    u.lastHttpPoll = millis() - httpPollInterval;   // /ircmd was skipped while unreachable
+
+    // Full document for the state mirror (primary only — the others keep
+    // just HTP1State and never take a dump)
+    if (IS_PRIMARY(u)) {
+        u.ws.sendData("getmso");
+        u.lastMsoRequest = millis();
+    }
     return true;
 }
 
+// --- Shared frame buffer: release it after an oversized frame ---
+static void frame_release() {
+    frameBuf = String();
+    frameKept = 0;
+}
+
+static void frame_done() {
+    size_t len = frameBuf.length();
+    if (len > HTP1_FRAME_KEEP_BYTES) frame_release();
+    else if (len > frameKept) frameKept = len;
+}
+
+// --- Reconnect delay: doubles per consecutive failure, up to RECONNECT_MAX_MS ---
+// Every attempt blocks the loop for up to HTP1_CONNECT_TIMEOUT_MS, so a unit
+// that is powered off (zone 2) must not cost the primary unit a stall every
+// few seconds.
+static unsigned long reconnect_delay(const HTP1Unit &u) {
+    unsigned long ms = (unsigned long)RECONNECT_INTERVAL_MS << min<uint16_t>(u.connectFailures, 8);
+    return min(ms, (unsigned long)RECONNECT_MAX_MS);
+}
+
+// --- Unit answered its last connect attempt (or has not failed one yet) ---
+static bool reachable(const HTP1Unit &u) {
+    return u.wsConnected || u.connectFailures == 0;
+}
+
 // --- WebSocket: poll for data ---
-static bool ws_poll() {
-    if (!wsConnected || !tcpClient.connected()) {
-        wsConnected = false;
+static bool ws_poll(HTP1Unit &u) {
+    if (!u.wsConnected || !u.tcp.connected()) {
+        u.wsConnected = false;
 
-        // Throttled reconnect
-        if (millis() - lastConnectAttempt < RECONNECT_INTERVAL_MS) {
+        // Throttled reconnect, backing off while the unit stays unreachable
+        if (millis() - u.lastConnectAttempt < reconnect_delay(u)) {
             return false;
         }
-        lastConnectAttempt = millis();
-        ws_connect();
+        u.lastConnectAttempt = millis();
+        metrics_inc(MET_WS_RECONNECTS);
+        ws_connect(u);
         return false;
     }
 
-    String data;
-    wsClient.getData(data);
-    if (data.length() == 0) return false;
+    frameBuf = "";   // Keeps the capacity
+    u.ws.getData(frameBuf);
+    if (frameBuf.length() == 0) return false;
+    if (frameBuf.length() > framePeak) framePeak = frameBuf.length();
+    metrics_inc(MET_WS_FRAMES_RX);
+    if (IS_PRIMARY(u)) {
+        for (uint8_t i = 0; i < hookCount; i++) {
+            if (hooks[i].frame) hooks[i].frame(frameBuf);
+        }
+    }
+
+    unsigned long parseStartUs = micros();   // Hooks (proxy, recorder) not included
 
     // Strip prefix
-    if (data.startsWith("msoupdate ")) {
-        data = data.substring(10);
-    } else if (data.startsWith("mso ")) {
-        // Full state dump — skip, HTTP polling handles this
+    const char *json = frameBuf.c_str();
+    if (frameBuf.startsWith("msoupdate ")) {
+        json += 10;
+    } else if (frameBuf.startsWith("mso ")) {
+        // Full document — rebuilds the state mirror (HTTP polling refreshes HTP1State)
+        bool loaded = false;
+        if (IS_PRIMARY(u)) {
+            JsonDocument doc;
+            DeserializationError err = deserializeJson(doc, json + 4);
+            frame_release();   // Free the dump text before building
+            loaded = !err && mso_load(doc);
+        } else {
+            frame_done();
+        }
+        metrics_inc(loaded ? MET_WS_FRAMES_PARSED : MET_WS_FRAMES_DROPPED);
+        metrics_add(MET_WS_PARSE_US, micros() - parseStartUs);
         return false;
     }
 
     // Parse JSON patch array
     JsonDocument doc;
-    DeserializationError err = deserializeJson(doc, data);
-    if (err) return false;
+    DeserializationError err = deserializeJson(doc, json);
+    frame_done();
+    if (err) {
+        metrics_inc(MET_WS_FRAMES_DROPPED);
+        return false;
+    }
+    metrics_inc(MET_WS_FRAMES_PARSED);
 
     bool anyUpdate = false;
 
     if (doc.is<JsonArray>()) {
         for (JsonObject obj : doc.as<JsonArray>()) {
-            if (parse_patch(obj)) anyUpdate = true;
+            if (parse_patch(u, obj)) anyUpdate = true;
         }
     } else if (doc.is<JsonObject>()) {
-        if (parse_patch(doc.as<JsonObject>())) anyUpdate = true;
+        if (parse_patch(u, doc.as<JsonObject>())) anyUpdate = true;
     }
-
-    if (anyUpdate) state.changed = true;
+    if (IS_PRIMARY(u)) mso_apply(doc.as<JsonVariantConst>());
+    metrics_add(MET_WS_PARSE_US, micros() - parseStartUs);
     return anyUpdate;
 }
 
+// --- Send one replace op over the open WebSocket ---
+static void send_changemso(HTP1Unit &u, const char *path, const char *value) {
+    char cmd[96];
+    snprintf(cmd, sizeof(cmd), "changemso [{\"op\":\"replace\",\"path\":\"%s\",\"value\":%s}]", path, value);
+    u.ws.sendData(cmd);
+    metrics_inc(MET_REMOTE_COMMANDS);
+}
+
+// --- Remote volume: send the target when allowed, give up on lost echoes ---
+// Returns true if the displayed volume was reset to the HTP-1's value.
+static bool remote_service(HTP1Unit &u) {
+    if (!u.volPending) return false;
+
+    if (!u.wsConnected || (u.volInFlight && millis() - u.volSentMs >= REMOTE_ECHO_TIMEOUT_MS)) {
+        if (u.volInFlight) metrics_inc(MET_REMOTE_TIMEOUTS);
+        Serial.printf("[%s] Remote volume %d not confirmed, showing %d\n", u.tag, u.volTarget, u.deviceVolume);
+        u.volPending = false;
+        u.volInFlight = false;
+        return set_field(u, u.state.volume, u.deviceVolume, HF_VOLUME);
+    }
+    if (u.volInFlight) return false;
+    if (u.volTarget == u.volSent) {   // Stepped back to the confirmed value
+        u.volPending = false;
+        return false;
+    }
+    if (millis() - u.lastCmdMs < REMOTE_CMD_INTERVAL_MS) return false;
+
+    char value[8];
+    snprintf(value, sizeof(value), "%d", u.volTarget);
+    send_changemso(u, "/volume", value);
+    u.volSent = u.volTarget;
+    u.volInFlight = true;
+    u.volSentMs = u.lastCmdMs = millis();
+    u.volSentUs = micros();
+    u.gestureCmds++;
+    return false;
+}
+
+// --- Move the remote volume target (optimistic display, coalesced send) ---
+static void set_volume_target(HTP1Unit &u, int v) {
+    if (!u.volPending) {
+        u.volPending = true;
+        u.volTarget = u.volSent = u.deviceVolume = u.state.volume;
+        u.gestureSteps = u.gestureCmds = 0;
+        u.gestureRttMaxUs = 0;
+    }
+    u.volTarget = constrain(v, HTP1_VOLUME_MIN, HTP1_VOLUME_MAX);
+    u.gestureSteps++;
+    metrics_inc(MET_REMOTE_STEPS);
+
+    // Optimistic: show the target now, reconcile with the echo
+    set_field(u, u.state.volume, u.volTarget, HF_VOLUME);
+    remote_service(u);
+}
+
+static void set_muted(HTP1Unit &u, bool muted) {
+    send_changemso(u, "/muted", muted ? "true" : "false");
+    set_field(u, u.state.muted, muted, HF_MUTED);
+}
+
+static void mark_slot(HTP1Unit &u, CmdSlot slot) {
+    if (u.cmdPending & (1 << slot)) metrics_inc(MET_API_COALESCED);
+    u.cmdPending |= 1 << slot;
+    metrics_inc(MET_API_COMMANDS);
+}
+
+// --- Drain the REST command slots ---
+// Volume joins the remote-volume path (its own in-flight throttling); the
+// other commands go out at most one per API_CMD_INTERVAL_MS.
+// Returns true if the displayed state changed (volume / mute).
+static bool api_service(HTP1Unit &u) {
+    if (!u.cmdPending) return false;
+    if (!u.wsConnected) {
+        portENTER_CRITICAL(&cmdMux);
+        u.cmdPending = 0;
+        portEXIT_CRITICAL(&cmdMux);
+        return false;
+    }
+
+    portENTER_CRITICAL(&cmdMux);
+    bool volume = u.cmdPending & (1 << SLOT_VOLUME);
+    bool volAbs = u.cmdVolumeAbs;
+    int vol = u.cmdVolume;
+    u.cmdPending &= ~(1 << SLOT_VOLUME);
+    portEXIT_CRITICAL(&cmdMux);
+    if (volume) set_volume_target(u, volAbs ? vol : (u.volPending ? u.volTarget : u.state.volume) + vol);
+
+    if (millis() - u.lastApiCmdMs < API_CMD_INTERVAL_MS) return volume;
+
+    CmdSlot slot = SLOT_VOLUME;
+    int8_t mute = 0;
+    char input[sizeof(u.cmdInput)];
+    bool power = false;
+    portENTER_CRITICAL(&cmdMux);
+    if (u.cmdPending & (1 << SLOT_MUTE))       { slot = SLOT_MUTE;  mute = u.cmdMute; }
+    else if (u.cmdPending & (1 << SLOT_INPUT)) { slot = SLOT_INPUT; strlcpy(input, u.cmdInput, sizeof(input)); }
+    else if (u.cmdPending & (1 << SLOT_POWER)) { slot = SLOT_POWER; power = u.cmdPower; }
+    if (slot != SLOT_VOLUME) u.cmdPending &= ~(1 << slot);
+    portEXIT_CRITICAL(&cmdMux);
+    if (slot == SLOT_VOLUME) return volume;
+
+    u.lastApiCmdMs = millis();
+    if (slot == SLOT_MUTE) {
+        set_muted(u, mute < 0 ? !u.state.muted : mute);
+        return true;
+    } else if (slot == SLOT_INPUT) {
+        char value[sizeof(input) + 2];
+        snprintf(value, sizeof(value), "\"%s\"", input);
+        send_changemso(u, "/input", value);
+    } else {
+        send_changemso(u, "/powerIsOn", power ? "true" : "false");
+    }
+    return volume;
+}
+
+// --- One unit's share of htp1_poll() ---
+static bool poll_unit(HTP1Unit &u) {
+    if (strlen(u.targetIP) == 0) return false;
+
+    // WebSocket: real-time volume/mute updates
+    ws_poll(u);
+
+    // HTTP: periodic full state refresh (every 3s, slower in low-power sleep);
+    // skipped while the unit is unreachable — the reconnect probes it instead
+    if (reachable(u) && millis() - u.lastHttpPoll >= httpPollInterval) {
+        u.lastHttpPoll = millis();
+        fetch_state_http(u);
+    }
+
+    // State mirror missed a patch — ask for a fresh document
+    if (IS_PRIMARY(u) && u.wsConnected && mso_stale() &&
+        millis() - u.lastMsoRequest >= MSO_RESYNC_INTERVAL_MS) {
+        u.lastMsoRequest = millis();
+        Serial.printf("[%s] State mirror out of sync, requesting mso\n", u.tag);
+        u.ws.sendData("getmso");
+    }
+
+    // Remote volume / REST commands (coalesced)
+    api_service(u);
+    remote_service(u);
+
+    // Everything above only marked fields dirty; consumers see one generation
+    return publish(u);
+}
+
 // ============================================================
 // Public API
 // ============================================================
 
+void htp1_init(const char* ip, uint16_t port, int8_t volumeOffset) {
+    for (uint8_t i = 0; i < HTP1_MAX_UNITS; i++) {
+        HTP1Unit &u = units[i];
+        u.index = i;
+        if (i == 0) strlcpy(u.tag, "HTP1", sizeof(u.tag));
+        else snprintf(u.tag, sizeof(u.tag), "HTP1#%u", i + 1);
+        memset(&u.state, 0, sizeof(u.state));
+        u.state.powerIsOn = true;
+        u.state.volumeOffset = volumeOffset;
+        u.targetIP[0] = '\0';
+        u.configured = false;
+        u.dirty = HF_ALL;   // Generation 1: everything is new to every consumer
+        publish(u);
+    }
+    mso_init();
+    set_target(units[0], ip, port);
+    frameBuf.reserve(HTP1_FRAME_RESERVE);
+    frameKept = HTP1_FRAME_RESERVE;
+}
+
+void htp1_set_target(const char* ip, uint16_t port, int8_t volumeOffset, uint8_t unit) {
+    if (unit >= HTP1_MAX_UNITS) return;
+    HTP1Unit &u = units[unit];
+    set_target(u, ip, port);
+    set_field(u, u.state.volumeOffset, volumeOffset, HF_VOLUME_OFFSET);
+    publish(u);
+}
+
+void htp1_clear_target(uint8_t unit) {
+    if (unit == 0 || unit >= HTP1_MAX_UNITS) return;
+    HTP1Unit &u = units[unit];
+    set_target(u, "", u.targetPort);
+    u.configured = false;
+    if (activeUnit == unit) activeUnit = 0;
+}
+
 bool htp1_connect() {
-    if (strlen(targetIP) == 0) return false;
+    bool any = false;
+    for (HTP1Unit &u : units) {
+        if (strlen(u.targetIP) == 0) continue;
 
-    // Fetch full state via HTTP first
-    Serial.printf("[HTP1] Fetching state from %s\n", targetIP);
-    fetch_state_http();
-    lastHttpPoll = millis();
+        // Fetch full state via HTTP first
+        Serial.printf("[%s] Fetching state from %s\n", u.tag, u.targetIP);
+        fetch_state_http(u);
 
-    // Then open WebSocket for real-time updates
-    return ws_connect();
+        // Then open WebSocket for real-time updates
+        any |= ws_connect(u);
+        u.lastHttpPoll = millis();
+    }
+    return any;
 }
 
-bool htp1_poll() {
-    if (strlen(targetIP) == 0) return false;
+uint8_t htp1_poll() {
+    uint8_t changed = 0;
+    for (HTP1Unit &u : units) {
+        if (poll_unit(u)) changed |= 1 << u.index;
+    }
+    return changed;
+}
 
-    // WebSocket: real-time volume/mute updates
-    bool wsUpdate = ws_poll();
+uint8_t htp1_unit_count() {
+    uint8_t n = 0;
+    for (const HTP1Unit &u : units) {
+        if (u.configured) n = u.index + 1;
+    }
+    return n;
+}
+
+void htp1_set_active(uint8_t unit) {
+    if (unit < HTP1_MAX_UNITS && (unit == 0 || units[unit].configured)) activeUnit = unit;
+}
 
-    // HTTP: periodic full state refresh (every 3s)
-    bool httpUpdate = false;
-    if (millis() - lastHttpPoll >= 3000) {
-        lastHttpPoll = millis();
-        httpUpdate = fetch_state_http();
+uint8_t htp1_active() {
+    return activeUnit;
+}
+
+const HTP1State& htp1_get_state(uint8_t unit) {
+    return unit_at(unit).published;
+}
+
+void htp1_snapshot(HTP1State &out, uint8_t unit) {
+    HTP1Unit &u = unit_at(unit);
+    for (;;) {
+        uint32_t seq = u.pubSeq.load(std::memory_order_acquire);
+        if (seq & 1) {
+            // The loop is mid-publish; let it finish (it may be on this core)
+            vTaskDelay(1);
+            continue;
+        }
+        memcpy(&out, &u.published, sizeof(out));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (u.pubSeq.load(std::memory_order_relaxed) == seq) return;
     }
+}
+
+uint16_t htp1_consume(HTP1State &out, uint32_t &cursor, uint8_t unit) {
+    htp1_snapshot(out, unit);
+    uint16_t mask = htp1_changed_since(out, cursor);
+    cursor = out.generation;
+    return mask;
+}
 
-    return wsUpdate || httpUpdate;
+bool htp1_volume_step(int delta, uint8_t unit) {
+    if (!htp1_connected(unit)) return false;
+    HTP1Unit &u = unit_at(unit);
+    set_volume_target(u, (u.volPending ? u.volTarget : u.state.volume) + delta);
+    publish(u);
+    return true;
+}
+
+bool htp1_toggle_mute(uint8_t unit) {
+    if (!htp1_connected(unit)) return false;
+    HTP1Unit &u = unit_at(unit);
+    set_muted(u, !u.state.muted);
+    publish(u);
+    return true;
+}
+
+// --- REST API (web server task): queue, the loop sends ---
+
+bool htp1_queue_volume(int value, bool relative, uint8_t unit) {
+    HTP1Unit &u = unit_at(unit);
+    if (!u.wsConnected) return false;
+    portENTER_CRITICAL(&cmdMux);
+    // A step on top of an unsent step adds up; anything else replaces
+    if (relative && (u.cmdPending & (1 << SLOT_VOLUME)) && !u.cmdVolumeAbs) u.cmdVolume += value;
+    else u.cmdVolume = value;
+    u.cmdVolumeAbs = !relative;
+    mark_slot(u, SLOT_VOLUME);
+    portEXIT_CRITICAL(&cmdMux);
+    return true;
+}
+
+bool htp1_queue_mute(int8_t mute, uint8_t unit) {
+    HTP1Unit &u = unit_at(unit);
+    if (!u.wsConnected) return false;
+    portENTER_CRITICAL(&cmdMux);
+    u.cmdMute = mute;
+    mark_slot(u, SLOT_MUTE);
+    portEXIT_CRITICAL(&cmdMux);
+    return true;
+}
+
+bool htp1_queue_input(const char *id, uint8_t unit) {
+    HTP1Unit &u = unit_at(unit);
+    if (!u.wsConnected) return false;
+    portENTER_CRITICAL(&cmdMux);
+    strlcpy(u.cmdInput, id, sizeof(u.cmdInput));
+    mark_slot(u, SLOT_INPUT);
+    portEXIT_CRITICAL(&cmdMux);
+    return true;
+}
+
+bool htp1_queue_power(bool on, uint8_t unit) {
+    HTP1Unit &u = unit_at(unit);
+    if (!u.wsConnected) return false;
+    portENTER_CRITICAL(&cmdMux);
+    u.cmdPower = on;
+    mark_slot(u, SLOT_POWER);
+    portEXIT_CRITICAL(&cmdMux);
+    return true;
+}
+
+bool htp1_add_hooks(HTP1RawHook onFrame, HTP1RawHook onIrcmd) {
+    if (hookCount >= HTP1_MAX_HOOKS) return false;
+    hooks[hookCount++] = { onFrame, onIrcmd };
+    return true;
+}
+
+bool htp1_send_raw(const char *msg) {
+    if (!htp1_connected(0)) return false;
+    units[0].ws.sendData(msg);
+    return true;
+}
+
+bool htp1_connected(uint8_t unit) {
+    HTP1Unit &u = unit_at(unit);
+    return u.wsConnected && u.tcp.connected();
+}
+
+const char* htp1_target(uint8_t unit) {
+    return unit_at(unit).targetIP;
 }
 
-const HTP1State& htp1_get_state() {
-    return state;
+uint16_t htp1_connect_failures(uint8_t unit) {
+    return unit_at(unit).connectFailures;
 }
 
-void htp1_clear_changed() {
-    state.changed = false;
+void htp1_set_low_power(bool enabled) {
+    httpPollInterval = enabled ? HTTP_POLL_SLEEP_MS : HTTP_POLL_INTERVAL_MS;
 }
 
-bool htp1_connected() {
-    return wsConnected && tcpClient.connected();
+void htp1_wait_for_data(uint32_t timeoutMs) {
+    // One select() over every open connection
+    fd_set rfds;
+    FD_ZERO(&rfds);
+    int maxFd = -1;
+    for (HTP1Unit &u : units) {
+        if (!u.wsConnected || !u.tcp.connected()) continue;
+        if (u.tcp.available()) return;  // Already buffered
+        int fd = u.tcp.fd();
+        FD_SET(fd, &rfds);
+        if (fd > maxFd) maxFd = fd;
+    }
+    if (maxFd < 0) {
+        delay(timeoutMs);
+        return;
+    }
+
+    struct timeval tv;
+    tv.tv_sec  = timeoutMs / 1000;
+    tv.tv_usec = (timeoutMs % 1000) * 1000;
+    select(maxFd + 1, &rfds, nullptr, nullptr, &tv);
+}
+
+void htp1_report_metrics(Print &out) {
+    out.printf("# HELP htp1_units HTP-1 processors configured\n"
+               "# TYPE htp1_units gauge\n"
+               "htp1_units %u\n", htp1_unit_count());
+    out.printf("# HELP htp1_unit_connected WebSocket connected, per processor\n"
+               "# TYPE htp1_unit_connected gauge\n");
+    for (HTP1Unit &u : units) {
+        if (u.configured) out.printf("htp1_unit_connected{unit=\"%u\"} %d\n", u.index + 1, htp1_connected(u.index));
+    }
+    out.printf("# HELP htp1_unit_connect_failures Consecutive failed connects, per processor\n"
+               "# TYPE htp1_unit_connect_failures gauge\n");
+    for (const HTP1Unit &u : units) {
+        if (u.configured) out.printf("htp1_unit_connect_failures{unit=\"%u\"} %u\n", u.index + 1, u.connectFailures);
+    }
+    out.printf("# HELP htp1_unit_heap_bytes Free heap taken by each open connection (socket + handshake)\n"
+               "# TYPE htp1_unit_heap_bytes gauge\n");
+    for (const HTP1Unit &u : units) {
+        if (u.configured) out.printf("htp1_unit_heap_bytes{unit=\"%u\"} %u\n", u.index + 1, u.heapCost);
+    }
+    out.printf("# HELP htp1_unit_bytes Static memory per processor slot (connection, state, command slots)\n"
+               "# TYPE htp1_unit_bytes gauge\n"
+               "htp1_unit_bytes %u\n", (unsigned)sizeof(HTP1Unit));
+    out.printf("# HELP htp1_frame_buffer_bytes Shared WebSocket receive buffer: kept capacity / largest frame\n"
+               "# TYPE htp1_frame_buffer_bytes gauge\n"
+               "htp1_frame_buffer_bytes{state=\"kept\"} %u\n"
+               "htp1_frame_buffer_bytes{state=\"peak\"} %u\n", (unsigned)frameKept, (unsigned)framePeak);
 }
@@ -1,43 +1,138 @@
 #pragma once
 
 #include <Arduino.h>
+#include "str_table.h"
+
+// --- Field bits (dirty masks) ---
+enum HTP1Field : uint8_t {
+    HF_VOLUME = 0,
+    HF_VOLUME_OFFSET,
+    HF_MUTED,
+    HF_INPUT,
+    HF_CODEC,
+    HF_PROGRAM_FORMAT,
+    HF_SURROUND,
+    HF_LISTEN_FMT,
+    HF_POWER,
+    HF_COUNT
+};
+#define HF_BIT(f)  ((uint16_t)1 << (f))
+#define HF_ALL     ((uint16_t)(HF_BIT(HF_COUNT) - 1))
 
 // --- HTP-1 State ---
+// Text fields are interned ids (str_get() for the text): equal ids mean
+// equal text.
 struct HTP1State {
     int   volume;
     int8_t volumeOffset;
     bool  muted;
     int   inputId;
-    char  inputLabel[32];
-    char  codecName[32];
-    char  programFormat[32];
-    char  surroundMode[32];
-    char  listeningFormat[32];
+    StrId inputLabel;
+    StrId codecName;
+    StrId programFormat;
+    StrId surroundMode;
+    StrId listeningFormat;
     bool  powerIsOn;
 
-    // Change flags — set true when a field updates, cleared by consumer
-    bool changed;
+    // Change tracking: `generation` counts published updates, and
+    // fieldGen[f] is the generation in which field f last changed value
+    uint32_t generation;
+    uint32_t fieldGen[HF_COUNT];
 };
 
-// Initialize HTP-1 client (call once in setup)
+// Fields of `s` that changed after generation `since` (HF_BIT mask)
+inline uint16_t htp1_changed_since(const HTP1State &s, uint32_t since) {
+    uint16_t mask = 0;
+    for (uint8_t f = 0; f < HF_COUNT; f++) {
+        if ((int32_t)(s.fieldGen[f] - since) > 0) mask |= HF_BIT(f);
+    }
+    return mask;
+}
+
+// --- Units ---
+// Up to HTP1_MAX_UNITS processors are followed at once (e.g. a theatre and
+// a second zone), each with its own connection, HTP1State and command
+// slots, all polled from the loop. Unit 0 is the primary: the full mso
+// document mirror (mso_mirror.h), the raw hooks and htp1_send_raw() are
+// for it alone, so an extra unit costs a fixed slot plus its socket.
+// `unit` arguments default to HTP1_ACTIVE, the unit shown and controlled.
+#define HTP1_ACTIVE 0xFF
+
+// Initialize HTP-1 client (call once in setup); sets unit 0's target
 void htp1_init(const char* ip, uint16_t port, int8_t volumeOffset);
 
-// Update connection target (e.g. after settings change)
-void htp1_set_target(const char* ip, uint16_t port, int8_t volumeOffset);
+// Update a unit's connection target (e.g. after settings change)
+void htp1_set_target(const char* ip, uint16_t port, int8_t volumeOffset, uint8_t unit = 0);
 
-// Attempt connection / reconnection to HTP-1
-// Returns true if connected
+// Disconnect and unconfigure an extra unit (unit >= 1)
+void htp1_clear_target(uint8_t unit);
+
+// Configured units: highest unit with a target, plus one
+uint8_t htp1_unit_count();
+
+// Unit that HTP1_ACTIVE stands for (shown, controlled by buttons / API)
+void htp1_set_active(uint8_t unit);
+uint8_t htp1_active();
+
+// Attempt connection to every unit with a target
+// Returns true if any connected
 bool htp1_connect();
 
-// Poll for new data. Call from loop().
-// Returns true if new data was received & parsed.
-bool htp1_poll();
+// Poll every unit for new data. Call from loop().
+// Returns a bit per unit that changed a field (published a new generation).
+uint8_t htp1_poll();
+
+// Latest published state, by reference — loop only (the loop publishes).
+// Each unit's state lives at a fixed address.
+const HTP1State& htp1_get_state(uint8_t unit = HTP1_ACTIVE);
+
+// Copy of the latest published state — safe from any task (seqlock read;
+// retries while the loop is publishing)
+void htp1_snapshot(HTP1State &out, uint8_t unit = HTP1_ACTIVE);
+
+// Snapshot plus the fields changed since `cursor`, which is advanced to
+// the snapshot's generation. Each consumer keeps its own cursor (per unit).
+uint16_t htp1_consume(HTP1State &out, uint32_t &cursor, uint8_t unit = HTP1_ACTIVE);
+
+// Remote control over the open WebSocket (changemso). Both update the
+// state optimistically; the HTP-1's msoupdate echo reconciles it.
+// Volume steps are coalesced into at most one command in flight.
+// Return false if not connected.
+bool htp1_volume_step(int delta, uint8_t unit = HTP1_ACTIVE);
+bool htp1_toggle_mute(uint8_t unit = HTP1_ACTIVE);
+
+// REST API commands — safe to call from the web server task. Queued in one
+// slot per kind (a newer request replaces an unsent one) and sent by
+// htp1_poll(); volume goes through the same coalescing as the buttons,
+// the others at most one per API_CMD_INTERVAL_MS. Return false if the
+// WebSocket is down.
+bool htp1_queue_volume(int value, bool relative, uint8_t unit = HTP1_ACTIVE);  // Raw dB, or a step
+bool htp1_queue_mute(int8_t mute, uint8_t unit = HTP1_ACTIVE);                 // 1 / 0, -1 = toggle
+bool htp1_queue_input(const char *id, uint8_t unit = HTP1_ACTIVE);             // Input code, e.g. "h1"
+bool htp1_queue_power(bool on, uint8_t unit = HTP1_ACTIVE);
+
+// Raw traffic (proxy mode, recorder) of unit 0: observe upstream traffic (loop
+// context) and send raw messages upstream. Hooks see every WebSocket frame
+// (mso dumps included) and every /ircmd payload before they are parsed.
+// Up to HTP1_MAX_HOOKS observers; returns false when full.
+typedef void (*HTP1RawHook)(const String &data);
+bool htp1_add_hooks(HTP1RawHook onFrame, HTP1RawHook onIrcmd);
+bool htp1_send_raw(const char *msg);
+
+// Is the unit's WebSocket currently connected?
+bool htp1_connected(uint8_t unit = HTP1_ACTIVE);
+
+// Address a unit connects to, and its consecutive connect failures
+// (TCP or handshake; reset on success and when the target changes)
+const char* htp1_target(uint8_t unit = 0);
+uint16_t htp1_connect_failures(uint8_t unit = 0);
 
-// Get current state (read-only reference)
-const HTP1State& htp1_get_state();
+// Low-power mode: slows the HTTP /ircmd refresh while the display sleeps
+void htp1_set_low_power(bool enabled);
 
-// Clear the change flag
-void htp1_clear_changed();
+// Block until WebSocket data is readable on any unit or timeoutMs elapses.
+// Used to idle the main loop so the CPU can light-sleep between packets.
+void htp1_wait_for_data(uint32_t timeoutMs);
 
-// Is the WebSocket currently connected?
-bool htp1_connected();
+// Per-unit connection and memory gauges in Prometheus text format
+void htp1_report_metrics(Print &out);
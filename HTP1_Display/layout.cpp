@@ -0,0 +1,284 @@
+#include "layout.h"
+#include "metrics.h"
+#include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <array>
+#include <utility>
+
+// ============================================================
+// Built-in layouts
+// ============================================================
+// Fields: field, font, size rule, fixed size, h-anchor, margin,
+//         v-anchor, offset, colour, shrink width
+
+// STANDBY indicator, shared by every mode
+#define SLOT_STANDBY \
+    { FIELD_POWER, 4, SIZE_FIXED, 1, H_CENTER, 0, V_BOTTOM, 5, COLOR_ALERT, 0 }
+
+static constexpr LayoutSlot LAYOUT_VOLUME_ONLY[] = {
+    { FIELD_VOLUME, 7, SIZE_VOLUME, 0, H_CENTER, 0, V_CENTER, 0, COLOR_FG, 0 },
+    SLOT_STANDBY,
+};
+
+static constexpr LayoutSlot LAYOUT_VOLUME_SOURCE[] = {
+    { FIELD_INPUT,  4, SIZE_LABEL,  0, H_LEFT,   10, V_TOP,         0, COLOR_DIM, 0 },
+    { FIELD_VOLUME, 7, SIZE_VOLUME, 0, H_CENTER, 0,  V_BELOW_LABEL, 4, COLOR_FG,  0 },
+    SLOT_STANDBY,
+};
+
+static constexpr LayoutSlot LAYOUT_VOLUME_CODEC[] = {
+    { FIELD_VOLUME, 7, SIZE_VOLUME, 0, H_CENTER, 0, V_TOP,    0, COLOR_FG,  0 },
+    { FIELD_CODEC,  4, SIZE_LABEL,  0, H_CENTER, 0, V_BOTTOM, 2, COLOR_DIM, DISPLAY_WIDTH - 20 },
+    SLOT_STANDBY,
+};
+
+static constexpr LayoutSlot LAYOUT_FULL_STATUS[] = {
+    { FIELD_INPUT,      4, SIZE_LABEL,  0, H_LEFT,   10, V_TOP,            0, COLOR_DIM, 0 },
+    { FIELD_CODEC,      4, SIZE_LABEL,  0, H_RIGHT,  10, V_TOP,            0, COLOR_DIM, DISPLAY_WIDTH / 2 },
+    { FIELD_VOLUME,     7, SIZE_VOLUME, 0, H_CENTER, 0,  V_BETWEEN_LABELS, 2, COLOR_FG,  0 },
+    { FIELD_SURROUND,   4, SIZE_LABEL,  0, H_LEFT,   10, V_BOTTOM_ROW,     0, COLOR_DIM, 0 },
+    { FIELD_LISTEN_FMT, 4, SIZE_LABEL,  0, H_RIGHT,  10, V_BOTTOM_ROW,     0, COLOR_DIM, 0 },
+    SLOT_STANDBY,
+};
+
+struct BuiltinLayout {
+    const LayoutSlot *slots;
+    uint8_t count;
+};
+
+#define LAYOUT_ENTRY(a) { a, sizeof(a) / sizeof(a[0]) }
+
+// Indexed by DisplayMode (MODE_CUSTOM is resolved at runtime)
+static constexpr BuiltinLayout BUILTIN_LAYOUTS[MODE_CUSTOM] = {
+    LAYOUT_ENTRY(LAYOUT_VOLUME_ONLY),
+    LAYOUT_ENTRY(LAYOUT_VOLUME_SOURCE),
+    LAYOUT_ENTRY(LAYOUT_VOLUME_CODEC),
+    LAYOUT_ENTRY(LAYOUT_FULL_STATUS),
+};
+
+// ============================================================
+// Compile-time draw list table: every mode x vol size x label size
+// ============================================================
+
+#define SIZE_COMBOS (LAYOUT_VOL_SIZES * LAYOUT_LABEL_SIZES)
+
+static constexpr DrawList resolve_builtin(size_t i) {
+    return layout_resolve_slots(BUILTIN_LAYOUTS[i / SIZE_COMBOS].slots,
+                                BUILTIN_LAYOUTS[i / SIZE_COMBOS].count,
+                                (i / LAYOUT_LABEL_SIZES) % LAYOUT_VOL_SIZES + 1,
+                                i % LAYOUT_LABEL_SIZES + 1);
+}
+
+template <size_t... I>
+static constexpr std::array<DrawList, sizeof...(I)> make_builtin_table(std::index_sequence<I...>) {
+    return {{ resolve_builtin(I)... }};
+}
+
+static constexpr auto BUILTIN_DRAW_LISTS =
+    make_builtin_table(std::make_index_sequence<MODE_CUSTOM * SIZE_COMBOS>{});
+
+// Sanity checks — evaluated by the compiler
+static_assert(BUILTIN_DRAW_LISTS[4 * LAYOUT_LABEL_SIZES].ops[0].y == 0,
+              "Volume Only, size 5: full-height digits start at the top");
+static_assert(BUILTIN_DRAW_LISTS[MODE_VOLUME_CODEC * SIZE_COMBOS].ops[1].datum == 7,
+              "Volume + Codec: codec line is bottom-centre anchored");
+
+// ============================================================
+// Custom layout
+// ============================================================
+// Blob: [version][count] then LAYOUT_RECORD_SIZE bytes per slot:
+//   field, font, size rule, fixed size, h-anchor, v-anchor, colour, 0,
+//   margin (int16 LE), offset (int16 LE), shrink width (int16 LE)
+
+static const char* NS = "htp1disp";
+static const char* KEY_LAYOUT = "layout";
+
+static portMUX_TYPE customMux = portMUX_INITIALIZER_UNLOCKED;
+static LayoutSlot customSlots[LAYOUT_MAX_OPS];
+static uint8_t customCount = 0;
+
+static void put16(uint8_t *p, int16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static int16_t get16(const uint8_t *p) {
+    return (int16_t)(p[0] | (p[1] << 8));
+}
+
+static size_t encode(const LayoutSlot *slots, uint8_t n, uint8_t *buf) {
+    buf[0] = LAYOUT_BLOB_VERSION;
+    buf[1] = n;
+    uint8_t *p = buf + 2;
+    for (uint8_t i = 0; i < n; i++, p += LAYOUT_RECORD_SIZE) {
+        const LayoutSlot &s = slots[i];
+        p[0] = s.field;
+        p[1] = s.font;
+        p[2] = s.size;
+        p[3] = s.fixedSize;
+        p[4] = s.h;
+        p[5] = s.v;
+        p[6] = s.color;
+        p[7] = 0;
+        put16(p + 8,  s.margin);
+        put16(p + 10, s.offset);
+        put16(p + 12, s.maxWidth);
+    }
+    return p - buf;
+}
+
+static uint8_t decode(const uint8_t *buf, size_t len, LayoutSlot *out) {
+    if (len < 2 || buf[0] != LAYOUT_BLOB_VERSION) return 0;
+    uint8_t n = buf[1];
+    if (n > LAYOUT_MAX_OPS || len != 2 + (size_t)n * LAYOUT_RECORD_SIZE) return 0;
+    const uint8_t *p = buf + 2;
+    for (uint8_t i = 0; i < n; i++, p += LAYOUT_RECORD_SIZE) {
+        LayoutSlot &s = out[i];
+        s.field     = (LayoutField)p[0];
+        s.font      = p[1];
+        s.size      = (SizeRule)p[2];
+        s.fixedSize = p[3];
+        s.h         = (HAnchor)p[4];
+        s.v         = (VAnchor)p[5];
+        s.color     = (ColorRole)p[6];
+        s.margin    = get16(p + 8);
+        s.offset    = get16(p + 10);
+        s.maxWidth  = get16(p + 12);
+    }
+    return n;
+}
+
+static void use_default_custom() {
+    const BuiltinLayout &def = BUILTIN_LAYOUTS[MODE_FULL_STATUS];
+    portENTER_CRITICAL(&customMux);
+    memcpy(customSlots, def.slots, def.count * sizeof(LayoutSlot));
+    customCount = def.count;
+    portEXIT_CRITICAL(&customMux);
+}
+
+static bool font_loaded(uint8_t font) {
+    return font == 1 || font == 2 || font == 4 || font == 6 || font == 7 || font == 8;
+}
+
+bool layout_validate(const LayoutSlot *slots, uint8_t n, char *err, size_t errLen) {
+    if (n == 0 || n > LAYOUT_MAX_OPS) {
+        snprintf(err, errLen, "need 1-%d fields", LAYOUT_MAX_OPS);
+        return false;
+    }
+    int volumes = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        const LayoutSlot &s = slots[i];
+        const char *bad = nullptr;
+        if (s.field >= FIELD_COUNT)                          bad = "field";
+        else if (!font_loaded(s.font))                       bad = "font";
+        else if (s.size > SIZE_FIXED)                        bad = "size rule";
+        else if (s.size == SIZE_FIXED &&
+                 (s.fixedSize < 1 || s.fixedSize > 7))       bad = "size";
+        else if (s.h > H_RIGHT)                              bad = "h anchor";
+        else if (s.v > V_BOTTOM)                             bad = "v anchor";
+        else if (s.color >= COLOR_ROLE_COUNT)                bad = "colour";
+        else if (abs(s.margin) > DISPLAY_WIDTH)              bad = "x";
+        else if (abs(s.offset) > DISPLAY_HEIGHT)             bad = "y";
+        else if (s.maxWidth < 0 || s.maxWidth > DISPLAY_WIDTH) bad = "shrink width";
+        if (bad) {
+            snprintf(err, errLen, "slot %u: bad %s", i, bad);
+            return false;
+        }
+        if (s.field == FIELD_VOLUME) volumes++;
+    }
+    if (volumes > 1) {
+        snprintf(err, errLen, "at most one volume field");
+        return false;
+    }
+    return true;
+}
+
+void layout_custom_load() {
+    LayoutSlot slots[LAYOUT_MAX_OPS];
+    uint8_t buf[2 + LAYOUT_MAX_OPS * LAYOUT_RECORD_SIZE];
+    uint8_t n = 0;
+    char err[48];
+
+    Preferences prefs;
+    prefs.begin(NS, true);
+    size_t len = prefs.isKey(KEY_LAYOUT) ? prefs.getBytes(KEY_LAYOUT, buf, sizeof(buf)) : 0;
+    prefs.end();
+
+    if (len > 0) {
+        n = decode(buf, len, slots);
+        if (n == 0 || !layout_validate(slots, n, err, sizeof(err))) {
+            Serial.println("[LAYOUT] Stored custom layout invalid — using default");
+            n = 0;
+        }
+    }
+    if (n == 0) {
+        use_default_custom();
+        return;
+    }
+
+    portENTER_CRITICAL(&customMux);
+    memcpy(customSlots, slots, n * sizeof(LayoutSlot));
+    customCount = n;
+    portEXIT_CRITICAL(&customMux);
+    Serial.printf("[LAYOUT] Custom layout loaded: %u fields\n", n);
+}
+
+bool layout_custom_set(const LayoutSlot *slots, uint8_t n, char *err, size_t errLen) {
+    if (!layout_validate(slots, n, err, errLen)) return false;
+
+    uint8_t buf[2 + LAYOUT_MAX_OPS * LAYOUT_RECORD_SIZE];
+    size_t len = encode(slots, n, buf);
+
+    metrics_inc(MET_NVS_WRITES);
+    Preferences prefs;
+    prefs.begin(NS, false);
+    bool ok = prefs.putBytes(KEY_LAYOUT, buf, len) == len;
+    prefs.end();
+    if (!ok) {
+        snprintf(err, errLen, "NVS write failed");
+        return false;
+    }
+
+    portENTER_CRITICAL(&customMux);
+    memcpy(customSlots, slots, n * sizeof(LayoutSlot));
+    customCount = n;
+    portEXIT_CRITICAL(&customMux);
+    Serial.printf("[LAYOUT] Custom layout saved: %u fields, %u bytes\n", n, (unsigned)len);
+    return true;
+}
+
+uint8_t layout_custom_get(LayoutSlot *out) {
+    portENTER_CRITICAL(&customMux);
+    uint8_t n = customCount;
+    memcpy(out, customSlots, n * sizeof(LayoutSlot));
+    portEXIT_CRITICAL(&customMux);
+    return n;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+const DrawList& layout_builtin(DisplayMode mode, uint8_t volSize, uint8_t labelSize) {
+    if (mode >= MODE_CUSTOM) mode = MODE_VOLUME_ONLY;
+    volSize   = constrain(volSize, 1, LAYOUT_VOL_SIZES);
+    labelSize = constrain(labelSize, 1, LAYOUT_LABEL_SIZES);
+    return BUILTIN_DRAW_LISTS[mode * SIZE_COMBOS +
+                              (volSize - 1) * LAYOUT_LABEL_SIZES + (labelSize - 1)];
+}
+
+void layout_resolve(const AppSettings &settings, DrawList &out) {
+    DisplayMode mode = settings.display_mode;
+    if (mode >= MODE_COUNT) mode = MODE_VOLUME_ONLY;
+
+    if (mode == MODE_CUSTOM) {
+        // Same resolver as the built-in table, run once per settings change
+        LayoutSlot slots[LAYOUT_MAX_OPS];
+        uint8_t n = layout_custom_get(slots);
+        out = layout_resolve_slots(slots, n,
+                                   constrain(settings.vol_sizes[mode], 1, LAYOUT_VOL_SIZES),
+                                   constrain(settings.label_sizes[mode], 1, LAYOUT_LABEL_SIZES));
+        return;
+    }
+    out = layout_builtin(mode, settings.vol_sizes[mode], settings.label_sizes[mode]);
+}
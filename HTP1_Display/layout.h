@@ -0,0 +1,177 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "settings.h"
+
+// ============================================================
+// Declarative display layouts
+//
+// A layout is a list of slots: which field to draw, which font and size
+// rule, and how it is anchored. Resolving a layout for a given volume /
+// label size yields a draw list of absolute positions. Built-in modes are
+// resolved at compile time for every size combination (see layout.cpp);
+// the renderer just walks the precomputed draw list.
+//
+// MODE_CUSTOM uses a user-defined slot list uploaded from the web UI. It
+// is validated on upload, stored as a compact NVS blob, and resolved to a
+// draw list once per settings change — rendering it costs the same.
+// ============================================================
+
+#define LAYOUT_MAX_OPS    8
+#define LAYOUT_VOL_PX     48   // Font 7 height per textSize unit
+#define LAYOUT_LABEL_PX   26   // Font 4 height per textSize unit
+#define LAYOUT_VOL_SIZES  5    // vol_sizes range 1..5
+#define LAYOUT_LABEL_SIZES 3   // label_sizes range 1..3
+
+// What a slot shows
+enum LayoutField : uint8_t {
+    FIELD_VOLUME = 0,   // Volume digits (or MUTE)
+    FIELD_INPUT,        // Input label (friendly name if mapped)
+    FIELD_CODEC,        // Codec + program format, abbreviated
+    FIELD_SURROUND,     // Surround mode
+    FIELD_LISTEN_FMT,   // Listening format
+    FIELD_POWER,        // STANDBY indicator (drawn only when powered off)
+    FIELD_COUNT
+};
+
+// Colour roles — mapped to the theme at draw time
+enum ColorRole : uint8_t {
+    COLOR_FG = 0,       // Theme colour
+    COLOR_DIM,          // Theme secondary colour
+    COLOR_ALERT,        // Red (mute / standby)
+    COLOR_ROLE_COUNT
+};
+
+// Font size rule
+enum SizeRule : uint8_t {
+    SIZE_VOLUME = 0,    // settings.vol_sizes[mode]
+    SIZE_LABEL,         // settings.label_sizes[mode]
+    SIZE_FIXED,         // slot.fixedSize
+};
+
+// Horizontal anchor — doubles as the TFT_eSPI datum column (L/C/R)
+enum HAnchor : uint8_t { H_LEFT = 0, H_CENTER = 1, H_RIGHT = 2 };
+
+// Vertical anchor
+enum VAnchor : uint8_t {
+    V_TOP = 0,          // y = offset
+    V_CENTER,           // Centred on the screen
+    V_BELOW_LABEL,      // y = one label height + offset
+    V_BETWEEN_LABELS,   // Centred between a top and bottom label row
+    V_BOTTOM_ROW,       // y = screen height - one label height
+    V_BOTTOM,           // Bottom edge at screen height - offset
+};
+
+struct LayoutSlot {
+    LayoutField field;
+    uint8_t     font;       // TFT_eSPI font number
+    SizeRule    size;
+    uint8_t     fixedSize;  // SIZE_FIXED only
+    HAnchor     h;
+    int16_t     margin;     // px from the anchored edge (left / right), or from centre
+    VAnchor     v;
+    int16_t     offset;     // px, meaning depends on the vertical anchor
+    ColorRole   color;
+    int16_t     maxWidth;   // Shrink one size step if wider (0 = never)
+};
+
+// A resolved draw operation
+struct DrawOp {
+    LayoutField field;
+    uint8_t     font;
+    uint8_t     size;
+    uint8_t     datum;      // TFT_eSPI datum (TL/TC/TR/BL/BC/BR)
+    int16_t     x, y;       // Datum point (y is the bottom edge for B* datums)
+    int16_t     h;          // Nominal height in px (partial update band)
+    int16_t     maxWidth;
+    ColorRole   color;
+};
+
+struct DrawList {
+    uint8_t count = 0;
+    DrawOp  ops[LAYOUT_MAX_OPS] = {};
+};
+
+// --- Resolve a layout for the given sizes (constexpr: usable at compile time) ---
+constexpr int16_t layout_font_px(uint8_t font, uint8_t size) {
+    return size * (font == 1 ? 8
+                 : font == 2 ? 16
+                 : font == 6 || font == 7 ? LAYOUT_VOL_PX
+                 : font == 8 ? 75
+                 : LAYOUT_LABEL_PX);
+}
+
+constexpr DrawList layout_resolve_slots(const LayoutSlot *slots, uint8_t n,
+                                        uint8_t volSize, uint8_t labelSize) {
+    DrawList out{};
+    int16_t labelH = labelSize * LAYOUT_LABEL_PX;
+
+    for (uint8_t i = 0; i < n && i < LAYOUT_MAX_OPS; i++) {
+        const LayoutSlot &s = slots[i];
+        uint8_t size = s.size == SIZE_VOLUME ? volSize
+                     : s.size == SIZE_LABEL  ? labelSize
+                     : s.fixedSize;
+        int16_t h = layout_font_px(s.font, size);
+
+        int16_t x = s.h == H_LEFT   ? s.margin
+                  : s.h == H_RIGHT  ? DISPLAY_WIDTH - s.margin
+                  : DISPLAY_WIDTH / 2 + s.margin;
+
+        int16_t y = 0;
+        bool bottom = false;
+        switch (s.v) {
+            case V_TOP:         y = s.offset; break;
+            case V_CENTER:      y = (DISPLAY_HEIGHT - h) / 2; break;
+            case V_BELOW_LABEL: y = labelH + s.offset; break;
+            case V_BETWEEN_LABELS: {
+                int16_t topY = labelH + s.offset;
+                int16_t botY = DISPLAY_HEIGHT - labelH;
+                y = topY + (botY - topY - h) / 2;
+                if (y < topY) y = topY;
+                break;
+            }
+            case V_BOTTOM_ROW:  y = DISPLAY_HEIGHT - labelH; break;
+            case V_BOTTOM:      y = DISPLAY_HEIGHT - s.offset; bottom = true; break;
+        }
+
+        DrawOp &op = out.ops[out.count++];
+        op.field    = s.field;
+        op.font     = s.font;
+        op.size     = size;
+        op.datum    = (bottom ? 6 : 0) + s.h;   // TL/TC/TR = 0..2, BL/BC/BR = 6..8
+        op.x        = x;
+        op.y        = y;
+        op.h        = h;
+        op.maxWidth = s.maxWidth;
+        op.color    = s.color;
+    }
+    return out;
+}
+
+// Top row of an op's nominal box
+constexpr int16_t layout_op_top(const DrawOp &op) {
+    return op.datum >= 6 ? op.y - op.h : op.y;
+}
+
+// Precomputed draw list for a built-in mode (sizes are clamped to range)
+const DrawList& layout_builtin(DisplayMode mode, uint8_t volSize, uint8_t labelSize);
+
+// Resolve the draw list for the current settings — call on settings change
+void layout_resolve(const AppSettings &settings, DrawList &out);
+
+// --- Custom layout (MODE_CUSTOM) ---
+#define LAYOUT_BLOB_VERSION 1
+#define LAYOUT_RECORD_SIZE  14   // Bytes per slot in the NVS blob
+
+// Check a slot list; on failure writes a reason to `err` and returns false
+bool layout_validate(const LayoutSlot *slots, uint8_t n, char *err, size_t errLen);
+
+// Load the custom layout from NVS (falls back to Full Status if absent/invalid)
+void layout_custom_load();
+
+// Validate, store in NVS and make current. Safe to call from the web server task.
+bool layout_custom_set(const LayoutSlot *slots, uint8_t n, char *err, size_t errLen);
+
+// Copy out the current custom layout; returns the slot count
+uint8_t layout_custom_get(LayoutSlot *out);
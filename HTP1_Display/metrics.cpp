@@ -0,0 +1,124 @@
+#include "metrics.h"
+#include <freertos/task.h>
+
+MetricsSlot metricsSlots[portNUM_PROCESSORS];
+
+// Tasks whose stack high-water mark is exported (missing ones are skipped)
+static const char* const STACK_TASKS[] = {
+    "loopTask", "async_tcp", "tiT", "wifi", "brightness", "ota_pull", "recorder"
+};
+
+static uint32_t counter_total(MetricCounter c) {
+    uint32_t n = 0;
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        n += metricsSlots[i].counters[c].load(std::memory_order_relaxed);
+    }
+    return n;
+}
+
+uint64_t metrics_sum(MetricSum s) {
+    uint64_t n = 0;
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        MetricsSlot &slot = metricsSlots[i];
+        portENTER_CRITICAL(&slot.sumLock);
+        n += slot.sums[s];
+        portEXIT_CRITICAL(&slot.sumLock);
+    }
+    return n;
+}
+
+static void header(Print &out, const char *name, const char *type, const char *help) {
+    out.printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void counter(Print &out, const char *name, const char *help, MetricCounter c) {
+    header(out, name, "counter", help);
+    out.printf("%s %u\n", name, counter_total(c));
+}
+
+static void seconds(Print &out, const char *name, const char *help, MetricSum s) {
+    header(out, name, "counter", help);
+    out.printf("%s %.6f\n", name, metrics_sum(s) / 1e6);
+}
+
+static void gauge(Print &out, const char *name, const char *help, uint32_t v) {
+    header(out, name, "gauge", help);
+    out.printf("%s %u\n", name, v);
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void metrics_loop_pass(uint32_t us) {
+    MetricsSlot &slot = metricsSlots[xPortGetCoreID()];
+    slot.counters[MET_LOOP_ITERATIONS].fetch_add(1, std::memory_order_relaxed);
+    portENTER_CRITICAL(&slot.sumLock);
+    slot.sums[MET_LOOP_US] += us;
+    portEXIT_CRITICAL(&slot.sumLock);
+    // Only the loop task writes the max — no compare-exchange needed
+    if (us > slot.loopMaxUs.load(std::memory_order_relaxed)) {
+        slot.loopMaxUs.store(us, std::memory_order_relaxed);
+    }
+}
+
+void metrics_report(Print &out) {
+    // --- HTP-1 link ---
+    counter(out, "htp1_ws_frames_received_total", "WebSocket frames received from the HTP-1", MET_WS_FRAMES_RX);
+    counter(out, "htp1_ws_frames_parsed_total", "WebSocket frames applied as state patches", MET_WS_FRAMES_PARSED);
+    counter(out, "htp1_ws_frames_dropped_total", "WebSocket frames discarded (full dumps, bad JSON)", MET_WS_FRAMES_DROPPED);
+    seconds(out, "htp1_ws_parse_seconds_total", "Time spent parsing and applying WebSocket frames", MET_WS_PARSE_US);
+    counter(out, "htp1_ws_reconnects_total", "WebSocket reconnect attempts", MET_WS_RECONNECTS);
+    counter(out, "htp1_http_resyncs_total", "Full-state fetches from /ircmd", MET_HTTP_RESYNCS);
+    counter(out, "htp1_http_resync_errors_total", "Failed /ircmd fetches", MET_HTTP_RESYNC_ERRORS);
+    seconds(out, "htp1_http_resync_seconds_total", "Time spent in /ircmd fetches", MET_HTTP_RESYNC_US);
+
+    // --- Remote control (buttons -> HTP-1) ---
+    counter(out, "htp1_remote_steps_total", "Button volume steps", MET_REMOTE_STEPS);
+    counter(out, "htp1_remote_commands_total", "changemso commands sent (steps coalesced)", MET_REMOTE_COMMANDS);
+    counter(out, "htp1_remote_echoes_total", "Commands confirmed by the HTP-1 echo", MET_REMOTE_ECHOES);
+    counter(out, "htp1_remote_timeouts_total", "Commands with no echo in time", MET_REMOTE_TIMEOUTS);
+    seconds(out, "htp1_remote_rtt_seconds_total", "Command -> echo round-trip time", MET_REMOTE_RTT_US);
+    counter(out, "htp1_api_commands_total", "REST /api commands accepted", MET_API_COMMANDS);
+    counter(out, "htp1_api_coalesced_total", "REST commands replaced before they were sent", MET_API_COALESCED);
+
+    // --- Display ---
+    counter(out, "htp1_renders_total", "Compose + push passes (redraws and animation frames)", MET_RENDERS);
+    counter(out, "htp1_renders_partial_total", "Redraws that pushed only the rows of changed fields", MET_RENDERS_PARTIAL);
+    seconds(out, "htp1_render_seconds_total", "Time spent composing and pushing frames", MET_RENDER_US);
+    header(out, "htp1_qspi_bytes_total", "counter", "Pixel bytes pushed to the panel over QSPI");
+    out.printf("htp1_qspi_bytes_total %llu\n", (unsigned long long)metrics_sum(MET_QSPI_BYTES));
+    header(out, "htp1_push_bytes_total", "counter", "Pixel bytes of the row bands pushed: in full, and sent as dirty spans");
+    out.printf("htp1_push_bytes_total{kind=\"full\"} %llu\n"
+               "htp1_push_bytes_total{kind=\"sent\"} %llu\n",
+               (unsigned long long)metrics_sum(MET_PUSH_FULL_BYTES),
+               (unsigned long long)metrics_sum(MET_PUSH_SENT_BYTES));
+    seconds(out, "htp1_lcd_expand_seconds_total", "Time spent expanding the indexed framebuffer to RGB565", MET_LCD_EXPAND_US);
+
+    // --- Main loop ---
+    counter(out, "htp1_loop_iterations_total", "Main loop passes", MET_LOOP_ITERATIONS);
+    seconds(out, "htp1_loop_seconds_total", "Time spent in main loop passes (excluding idle waits)", MET_LOOP_US);
+    uint32_t maxUs = 0;
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        maxUs = max(maxUs, metricsSlots[i].loopMaxUs.exchange(0, std::memory_order_relaxed));
+    }
+    header(out, "htp1_loop_max_seconds", "gauge", "Slowest main loop pass since the previous scrape");
+    out.printf("htp1_loop_max_seconds %.6f\n", maxUs / 1e6);
+
+    // --- Storage ---
+    counter(out, "htp1_nvs_writes_total", "NVS write sessions (settings, layout, OTA bookkeeping)", MET_NVS_WRITES);
+
+    // --- Memory ---
+    gauge(out, "htp1_heap_free_bytes", "Free heap", ESP.getFreeHeap());
+    gauge(out, "htp1_heap_min_free_bytes", "Lowest free heap since boot", ESP.getMinFreeHeap());
+    gauge(out, "htp1_heap_largest_block_bytes", "Largest allocatable heap block", ESP.getMaxAllocHeap());
+    header(out, "htp1_task_stack_free_bytes", "gauge", "Task stack high-water mark (least free stack seen)");
+    for (const char *name : STACK_TASKS) {
+        TaskHandle_t task = xTaskGetHandle(name);
+        if (!task) continue;
+        out.printf("htp1_task_stack_free_bytes{task=\"%s\"} %u\n", name,
+                   (unsigned)uxTaskGetStackHighWaterMark(task));
+    }
+
+    gauge(out, "htp1_uptime_seconds", "Seconds since boot", millis() / 1000);
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+
+// Firmware counters for the Prometheus /metrics endpoint.
+//
+// Every counter has one slot per core. An increment is a single relaxed
+// 32-bit atomic add into the slot of the core it runs on, so instrumented
+// paths never contend with the other core; the slots are summed when
+// /metrics is scraped. A task that migrates between reading its core id
+// and the add still lands on a valid slot — the add stays atomic.
+//
+// The 64-bit sums are plain fields behind a per-slot spinlock: the S3 has
+// no 8-byte atomics, and std::atomic<uint64_t> falls back to libatomic's
+// single global lock. The slot lock is only ever taken by its own core and
+// by the scrape, for one add or one read.
+
+enum MetricCounter : uint8_t {
+    MET_WS_FRAMES_RX = 0,     // WebSocket frames received from the HTP-1
+    MET_WS_FRAMES_PARSED,     // ...applied as msoupdate patches
+    MET_WS_FRAMES_DROPPED,    // ...discarded (full mso dumps, bad JSON)
+    MET_WS_RECONNECTS,        // Connection attempts after the socket dropped
+    MET_HTTP_RESYNCS,         // /ircmd full-state fetches
+    MET_HTTP_RESYNC_ERRORS,   // ...that failed (HTTP error / bad JSON)
+    MET_RENDERS,              // Compose + push passes (full redraws and animation frames)
+    MET_RENDERS_PARTIAL,      // ...that pushed only the rows of changed fields
+    MET_NVS_WRITES,           // Preferences write sessions
+    MET_REMOTE_STEPS,         // Button volume steps (before coalescing)
+    MET_REMOTE_COMMANDS,      // changemso commands sent to the HTP-1
+    MET_REMOTE_ECHOES,        // ...confirmed by their msoupdate echo
+    MET_REMOTE_TIMEOUTS,      // ...not echoed within REMOTE_ECHO_TIMEOUT_MS
+    MET_API_COMMANDS,         // REST /api/* commands accepted
+    MET_API_COALESCED,        // ...that replaced an unsent command of the same kind
+    MET_LOOP_ITERATIONS,
+    MET_COUNTER_COUNT
+};
+
+// 64-bit accumulators (bytes / microseconds) — 32 bits would wrap in minutes
+enum MetricSum : uint8_t {
+    MET_QSPI_BYTES = 0,       // Pixel bytes pushed to the panel
+    MET_HTTP_RESYNC_US,
+    MET_RENDER_US,
+    MET_LOOP_US,
+    MET_REMOTE_RTT_US,        // changemso -> echo round trips
+    MET_WS_PARSE_US,          // Parsing + applying received WebSocket frames
+    MET_LCD_EXPAND_US,        // Indexed framebuffer -> RGB565 expansion for pushes
+    MET_PUSH_FULL_BYTES,      // Pixel bytes of the row bands pushed, in full
+    MET_PUSH_SENT_BYTES,      // ...actually sent as dirty spans
+    MET_ANIM_FRAME_US,        // Animation frame render time
+    MET_SUM_COUNT
+};
+
+struct MetricsSlot {
+    std::atomic<uint32_t> counters[MET_COUNTER_COUNT];
+    uint64_t sums[MET_SUM_COUNT];      // Guarded by sumLock
+    portMUX_TYPE sumLock = portMUX_INITIALIZER_UNLOCKED;
+    std::atomic<uint32_t> loopMaxUs;   // Slowest loop pass since the last scrape
+};
+
+extern MetricsSlot metricsSlots[portNUM_PROCESSORS];
+
+inline void metrics_inc(MetricCounter c, uint32_t n = 1) {
+    metricsSlots[xPortGetCoreID()].counters[c].fetch_add(n, std::memory_order_relaxed);
+}
+
+inline void metrics_add(MetricSum s, uint64_t v) {
+    MetricsSlot &slot = metricsSlots[xPortGetCoreID()];
+    portENTER_CRITICAL(&slot.sumLock);
+    slot.sums[s] += v;
+    portEXIT_CRITICAL(&slot.sumLock);
+}
+
+// Count one event and its duration
+inline void metrics_observe(MetricCounter c, MetricSum s, uint32_t us) {
+    MetricsSlot &slot = metricsSlots[xPortGetCoreID()];
+    slot.counters[c].fetch_add(1, std::memory_order_relaxed);
+    portENTER_CRITICAL(&slot.sumLock);
+    slot.sums[s] += us;
+    portEXIT_CRITICAL(&slot.sumLock);
+}
+
+// Total of a sum over both cores
+uint64_t metrics_sum(MetricSum s);
+
+// One main loop pass took `us` (call at the end of loop())
+void metrics_loop_pass(uint32_t us);
+
+// Write all firmware metrics in Prometheus text format
+void metrics_report(Print &out);
@@ -0,0 +1,652 @@
+#include "mso_mirror.h"
+#include "config.h"
+#include <algorithm>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define NONE        0xFFFF
+#define KEY_SLOTS   (MSO_MAX_KEYS * 2)   // Open addressing, at most half full
+
+// One value in the tree. Children form a singly linked list in document
+// order; object members are also chained in a (parent, key) hash bucket.
+struct Node {
+    uint16_t key;       // Interned key (object members), NONE otherwise
+    uint16_t parent;
+    uint16_t child;     // First child (objects / arrays)
+    uint16_t next;      // Next sibling, or next free node
+    uint16_t hnext;     // Next member in the same hash bucket
+    uint8_t  type;      // MsoType, MSO_TYPE_NONE = free
+    uint8_t  pad;
+    union {
+        bool     b;
+        int32_t  i;
+        float    f;
+        struct { uint16_t off, len; } s;   // Slice of strArena
+    } v;
+};
+static_assert(sizeof(Node) == 16, "Node should stay 16 bytes");
+
+// --- Storage (allocated once by mso_init) ---
+static Node *nodes = nullptr;
+static uint16_t *buckets = nullptr;
+static char *strArena = nullptr;
+static char *keyArena = nullptr;
+static uint16_t freeNode = NONE;
+static uint16_t nodesUsed = 0;
+static uint16_t nodesPeak = 0;
+static uint16_t strTop = 0;          // Bump pointer
+static uint32_t strLive = 0;         // Bytes still referenced
+static uint16_t root = NONE;
+static bool loaded = false;
+static bool stale = false;
+static bool failed = false;          // Current build ran out of space
+
+// --- Interned keys ---
+static uint16_t keyOff[MSO_MAX_KEYS];
+static uint8_t keyLen[MSO_MAX_KEYS];
+static uint16_t keySlots[KEY_SLOTS]; // id + 1, 0 = empty
+static uint16_t keyCount = 0;
+static uint16_t keyTop = 0;
+
+// Builds / patches run on the loop; mso_write_json may run on async_tcp
+static SemaphoreHandle_t lock = nullptr;
+
+// --- Stats ---
+static uint32_t loads = 0;
+static uint32_t loadFailures = 0;
+static uint32_t opsChanged = 0;
+static uint32_t opsUnchanged = 0;
+static uint32_t opsFailed = 0;
+static uint32_t opsUnsupported = 0;
+static uint32_t compactions = 0;
+
+static uint32_t hash_str(const char *s, size_t n) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    while (n--) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t bucket_of(uint16_t parent, uint16_t key) {
+    return ((((uint32_t)parent << 16) | key) * 2654435761u >> 16) & (MSO_NODE_BUCKETS - 1);
+}
+
+// --- Key interning: returns the key id, or NONE (unknown / table full) ---
+static uint16_t key_find(const char *s, size_t n, bool add) {
+    if (n > 255) return NONE;
+    uint32_t i = hash_str(s, n) & (KEY_SLOTS - 1);
+    while (keySlots[i]) {
+        uint16_t id = keySlots[i] - 1;
+        if (keyLen[id] == n && memcmp(keyArena + keyOff[id], s, n) == 0) return id;
+        i = (i + 1) & (KEY_SLOTS - 1);
+    }
+    if (!add || keyCount >= MSO_MAX_KEYS || keyTop + n > MSO_KEY_ARENA) {
+        if (add) failed = true;
+        return NONE;
+    }
+    memcpy(keyArena + keyTop, s, n);
+    keyOff[keyCount] = keyTop;
+    keyLen[keyCount] = n;
+    keyTop += n;
+    keySlots[i] = ++keyCount;
+    return keyCount - 1;
+}
+
+// --- Empty the pool, arenas and key table ---
+static void reset() {
+    for (uint16_t n = 0; n < MSO_MAX_NODES; n++) {
+        nodes[n].type = MSO_TYPE_NONE;
+        nodes[n].next = n + 1 < MSO_MAX_NODES ? n + 1 : NONE;
+    }
+    freeNode = 0;
+    nodesUsed = 0;
+    memset(buckets, 0xFF, MSO_NODE_BUCKETS * sizeof(uint16_t));
+    strTop = 0;
+    strLive = 0;
+    memset(keySlots, 0, sizeof(keySlots));
+    keyCount = 0;
+    keyTop = 0;
+    root = NONE;
+    loaded = false;
+}
+
+// ============================================================
+// Nodes
+// ============================================================
+
+static uint16_t node_alloc(uint16_t parent, uint16_t key) {
+    if (freeNode == NONE) {
+        failed = true;
+        return NONE;
+    }
+    uint16_t n = freeNode;
+    Node &d = nodes[n];
+    freeNode = d.next;
+    d = Node();
+    d.key = key;
+    d.parent = parent;
+    d.child = d.next = d.hnext = NONE;
+    d.type = MSO_TYPE_NULL;
+    if (key != NONE) {
+        uint32_t b = bucket_of(parent, key);
+        d.hnext = buckets[b];
+        buckets[b] = n;
+    }
+    if (++nodesUsed > nodesPeak) nodesPeak = nodesUsed;
+    return n;
+}
+
+static uint16_t member(uint16_t parent, uint16_t key) {
+    for (uint16_t n = buckets[bucket_of(parent, key)]; n != NONE; n = nodes[n].hnext) {
+        if (nodes[n].parent == parent && nodes[n].key == key) return n;
+    }
+    return NONE;
+}
+
+static uint16_t element(uint16_t array, uint16_t index) {
+    uint16_t n = nodes[array].child;
+    while (n != NONE && index--) n = nodes[n].next;
+    return n;
+}
+
+static uint16_t last_child(uint16_t parent) {
+    uint16_t n = nodes[parent].child;
+    if (n == NONE) return NONE;
+    while (nodes[n].next != NONE) n = nodes[n].next;
+    return n;
+}
+
+// Insert `c` after sibling `prev` (NONE = first child)
+static void link_after(uint16_t parent, uint16_t prev, uint16_t c) {
+    if (prev == NONE) {
+        nodes[c].next = nodes[parent].child;
+        nodes[parent].child = c;
+    } else {
+        nodes[c].next = nodes[prev].next;
+        nodes[prev].next = c;
+    }
+}
+
+static void unlink(uint16_t n) {
+    uint16_t *p = &nodes[nodes[n].parent].child;
+    while (*p != n) p = &nodes[*p].next;
+    *p = nodes[n].next;
+}
+
+static uint8_t depth_of(uint16_t n) {
+    uint8_t d = 0;
+    while ((n = nodes[n].parent) != NONE) d++;
+    return d;
+}
+
+static void free_node(uint16_t n);
+
+// Drop a node's string / children; leaves it as null
+static void clear_value(uint16_t n) {
+    Node &d = nodes[n];
+    if (d.type == MSO_TYPE_STRING) strLive -= d.v.s.len;
+    uint16_t c = d.child;
+    while (c != NONE) {
+        uint16_t next = nodes[c].next;
+        free_node(c);
+        c = next;
+    }
+    d.child = NONE;
+    d.type = MSO_TYPE_NULL;
+}
+
+static void free_node(uint16_t n) {
+    clear_value(n);
+    Node &d = nodes[n];
+    if (d.key != NONE) {
+        uint16_t *p = &buckets[bucket_of(d.parent, d.key)];
+        while (*p != n) p = &nodes[*p].hnext;
+        *p = d.hnext;
+    }
+    d.type = MSO_TYPE_NONE;
+    d.next = freeNode;
+    freeNode = n;
+    nodesUsed--;
+}
+
+// ============================================================
+// String arena
+// ============================================================
+
+// Slide live strings down over the garbage left by replaced values
+static void compact_strings() {
+    uint16_t *order = (uint16_t*)malloc(nodesUsed * sizeof(uint16_t));
+    if (!order) return;
+    size_t count = 0;
+    for (uint16_t n = 0; n < MSO_MAX_NODES; n++) {
+        if (nodes[n].type == MSO_TYPE_STRING && nodes[n].v.s.len) order[count++] = n;
+    }
+    std::sort(order, order + count, [](uint16_t a, uint16_t b) {
+        return nodes[a].v.s.off < nodes[b].v.s.off;
+    });
+    uint16_t top = 0;
+    for (size_t i = 0; i < count; i++) {
+        Node &d = nodes[order[i]];
+        memmove(strArena + top, strArena + d.v.s.off, d.v.s.len);
+        d.v.s.off = top;
+        top += d.v.s.len;
+    }
+    free(order);
+    strTop = top;
+    compactions++;
+}
+
+static bool str_store(Node &d, const char *s, size_t len) {
+    if (strTop + len > MSO_STR_ARENA) compact_strings();
+    if (strTop + len > MSO_STR_ARENA) {
+        failed = true;
+        return false;
+    }
+    memcpy(strArena + strTop, s, len);
+    d.v.s.off = strTop;
+    d.v.s.len = len;
+    strTop += len;
+    strLive += len;
+    d.type = MSO_TYPE_STRING;
+    return true;
+}
+
+// ============================================================
+// Building from JSON
+// ============================================================
+
+static bool set_value(uint16_t n, JsonVariantConst v, uint8_t depth) {
+    clear_value(n);
+    Node &d = nodes[n];
+
+    if (v.is<bool>()) {
+        d.type = MSO_TYPE_BOOL;
+        d.v.b = v.as<bool>();
+    } else if (v.is<int32_t>()) {
+        d.type = MSO_TYPE_INT;
+        d.v.i = v.as<int32_t>();
+    } else if (v.is<float>()) {
+        d.type = MSO_TYPE_FLOAT;
+        d.v.f = v.as<float>();
+    } else if (v.is<const char*>()) {
+        const char *s = v.as<const char*>();
+        return str_store(d, s, strlen(s));
+    } else if (v.is<JsonObjectConst>() || v.is<JsonArrayConst>()) {
+        bool obj = v.is<JsonObjectConst>();
+        d.type = obj ? MSO_TYPE_OBJECT : MSO_TYPE_ARRAY;
+        if (depth >= MSO_MAX_DEPTH) {
+            failed = true;
+            return false;
+        }
+        uint16_t tail = NONE;
+        if (obj) {
+            for (JsonPairConst kv : v.as<JsonObjectConst>()) {
+                uint16_t key = key_find(kv.key().c_str(), kv.key().size(), true);
+                uint16_t c = key == NONE ? NONE : node_alloc(n, key);
+                if (c == NONE) return false;
+                link_after(n, tail, c);
+                tail = c;
+                if (!set_value(c, kv.value(), depth + 1)) return false;
+            }
+        } else {
+            for (JsonVariantConst e : v.as<JsonArrayConst>()) {
+                uint16_t c = node_alloc(n, NONE);
+                if (c == NONE) return false;
+                link_after(n, tail, c);
+                tail = c;
+                if (!set_value(c, e, depth + 1)) return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Would writing `v` leave a scalar node as it is?
+static bool same_value(uint16_t n, JsonVariantConst v) {
+    const Node &d = nodes[n];
+    switch (d.type) {
+        case MSO_TYPE_NULL:  return v.isNull();
+        case MSO_TYPE_BOOL:  return v.is<bool>() && v.as<bool>() == d.v.b;
+        case MSO_TYPE_INT:   return v.is<int32_t>() && v.as<int32_t>() == d.v.i;
+        case MSO_TYPE_FLOAT: return !v.is<int32_t>() && v.is<float>() && v.as<float>() == d.v.f;
+        case MSO_TYPE_STRING: {
+            if (!v.is<const char*>()) return false;
+            const char *s = v.as<const char*>();
+            return strlen(s) == d.v.s.len && memcmp(s, strArena + d.v.s.off, d.v.s.len) == 0;
+        }
+        default: return false;   // Containers are rebuilt
+    }
+}
+
+// ============================================================
+// JSON pointers (RFC 6901)
+// ============================================================
+
+// Copy the reference token after a '/' into `tok`, undoing ~1 and ~0.
+// Returns the rest of the path, or nullptr if malformed / too long.
+static const char* next_token(const char *p, char *tok, size_t &len) {
+    len = 0;
+    p++;
+    while (*p && *p != '/') {
+        char c = *p++;
+        if (c == '~') {
+            if (*p == '0') c = '~';
+            else if (*p == '1') c = '/';
+            else return nullptr;
+            p++;
+        }
+        if (len >= MSO_MAX_TOKEN - 1) return nullptr;
+        tok[len++] = c;
+    }
+    tok[len] = '\0';
+    return p;
+}
+
+static bool parse_index(const char *tok, size_t len, uint16_t &out) {
+    if (len == 0 || len > 5 || (len > 1 && tok[0] == '0')) return false;
+    uint32_t v = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (tok[i] < '0' || tok[i] > '9') return false;
+        v = v * 10 + (tok[i] - '0');
+    }
+    if (v >= MSO_MAX_NODES) return false;
+    out = v;
+    return true;
+}
+
+static uint16_t child_of(uint16_t n, const char *tok, size_t len) {
+    if (nodes[n].type == MSO_TYPE_OBJECT) {
+        uint16_t key = key_find(tok, len, false);
+        return key == NONE ? NONE : member(n, key);
+    }
+    uint16_t index;
+    if (nodes[n].type == MSO_TYPE_ARRAY && parse_index(tok, len, index)) return element(n, index);
+    return NONE;
+}
+
+// Walk a pointer to its node. With `last`, stops at the parent and hands
+// back the final (unescaped) token instead.
+static uint16_t resolve(const char *path, char *last = nullptr, size_t *lastLen = nullptr) {
+    if (root == NONE || !path) return NONE;
+    if (*path == '\0') return last ? NONE : root;
+
+    uint16_t n = root;
+    char tok[MSO_MAX_TOKEN];
+    size_t len;
+    while (*path) {
+        if (*path != '/' || !(path = next_token(path, tok, len))) return NONE;
+        if (last && *path == '\0') {
+            memcpy(last, tok, len + 1);
+            *lastLen = len;
+            return n;
+        }
+        n = child_of(n, tok, len);
+        if (n == NONE) return NONE;
+    }
+    return n;
+}
+
+// ============================================================
+// JSON patch (RFC 6902: replace / add / remove)
+// ============================================================
+
+enum OpResult : uint8_t { OP_CHANGED, OP_UNCHANGED, OP_FAILED, OP_UNSUPPORTED };
+
+static OpResult write_node(uint16_t n, JsonVariantConst value) {
+    if (same_value(n, value)) return OP_UNCHANGED;
+    return set_value(n, value, depth_of(n)) ? OP_CHANGED : OP_FAILED;
+}
+
+static OpResult op_add(const char *path, JsonVariantConst value) {
+    if (*path == '\0') return root == NONE ? OP_FAILED : write_node(root, value);
+
+    char tok[MSO_MAX_TOKEN];
+    size_t len;
+    uint16_t parent = resolve(path, tok, &len);
+    if (parent == NONE) return OP_FAILED;
+
+    uint16_t n;
+    if (nodes[parent].type == MSO_TYPE_OBJECT) {
+        uint16_t key = key_find(tok, len, true);
+        if (key == NONE) return OP_FAILED;
+        n = member(parent, key);
+        if (n != NONE) return write_node(n, value);   // add on an existing member replaces it
+        n = node_alloc(parent, key);
+        if (n == NONE) return OP_FAILED;
+        link_after(parent, last_child(parent), n);
+    } else if (nodes[parent].type == MSO_TYPE_ARRAY) {
+        // Insert before element `index`; "-" (or index == size) appends
+        uint16_t prev = NONE, index;
+        if (len == 1 && tok[0] == '-') {
+            prev = last_child(parent);
+        } else {
+            if (!parse_index(tok, len, index)) return OP_FAILED;
+            if (index > 0 && (prev = element(parent, index - 1)) == NONE) return OP_FAILED;
+        }
+        n = node_alloc(parent, NONE);
+        if (n == NONE) return OP_FAILED;
+        link_after(parent, prev, n);
+    } else {
+        return OP_FAILED;
+    }
+    return set_value(n, value, depth_of(n)) ? OP_CHANGED : OP_FAILED;
+}
+
+static OpResult apply_op(JsonObjectConst op) {
+    const char *name = op["op"] | "";
+    const char *path = op["path"];
+    if (!path) return OP_FAILED;
+
+    if (strcmp(name, "replace") == 0) {
+        uint16_t n = resolve(path);
+        return n == NONE ? OP_FAILED : write_node(n, op["value"]);
+    }
+    if (strcmp(name, "add") == 0) {
+        return op_add(path, op["value"]);
+    }
+    if (strcmp(name, "remove") == 0) {
+        uint16_t n = resolve(path);
+        if (n == NONE || n == root) return OP_FAILED;
+        unlink(n);
+        free_node(n);
+        return OP_CHANGED;
+    }
+    return OP_UNSUPPORTED;   // move / copy / test are never sent by the HTP-1
+}
+
+// ============================================================
+// Serialization
+// ============================================================
+
+static void write_string(Print &out, const char *s, size_t len) {
+    out.write('"');
+    for (size_t i = 0; i < len; i++) {
+        char c = s[i];
+        if (c == '"' || c == '\\') {
+            out.write('\\');
+            out.write(c);
+        } else if ((uint8_t)c < 0x20) {
+            out.printf("\\u%04x", c);
+        } else {
+            out.write(c);
+        }
+    }
+    out.write('"');
+}
+
+static void write_json(uint16_t n, Print &out) {
+    const Node &d = nodes[n];
+    switch (d.type) {
+        case MSO_TYPE_BOOL:   out.print(d.v.b ? "true" : "false"); break;
+        case MSO_TYPE_INT:    out.printf("%ld", (long)d.v.i); break;
+        case MSO_TYPE_FLOAT:  out.printf("%g", (double)d.v.f); break;
+        case MSO_TYPE_STRING: write_string(out, strArena + d.v.s.off, d.v.s.len); break;
+        case MSO_TYPE_OBJECT:
+        case MSO_TYPE_ARRAY: {
+            bool obj = d.type == MSO_TYPE_OBJECT;
+            out.write(obj ? '{' : '[');
+            for (uint16_t c = d.child; c != NONE; c = nodes[c].next) {
+                if (c != d.child) out.write(',');
+                if (obj) {
+                    uint16_t k = nodes[c].key;
+                    write_string(out, keyArena + keyOff[k], keyLen[k]);
+                    out.write(':');
+                }
+                write_json(c, out);
+            }
+            out.write(obj ? '}' : ']');
+            break;
+        }
+        default: out.print("null"); break;
+    }
+}
+
+// --- Pool / arenas: PSRAM when the board has it ---
+static void* arena_alloc(size_t bytes) {
+    void *p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : malloc(bytes);
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void mso_init() {
+    if (nodes) return;
+    lock = xSemaphoreCreateMutex();
+    nodes    = (Node*)arena_alloc(MSO_MAX_NODES * sizeof(Node));
+    buckets  = (uint16_t*)arena_alloc(MSO_NODE_BUCKETS * sizeof(uint16_t));
+    strArena = (char*)arena_alloc(MSO_STR_ARENA);
+    keyArena = (char*)arena_alloc(MSO_KEY_ARENA);
+    if (!nodes || !buckets || !strArena || !keyArena) {
+        Serial.println("[MSO] Out of memory, state mirror disabled");
+        free(nodes);
+        free(buckets);
+        free(strArena);
+        free(keyArena);
+        nodes = nullptr;
+        return;
+    }
+    reset();
+}
+
+bool mso_load(JsonVariantConst doc) {
+    if (!nodes) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    reset();
+    failed = false;
+    root = node_alloc(NONE, NONE);
+    bool ok = root != NONE && set_value(root, doc, 0) && !failed;
+    uint16_t usedNodes = nodesUsed, usedKeys = keyCount, usedStr = strTop;
+    if (ok) {
+        loaded = true;
+        stale = false;
+        loads++;
+    } else {
+        reset();
+        loadFailures++;
+    }
+    xSemaphoreGive(lock);
+
+    if (!ok) {
+        Serial.printf("[MSO] Dump does not fit: nodes %u/%u, keys %u/%u, strings %u/%u bytes\n",
+                      usedNodes, MSO_MAX_NODES, usedKeys, MSO_MAX_KEYS, usedStr, MSO_STR_ARENA);
+        return false;
+    }
+    Serial.printf("[MSO] Mirror loaded: %u nodes, %u keys, %u string bytes\n",
+                  usedNodes, usedKeys, usedStr);
+    return true;
+}
+
+static int apply_one(JsonVariantConst op) {
+    switch (apply_op(op.as<JsonObjectConst>())) {
+        case OP_CHANGED:
+            opsChanged++;
+            return 1;
+        case OP_UNCHANGED:
+            opsUnchanged++;
+            return 0;
+        case OP_FAILED:
+            opsFailed++;
+            stale = true;
+            return 0;
+        default:
+            opsUnsupported++;
+            return 0;
+    }
+}
+
+int mso_apply(JsonVariantConst ops) {
+    if (!loaded) return 0;
+
+    int changed = 0;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (ops.is<JsonArrayConst>()) {
+        for (JsonVariantConst op : ops.as<JsonArrayConst>()) changed += apply_one(op);
+    } else if (ops.is<JsonObjectConst>()) {
+        changed += apply_one(ops);
+    }
+    xSemaphoreGive(lock);
+    return changed;
+}
+
+void mso_clear() {
+    if (!nodes) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    reset();
+    stale = false;
+    xSemaphoreGive(lock);
+}
+
+bool mso_loaded() {
+    return loaded;
+}
+
+bool mso_stale() {
+    return loaded && stale;
+}
+
+bool mso_write_json(const char *path, Print &out) {
+    if (!nodes) return false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint16_t n = resolve(path);
+    if (n != NONE) write_json(n, out);
+    xSemaphoreGive(lock);
+    return n != NONE;
+}
+
+void mso_report_metrics(Print &out) {
+    out.printf("# HELP htp1_mso_loaded State mirror holds a full mso document\n"
+               "# TYPE htp1_mso_loaded gauge\n"
+               "htp1_mso_loaded %d\n", loaded ? 1 : 0);
+    out.printf("# HELP htp1_mso_nodes State mirror nodes in use / peak / capacity\n"
+               "# TYPE htp1_mso_nodes gauge\n"
+               "htp1_mso_nodes{state=\"used\"} %u\n"
+               "htp1_mso_nodes{state=\"peak\"} %u\n"
+               "htp1_mso_nodes{state=\"capacity\"} %u\n", nodesUsed, nodesPeak, MSO_MAX_NODES);
+    out.printf("# HELP htp1_mso_keys Interned object keys\n"
+               "# TYPE htp1_mso_keys gauge\n"
+               "htp1_mso_keys %u\n", keyCount);
+    out.printf("# HELP htp1_mso_string_bytes String arena: referenced / allocated / capacity\n"
+               "# TYPE htp1_mso_string_bytes gauge\n"
+               "htp1_mso_string_bytes{state=\"live\"} %u\n"
+               "htp1_mso_string_bytes{state=\"used\"} %u\n"
+               "htp1_mso_string_bytes{state=\"capacity\"} %u\n", strLive, strTop, MSO_STR_ARENA);
+    out.printf("# HELP htp1_mso_loads_total Full mso dumps loaded / too large\n"
+               "# TYPE htp1_mso_loads_total counter\n"
+               "htp1_mso_loads_total{result=\"ok\"} %u\n"
+               "htp1_mso_loads_total{result=\"overflow\"} %u\n", loads, loadFailures);
+    out.printf("# HELP htp1_mso_ops_total JSON-patch ops by result\n"
+               "# TYPE htp1_mso_ops_total counter\n"
+               "htp1_mso_ops_total{result=\"changed\"} %u\n"
+               "htp1_mso_ops_total{result=\"unchanged\"} %u\n"
+               "htp1_mso_ops_total{result=\"failed\"} %u\n"
+               "htp1_mso_ops_total{result=\"unsupported\"} %u\n",
+               opsChanged, opsUnchanged, opsFailed, opsUnsupported);
+    out.printf("# HELP htp1_mso_compactions_total String arena compactions\n"
+               "# TYPE htp1_mso_compactions_total counter\n"
+               "htp1_mso_compactions_total %u\n", compactions);
+}
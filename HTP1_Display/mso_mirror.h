@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// In-memory mirror of the HTP-1 `mso` document.
+//
+// Built from the full `mso` dump and kept current by applying the RFC 6902
+// ops in each `msoupdate` (replace / add / remove). Any subtree can then be
+// served by its JSON pointer — "/volume", "/status/DECSourceProgram",
+// "/speakers/groups/c/present" — without new parsing code.
+//
+// Storage is a fixed node pool plus two arenas, allocated once (PSRAM when
+// present), so memory is bounded whatever the processor sends:
+//   - Object keys are interned: each node stores a 16-bit key id, and every
+//     "trim" or "present" in the tree shares one copy of the text.
+//   - Object members are found through a (parent, key) hash, so resolving a
+//     path costs O(depth); array elements are walked by index.
+//   - String values live in a bump arena that is compacted in place when
+//     replaced values have used it up.
+//
+// Threading: the loop builds and patches the mirror. mso_write_json() may be
+// called from any task.
+
+enum MsoType : uint8_t {
+    MSO_TYPE_NONE = 0,  // Free node
+    MSO_TYPE_NULL,
+    MSO_TYPE_BOOL,
+    MSO_TYPE_INT,
+    MSO_TYPE_FLOAT,
+    MSO_TYPE_STRING,
+    MSO_TYPE_OBJECT,
+    MSO_TYPE_ARRAY,
+};
+
+// Allocate the pool and arenas (call once; htp1_init does)
+void mso_init();
+
+// Replace the mirror with a full `mso` dump. Returns false if it did not
+// fit (the mirror is then empty until the next dump).
+bool mso_load(JsonVariantConst doc);
+
+// Apply a JSON-patch array (or a single op object). Returns the number of
+// ops that changed the mirror; failed and unsupported ops are counted.
+int mso_apply(JsonVariantConst ops);
+
+// Forget the document (e.g. when the target processor changes)
+void mso_clear();
+
+// Has a full dump been loaded?
+bool mso_loaded();
+
+// An op could not be applied since the last dump (the mirror may have
+// diverged from the processor — request a fresh dump)
+bool mso_stale();
+
+// Serialize a subtree as JSON. Returns false if the path does not exist.
+bool mso_write_json(const char *path, Print &out);
+
+// Mirror counters in Prometheus text format (for /metrics)
+void mso_report_metrics(Print &out);
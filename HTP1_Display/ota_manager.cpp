@@ -0,0 +1,398 @@
+#include "ota_manager.h"
+#include "config.h"
+#include "metrics.h"
+#include <Update.h>
+#include <Preferences.h>
+#include <ArduinoJson.h>
+#include <esp_ota_ops.h>
+#include <esp_timer.h>
+#include <mbedtls/sha256.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+static const char* NS = "htp1ota";
+
+// Keep the image in PENDING_VERIFY after an OTA boot instead of letting the
+// core mark it valid before setup() — we confirm it from the main loop.
+extern "C" bool verifyRollbackLater() {
+    return true;
+}
+
+// --- Current update (otaLock; only the owner token may touch it) ---
+static SemaphoreHandle_t otaLock = nullptr;
+static OtaToken owner = 0;
+static OtaToken lastToken = 0;
+static volatile bool active = false;
+static mbedtls_sha256_context shaCtx;
+static uint8_t expectedSha[32];
+static bool haveSha = false;
+static char targetLabel[17] = "";
+static char targetVersion[16] = "";
+static const char *lastError = nullptr;
+static char errBuf[48];
+
+// --- Stats of the current / last update ---
+struct OtaStats {
+    uint32_t bytes;
+    uint32_t durationMs;
+    uint32_t bytesPerSec;
+    uint32_t writes;          // Update.write calls
+    uint32_t writeMaxUs;      // Worst flash write (sector erase + program)
+    uint64_t writeTotalUs;
+};
+
+static OtaStats stats;
+static unsigned long startMs = 0;
+
+// --- Fleet counters (NVS) ---
+struct FleetCounters {
+    uint32_t attempts;        // Updates started
+    uint32_t failures;        // Write / verify / finalize errors
+    uint32_t confirmed;       // New images that reached the render loop
+    uint32_t rollbacks;       // New images the bootloader reverted
+    uint32_t lastMs;          // Duration of the last successful transfer
+    uint32_t lastBps;         // Throughput of the last successful transfer
+};
+
+static FleetCounters fleet;
+
+// --- Boot verification ---
+static bool pendingVerify = false;     // Running image is on probation
+static bool newImageBooted = false;    // ...and it's the one we just flashed
+static char rolledBackVersion[16] = "";
+static esp_timer_handle_t verifyTimer = nullptr;
+
+static unsigned long rebootAt = 0;
+
+static void save_fleet() {
+    metrics_inc(MET_NVS_WRITES);
+    Preferences prefs;
+    prefs.begin(NS, false);
+    prefs.putULong("att",    fleet.attempts);
+    prefs.putULong("fail",   fleet.failures);
+    prefs.putULong("ok",     fleet.confirmed);
+    prefs.putULong("rb",     fleet.rollbacks);
+    prefs.putULong("lastms", fleet.lastMs);
+    prefs.putULong("lastbps", fleet.lastBps);
+    prefs.end();
+}
+
+static void fail(const char *reason) {
+    snprintf(errBuf, sizeof(errBuf), "%s", reason);
+    lastError = errBuf;
+    fleet.failures++;
+    save_fleet();
+    Serial.printf("[OTA] Failed: %s\n", reason);
+}
+
+static bool parse_hex(const char *hex, uint8_t *out, size_t n) {
+    if (!hex || strlen(hex) != n * 2) return false;
+    for (size_t i = 0; i < n; i++) {
+        char b[3] = { hex[i * 2], hex[i * 2 + 1], 0 };
+        char *end;
+        out[i] = (uint8_t)strtoul(b, &end, 16);
+        if (*end) return false;
+    }
+    return true;
+}
+
+// Caller holds otaLock
+static void abort_locked(const char *reason) {
+    active = false;
+    owner = 0;
+    mbedtls_sha256_free(&shaCtx);
+    Update.abort();
+    fail(reason);
+}
+
+// --- Verify watchdog: the new image never reached loop() ---
+static void on_verify_timeout(void *arg) {
+    Serial.println("[OTA] New image did not reach the render loop — rolling back");
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void ota_init() {
+    if (!otaLock) otaLock = xSemaphoreCreateMutex();
+    Preferences prefs;
+    prefs.begin(NS, false);
+    fleet.attempts  = prefs.getULong("att", 0);
+    fleet.failures  = prefs.getULong("fail", 0);
+    fleet.confirmed = prefs.getULong("ok", 0);
+    fleet.rollbacks = prefs.getULong("rb", 0);
+    fleet.lastMs    = prefs.getULong("lastms", 0);
+    fleet.lastBps   = prefs.getULong("lastbps", 0);
+    String pending  = prefs.getString("pend", "");
+    String pendingVersion = prefs.getString("pendver", "");
+    if (pending.length() > 0) prefs.remove("pend");
+    if (pendingVersion.length() > 0) prefs.remove("pendver");
+    strlcpy(rolledBackVersion, prefs.getString("rbver", "").c_str(), sizeof(rolledBackVersion));
+    prefs.end();
+
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    esp_ota_img_states_t state;
+    pendingVerify = running &&
+                    esp_ota_get_state_partition(running, &state) == ESP_OK &&
+                    state == ESP_OTA_IMG_PENDING_VERIFY;
+
+    // An update was flashed last session: did we boot into it?
+    if (pending.length() > 0) {
+        if (running && pending == running->label) {
+            newImageBooted = true;
+        } else {
+            fleet.rollbacks++;
+            save_fleet();
+            if (pendingVersion.length() > 0) {
+                strlcpy(rolledBackVersion, pendingVersion.c_str(), sizeof(rolledBackVersion));
+                metrics_inc(MET_NVS_WRITES);
+                prefs.begin(NS, false);
+                prefs.putString("rbver", rolledBackVersion);
+                prefs.end();
+            }
+            Serial.printf("[OTA] Image in %s (v%s) was rolled back, running %s\n",
+                          pending.c_str(), pendingVersion.length() ? pendingVersion.c_str() : "?",
+                          running ? running->label : "?");
+        }
+    }
+
+    if (pendingVerify) {
+        esp_timer_create_args_t args = {};
+        args.callback = on_verify_timeout;
+        args.name = "ota_verify";
+        if (esp_timer_create(&args, &verifyTimer) == ESP_OK) {
+            esp_timer_start_once(verifyTimer, (uint64_t)OTA_VERIFY_TIMEOUT_MS * 1000);
+        }
+        Serial.printf("[OTA] Running %s on probation (%us to reach loop)\n",
+                      running->label, OTA_VERIFY_TIMEOUT_MS / 1000);
+    }
+}
+
+void ota_confirm_boot() {
+    if (!pendingVerify) return;
+    pendingVerify = false;
+
+    if (verifyTimer) {
+        esp_timer_stop(verifyTimer);
+        esp_timer_delete(verifyTimer);
+        verifyTimer = nullptr;
+    }
+    esp_ota_mark_app_valid_cancel_rollback();
+
+    if (newImageBooted) {
+        fleet.confirmed++;
+        save_fleet();
+        // The version that failed before works now (e.g. reinstalled by upload)
+        if (strcmp(rolledBackVersion, FW_VERSION) == 0) {
+            rolledBackVersion[0] = '\0';
+            metrics_inc(MET_NVS_WRITES);
+            Preferences prefs;
+            prefs.begin(NS, false);
+            prefs.remove("rbver");
+            prefs.end();
+        }
+    }
+    Serial.println("[OTA] Image confirmed — rollback cancelled");
+}
+
+OtaBeginResult ota_begin(OtaToken &token, size_t size, const char *sha256Hex, const char *version) {
+    token = 0;
+    xSemaphoreTake(otaLock, portMAX_DELAY);
+    if (active) {
+        xSemaphoreGive(otaLock);
+        Serial.println("[OTA] Busy: another update is running");
+        return OTA_BUSY;
+    }
+
+    memset(&stats, 0, sizeof(stats));
+    lastError = nullptr;
+    fleet.attempts++;
+    save_fleet();
+
+    haveSha = sha256Hex && *sha256Hex;
+    if (haveSha && !parse_hex(sha256Hex, expectedSha, sizeof(expectedSha))) {
+        fail("bad sha256 parameter");
+        xSemaphoreGive(otaLock);
+        return OTA_FAILED;
+    }
+    if (!haveSha && OTA_REQUIRE_SHA256) {
+        fail("sha256 required");
+        xSemaphoreGive(otaLock);
+        return OTA_FAILED;
+    }
+
+    const esp_partition_t *target = esp_ota_get_next_update_partition(nullptr);
+    strlcpy(targetLabel, target ? target->label : "", sizeof(targetLabel));
+    strlcpy(targetVersion, version ? version : "", sizeof(targetVersion));
+
+    if (!Update.begin(size ? size : UPDATE_SIZE_UNKNOWN)) {
+        fail(Update.errorString());
+        xSemaphoreGive(otaLock);
+        return OTA_FAILED;
+    }
+
+    mbedtls_sha256_init(&shaCtx);
+    mbedtls_sha256_starts(&shaCtx, 0);
+    startMs = millis();
+    if (++lastToken == 0) lastToken = 1;
+    owner = token = lastToken;
+    active = true;
+    xSemaphoreGive(otaLock);
+    Serial.printf("[OTA] Begin: %u bytes -> %s%s\n", (unsigned)size, targetLabel,
+                  haveSha ? "" : " (unverified)");
+    return OTA_STARTED;
+}
+
+bool ota_write(OtaToken token, const uint8_t *data, size_t len) {
+    xSemaphoreTake(otaLock, portMAX_DELAY);
+    if (!active || token != owner) {
+        xSemaphoreGive(otaLock);
+        return false;
+    }
+
+    mbedtls_sha256_update(&shaCtx, data, len);
+
+    unsigned long t = micros();
+    size_t written = Update.write((uint8_t*)data, len);
+    uint32_t us = micros() - t;
+
+    stats.writes++;
+    stats.writeTotalUs += us;
+    if (us > stats.writeMaxUs) stats.writeMaxUs = us;
+    stats.bytes += written;
+
+    bool ok = written == len;
+    if (!ok) abort_locked(Update.errorString());
+    xSemaphoreGive(otaLock);
+    return ok;
+}
+
+bool ota_end(OtaToken token) {
+    xSemaphoreTake(otaLock, portMAX_DELAY);
+    if (!active || token != owner) {
+        xSemaphoreGive(otaLock);
+        return false;
+    }
+    active = false;
+    owner = 0;
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&shaCtx, digest);
+    mbedtls_sha256_free(&shaCtx);
+
+    stats.durationMs  = millis() - startMs;
+    stats.bytesPerSec = stats.durationMs ? (uint64_t)stats.bytes * 1000 / stats.durationMs : 0;
+
+    if (haveSha && memcmp(digest, expectedSha, sizeof(digest)) != 0) {
+        Update.abort();
+        fail("sha256 mismatch");
+        xSemaphoreGive(otaLock);
+        return false;
+    }
+    if (!Update.end(true)) {
+        fail(Update.errorString());
+        xSemaphoreGive(otaLock);
+        return false;
+    }
+
+    fleet.lastMs  = stats.durationMs;
+    fleet.lastBps = stats.bytesPerSec;
+    save_fleet();
+
+    // Remember what we flashed — next boot tells whether it stuck
+    metrics_inc(MET_NVS_WRITES);
+    Preferences prefs;
+    prefs.begin(NS, false);
+    prefs.putString("pend", targetLabel);
+    if (targetVersion[0]) prefs.putString("pendver", targetVersion);
+    else prefs.remove("pendver");
+    prefs.end();
+    xSemaphoreGive(otaLock);
+
+    Serial.printf("[OTA] OK: %u bytes in %u ms (%.1f KB/s), %u writes avg %u us max %u us\n",
+                  stats.bytes, stats.durationMs, stats.bytesPerSec / 1024.0f, stats.writes,
+                  stats.writes ? (uint32_t)(stats.writeTotalUs / stats.writes) : 0,
+                  stats.writeMaxUs);
+    return true;
+}
+
+void ota_abort(OtaToken token, const char *reason) {
+    xSemaphoreTake(otaLock, portMAX_DELAY);
+    if (active && token == owner) abort_locked(reason);
+    xSemaphoreGive(otaLock);
+}
+
+bool ota_in_progress() {
+    return active;
+}
+
+const char* ota_last_error() {
+    return lastError;
+}
+
+const char* ota_rolled_back_version() {
+    return rolledBackVersion;
+}
+
+void ota_request_reboot() {
+    rebootAt = millis() + OTA_REBOOT_DELAY_MS;
+    if (rebootAt == 0) rebootAt = 1;
+}
+
+void ota_poll() {
+    if (rebootAt && (long)(millis() - rebootAt) >= 0) {
+        Serial.println("[OTA] Rebooting into new image");
+        Serial.flush();
+        ESP.restart();
+    }
+}
+
+String ota_report_json() {
+    JsonDocument doc;
+
+    doc["active"]   = active;
+    doc["error"]    = lastError;
+    doc["probation"] = pendingVerify;
+
+    JsonObject last = doc["last"].to<JsonObject>();
+    last["bytes"]        = stats.bytes;
+    last["ms"]           = stats.durationMs;
+    last["bps"]          = stats.bytesPerSec;
+    last["writes"]       = stats.writes;
+    last["write_avg_us"] = stats.writes ? (uint32_t)(stats.writeTotalUs / stats.writes) : 0;
+    last["write_max_us"] = stats.writeMaxUs;
+
+    JsonObject f = doc["fleet"].to<JsonObject>();
+    f["attempts"]  = fleet.attempts;
+    f["failures"]  = fleet.failures;
+    f["confirmed"] = fleet.confirmed;
+    f["rollbacks"] = fleet.rollbacks;
+    if (rolledBackVersion[0]) f["rolled_back_version"] = rolledBackVersion;
+    f["last_ms"]   = fleet.lastMs;
+    f["last_bps"]  = fleet.lastBps;
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+void ota_report_metrics(Print &out) {
+    out.printf("# HELP htp1_ota_updates_total OTA updates by outcome (persisted)\n"
+               "# TYPE htp1_ota_updates_total counter\n"
+               "htp1_ota_updates_total{result=\"attempted\"} %u\n"
+               "htp1_ota_updates_total{result=\"failed\"} %u\n"
+               "htp1_ota_updates_total{result=\"confirmed\"} %u\n"
+               "htp1_ota_updates_total{result=\"rolled_back\"} %u\n",
+               fleet.attempts, fleet.failures, fleet.confirmed, fleet.rollbacks);
+    out.printf("# HELP htp1_ota_last_duration_ms Transfer time of the last successful update\n"
+               "# TYPE htp1_ota_last_duration_ms gauge\n"
+               "htp1_ota_last_duration_ms %u\n", fleet.lastMs);
+    out.printf("# HELP htp1_ota_last_bytes_per_second Throughput of the last successful update\n"
+               "# TYPE htp1_ota_last_bytes_per_second gauge\n"
+               "htp1_ota_last_bytes_per_second %u\n", fleet.lastBps);
+    out.printf("# HELP htp1_ota_flash_write_max_us Worst flash write in the last update\n"
+               "# TYPE htp1_ota_flash_write_max_us gauge\n"
+               "htp1_ota_flash_write_max_us %u\n", stats.writeMaxUs);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Arduino.h>
+
+// OTA pipeline — streams a firmware image into the inactive app partition,
+// hashing it (SHA-256) as it goes and timing every flash write. The image
+// is only activated if the digest matches the one sent alongside it.
+//
+// Rollback: the new image boots in the PENDING_VERIFY state. It is marked
+// valid once the main loop is reached (ota_confirm_boot); if it crashes
+// before that, or doesn't get there within OTA_VERIFY_TIMEOUT_MS, the
+// bootloader reverts to the previous image.
+//
+// Fleet counters (attempts, failures, confirmed installs, rollbacks, last
+// duration / throughput) persist in NVS and are exposed on /ota and /metrics.
+// When an image that was flashed with a version is rolled back, that version
+// is remembered so pull OTA doesn't install it again.
+
+// Call once, early in setup() — rollback bookkeeping + verify watchdog
+void ota_init();
+
+// The running image reached the render loop — cancel the rollback.
+// Cheap after the first call; call every loop() iteration.
+void ota_confirm_boot();
+
+// One update at a time: ota_begin hands its caller a token, and only that
+// token can write, finish or abort the update. Safe from any task (uploads
+// run on async_tcp, pulls on the ota_pull task).
+typedef uint32_t OtaToken;   // 0 = none
+
+enum OtaBeginResult : uint8_t {
+    OTA_STARTED = 0,
+    OTA_BUSY,                 // Another update is running (left untouched)
+    OTA_FAILED,               // See ota_last_error()
+};
+
+// Start an update. `size` may be 0 if unknown. `sha256Hex` is the expected
+// digest (64 hex chars); required unless OTA_REQUIRE_SHA256 is 0. `version`
+// (optional) is the firmware version of the image, recorded for rollbacks.
+OtaBeginResult ota_begin(OtaToken &token, size_t size, const char *sha256Hex,
+                         const char *version = nullptr);
+
+// Stream a chunk; returns false (and aborts) on a write error or a stale token
+bool ota_write(OtaToken token, const uint8_t *data, size_t len);
+
+// Verify the digest and finalize. True = image activated, reboot to run it.
+bool ota_end(OtaToken token);
+
+// Abandon the update `token` started (no-op once it has ended)
+void ota_abort(OtaToken token, const char *reason);
+
+bool ota_in_progress();
+
+// Error from the last attempt, or nullptr if it succeeded
+const char* ota_last_error();
+
+// Version of the last image the bootloader rolled back ("" if none / unknown)
+const char* ota_rolled_back_version();
+
+// Reboot from the main loop after OTA_REBOOT_DELAY_MS (lets the HTTP reply go out)
+void ota_request_reboot();
+
+// Call from loop() — performs a requested reboot
+void ota_poll();
+
+// Stats of the last update + fleet counters
+String ota_report_json();
+void ota_report_metrics(Print &out);
@@ -0,0 +1,288 @@
+#include "ota_pull.h"
+#include "ota_manager.h"
+#include "delta_patch.h"
+#include "config.h"
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static TaskHandle_t pullTask = nullptr;
+static portMUX_TYPE pullMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Configuration — written by the loop, read by the task (pullMux)
+static char baseUrl[96] = "";
+static bool autoCheck = false;
+
+// Status — written by the task, read by the web server
+enum PullState : uint8_t { PULL_IDLE = 0, PULL_CHECKING, PULL_DOWNLOADING, PULL_UP_TO_DATE, PULL_SKIPPED, PULL_INSTALLED, PULL_ERROR };
+static const char* const STATE_NAMES[] = { "idle", "checking", "downloading", "up-to-date", "skipped", "installed", "error" };
+
+static volatile PullState state = PULL_IDLE;
+static char availableVersion[16] = "";
+static char lastError[48] = "";
+static unsigned long lastCheckMs = 0;
+static volatile bool usingDelta = false;
+static volatile uint32_t transferSize = 0;   // Bytes on the wire
+static volatile uint32_t transferDone = 0;
+static uint32_t imageSize = 0;                // Bytes written to flash
+static OtaToken otaToken = 0;                 // Our update in ota_manager
+
+// Running image
+static const esp_partition_t *running = nullptr;
+static char runningId[65] = "";
+
+static uint8_t netBuf[OTA_PULL_CHUNK];
+
+static void set_error(const char *msg) {
+    strlcpy(lastError, msg, sizeof(lastError));
+    state = PULL_ERROR;
+    Serial.printf("[PULL] %s\n", msg);
+}
+
+// --- Compare dotted numeric versions ("1.0.10" > "1.0.9"); <0, 0, >0 ---
+// Missing components count as 0; anything after a component's digits
+// ("-rc1") is ignored.
+static int version_compare(const char *a, const char *b) {
+    while (*a || *b) {
+        char *end;
+        unsigned long x = strtoul(a, &end, 10);
+        a = end;
+        unsigned long y = strtoul(b, &end, 10);
+        b = end;
+        if (x != y) return x < y ? -1 : 1;
+        while (*a && *a != '.') a++;
+        while (*b && *b != '.') b++;
+        if (*a) a++;
+        if (*b) b++;
+    }
+    return 0;
+}
+
+// --- Resolve a manifest URL against the server base ---
+static String resolve_url(const String &base, const char *ref) {
+    if (strncmp(ref, "http://", 7) == 0 || strncmp(ref, "https://", 8) == 0) return ref;
+    return base + ref;
+}
+
+// --- Id of the running image (matches image_id() in update_server.py) ---
+static void compute_running_id() {
+    if (runningId[0]) return;
+    running = esp_ota_get_running_partition();
+    uint8_t sha[32];
+    if (!running || esp_partition_get_sha256(running, sha) != ESP_OK) return;
+    for (int i = 0; i < 32; i++) sprintf(runningId + i * 2, "%02x", sha[i]);
+}
+
+// --- delta_patch callbacks ---
+static bool read_running(uint32_t offset, uint8_t *buf, size_t len) {
+    return esp_partition_read(running, offset, buf, len) == ESP_OK;
+}
+
+static bool write_image(const uint8_t *data, size_t len) {
+    imageSize += len;
+    return ota_write(otaToken, data, len);
+}
+
+// --- Stream a file from the server into the OTA pipeline ---
+static bool download(const String &url, uint32_t size, bool delta) {
+    HTTPClient http;
+    http.setTimeout(OTA_PULL_TIMEOUT_MS);
+    if (!http.begin(url)) {
+        set_error("bad download url");
+        return false;
+    }
+    int code = http.GET();
+    if (code != HTTP_CODE_OK) {
+        http.end();
+        set_error("download failed");
+        return false;
+    }
+
+    WiFiClient *stream = http.getStreamPtr();
+    unsigned long lastData = millis();
+    bool ok = true;
+
+    while (transferDone < size) {
+        int avail = stream->available();
+        if (avail <= 0) {
+            if (!http.connected() || millis() - lastData > OTA_PULL_TIMEOUT_MS) {
+                set_error("download stalled");
+                ok = false;
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(5));
+            continue;
+        }
+
+        size_t n = stream->readBytes(netBuf, min((size_t)avail, sizeof(netBuf)));
+        lastData = millis();
+        transferDone += n;
+
+        ok = delta ? delta_feed(netBuf, n) : write_image(netBuf, n);
+        if (!ok) {
+            set_error(delta ? delta_error() : "flash write failed");
+            break;
+        }
+        taskYIELD();
+    }
+    http.end();
+
+    if (ok && delta && !delta_finish()) {
+        set_error(delta_error());
+        ok = false;
+    }
+    return ok;
+}
+
+// --- One manifest check; installs if a newer version is offered ---
+static void check_and_update(const String &base) {
+    state = PULL_CHECKING;
+    lastCheckMs = millis();
+
+    HTTPClient http;
+    http.setTimeout(OTA_PULL_TIMEOUT_MS);
+    if (!http.begin(base + "manifest.json") || http.GET() != HTTP_CODE_OK) {
+        http.end();
+        set_error("manifest unavailable");
+        return;
+    }
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, http.getString());
+    http.end();
+    if (err || !doc["version"].is<const char*>()) {
+        set_error("bad manifest");
+        return;
+    }
+
+    strlcpy(availableVersion, doc["version"] | "", sizeof(availableVersion));
+    if (version_compare(availableVersion, FW_VERSION) <= 0) {
+        state = PULL_UP_TO_DATE;
+        return;
+    }
+    // Booted once and rolled back — wait for a newer release
+    if (strcmp(availableVersion, ota_rolled_back_version()) == 0) {
+        state = PULL_SKIPPED;
+        Serial.printf("[PULL] Skipping %s: it was rolled back\n", availableVersion);
+        return;
+    }
+
+    // Prefer a delta against the running image
+    compute_running_id();
+    JsonObject chosen = doc["full"];
+    bool delta = false;
+    for (JsonObject d : doc["deltas"].as<JsonArray>()) {
+        if (runningId[0] && strcmp(d["from"] | "", runningId) == 0) {
+            chosen = d;
+            delta = true;
+            break;
+        }
+    }
+
+    const char *url = chosen["url"] | "";
+    const char *sha = chosen["sha256"] | "";
+    uint32_t newSize = doc["full"]["size"] | 0;
+    if (!*url || newSize == 0) {
+        set_error("manifest missing image");
+        return;
+    }
+    // ota_begin decides: an upload may have started since the manifest fetch
+    OtaBeginResult begun = ota_begin(otaToken, newSize, sha, availableVersion);
+    if (begun == OTA_BUSY) {
+        set_error("another update is running");
+        return;
+    }
+    if (begun != OTA_STARTED) {
+        set_error(ota_last_error() ? ota_last_error() : "ota begin failed");
+        return;
+    }
+
+    usingDelta = delta;
+    transferSize = chosen["size"] | 0;
+    transferDone = 0;
+    imageSize = 0;
+    state = PULL_DOWNLOADING;
+    Serial.printf("[PULL] %s -> %s via %s (%u bytes)\n", FW_VERSION, availableVersion,
+                  delta ? "delta" : "full image", transferSize);
+
+    if (delta) delta_begin(read_running, running->size, write_image, newSize);
+
+    if (!download(resolve_url(base, url), transferSize, delta)) {
+        ota_abort(otaToken, lastError);
+        return;
+    }
+    if (!ota_end(otaToken)) {
+        set_error(ota_last_error() ? ota_last_error() : "verify failed");
+        return;
+    }
+
+    state = PULL_INSTALLED;
+    Serial.printf("[PULL] Installed %s: %u bytes transferred for a %u byte image\n",
+                  availableVersion, transferDone, imageSize);
+    ota_request_reboot();
+}
+
+// --- Background task: sleeps until the check interval or a manual check ---
+static void pull_task(void *arg) {
+    TickType_t wait = pdMS_TO_TICKS(OTA_PULL_FIRST_CHECK_MS);
+    for (;;) {
+        bool manual = ulTaskNotifyTake(pdTRUE, wait) > 0;
+
+        char url[sizeof(baseUrl)];
+        portENTER_CRITICAL(&pullMux);
+        strlcpy(url, baseUrl, sizeof(url));
+        bool periodic = autoCheck;
+        portEXIT_CRITICAL(&pullMux);
+
+        wait = periodic ? pdMS_TO_TICKS(OTA_PULL_INTERVAL_MS) : portMAX_DELAY;
+        if (!url[0] || (!manual && !periodic)) continue;
+        if (WiFi.status() != WL_CONNECTED) continue;
+
+        String base(url);
+        if (!base.endsWith("/")) base += "/";
+        check_and_update(base);
+    }
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void ota_pull_init(const char *url, bool periodic) {
+    ota_pull_configure(url, periodic);
+    if (!pullTask) {
+        xTaskCreatePinnedToCore(pull_task, "ota_pull", 8192, nullptr, 1, &pullTask, 0);
+    }
+}
+
+void ota_pull_configure(const char *url, bool periodic) {
+    portENTER_CRITICAL(&pullMux);
+    strlcpy(baseUrl, url, sizeof(baseUrl));
+    autoCheck = periodic;
+    portEXIT_CRITICAL(&pullMux);
+}
+
+void ota_pull_check_now() {
+    if (pullTask) xTaskNotifyGive(pullTask);
+}
+
+String ota_pull_status_json() {
+    JsonDocument doc;
+
+    doc["state"]     = STATE_NAMES[state];
+    doc["running"]   = FW_VERSION;
+    doc["available"] = availableVersion;
+    doc["delta"]     = usingDelta;
+    doc["size"]      = transferSize;
+    doc["done"]      = transferDone;
+    doc["image"]     = imageSize;
+    if (lastCheckMs) doc["checked_s_ago"] = (millis() - lastCheckMs) / 1000;
+    if (state == PULL_ERROR) doc["error"] = lastError;
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
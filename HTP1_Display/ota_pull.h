@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Pull OTA — checks a local update server for a newer firmware and installs
+// it in the background (see tools/update_server.py).
+//
+// A low-priority task on core 0 fetches <url>/manifest.json, prefers a
+// delta patch built against the running image (matched by its SHA-256) and
+// falls back to the full image. Downloads stream through ota_manager, so
+// the SHA-256 check, stats and rollback apply exactly as for uploads.
+
+// Start the background task (call once in setup)
+void ota_pull_init(const char *url, bool autoCheck);
+
+// Update server base URL / periodic checking (e.g. after settings change)
+void ota_pull_configure(const char *url, bool autoCheck);
+
+// Check the server now (web UI "Check now")
+void ota_pull_check_now();
+
+// Check / download status as JSON (for the /ota/pull endpoint)
+String ota_pull_status_json();
@@ -0,0 +1,267 @@
+#include "power_manager.h"
+#include "config.h"
+#include "htp1_client.h"
+#include "button_handler.h"
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include <esp_wifi.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_idf_version.h>
+#include <driver/gpio.h>
+
+// --- Estimated current per mode (mA) ---
+// Typical figures for the T-Display-S3 AMOLED: RM67162 panel with mostly
+// black content plus ESP32-S3 at 240 MHz with WiFi associated. These are
+// budget estimates, not measurements — check a unit with a USB power meter.
+struct ModeBudget {
+    const char* name;
+    uint16_t mA;           // Low-power mode off
+    uint16_t mA_lowPower;  // Low-power mode on (DFS, modem sleep, light sleep)
+};
+
+static const ModeBudget BUDGET[PWR_MODE_COUNT] = {
+    { "active", 95, 80 },  // Panel ~35 mA + CPU/radio ~60 mA (DFS trims idle CPU)
+    { "dimmed", 70, 55 },  // Panel ~10 mA at dim brightness
+    { "sleep",  62, 4  },  // Panel off; light sleep + DTIM listen interval
+};
+
+static bool lowPower = false;
+static bool lightSleepAvailable = false;
+static PowerMode curMode = PWR_ACTIVE;
+static unsigned long modeSince = 0;
+static unsigned long modeTimeMs[PWR_MODE_COUNT] = { 0 };
+static unsigned long lastReport = 0;
+
+// Mode times and wake stats are written by the loop and read by the
+// /power handler on the web server task
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Wake latency (button / data → first pixel)
+static unsigned long wakeStartUs = 0;
+static uint32_t wakeCount = 0;
+static uint32_t wakeLastUs = 0;
+static uint32_t wakeMaxUs = 0;
+static uint64_t wakeTotalUs = 0;
+
+// --- Dynamic frequency scaling + automatic light sleep ---
+// Light sleep needs CONFIG_FREERTOS_USE_TICKLESS_IDLE in the core's sdkconfig.
+// If it isn't available we still get DFS and WiFi modem sleep.
+static bool configure_pm(bool lightSleep) {
+#if CONFIG_PM_ENABLE
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    esp_pm_config_t pm = {};
+#else
+    esp_pm_config_esp32s3_t pm = {};
+#endif
+    pm.max_freq_mhz = POWER_CPU_MAX_MHZ;
+    pm.min_freq_mhz = POWER_CPU_MIN_MHZ;
+    pm.light_sleep_enable = lightSleep;
+
+    esp_err_t err = esp_pm_configure(&pm);
+    if (err != ESP_OK) {
+        Serial.printf("[PWR] esp_pm_configure(light_sleep=%d) failed: %s\n",
+                      lightSleep, esp_err_to_name(err));
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+// --- Button GPIOs as light-sleep wake sources (buttons are active-low) ---
+static void enable_button_wake(bool enable) {
+    if (enable) {
+        gpio_wakeup_enable((gpio_num_t)PIN_BUTTON_1, GPIO_INTR_LOW_LEVEL);
+        gpio_wakeup_enable((gpio_num_t)PIN_BUTTON_2, GPIO_INTR_LOW_LEVEL);
+        esp_sleep_enable_gpio_wakeup();
+    } else {
+        gpio_wakeup_disable((gpio_num_t)PIN_BUTTON_1);
+        gpio_wakeup_disable((gpio_num_t)PIN_BUTTON_2);
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+    }
+}
+
+static void enter_sleep() {
+    buttons_suspend_irq();  // Level wake would retrigger the edge ISR while held
+    enable_button_wake(true);
+    WiFi.setSleep(WIFI_PS_MAX_MODEM);
+    lightSleepAvailable = configure_pm(true);
+    if (!lightSleepAvailable) configure_pm(false);
+    htp1_set_low_power(true);
+}
+
+static void exit_sleep() {
+    configure_pm(false);
+    WiFi.setSleep(WIFI_PS_MIN_MODEM);
+    enable_button_wake(false);
+    buttons_rearm_irq();    // gpio_wakeup_disable cleared the edge interrupt type
+    htp1_set_low_power(false);
+}
+
+static void account_mode_time() {
+    unsigned long now = millis();
+    portENTER_CRITICAL(&statsMux);
+    modeTimeMs[curMode] += now - modeSince;
+    modeSince = now;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+// Consistent copy of the report figures, including time in the current
+// mode so far — reports never write the shared counters
+struct PowerStats {
+    unsigned long modeMs[PWR_MODE_COUNT];
+    unsigned long totalMs;
+    PowerMode mode;
+    uint32_t wakeCount, wakeLastUs, wakeMaxUs;
+    uint64_t wakeTotalUs;
+};
+
+static void snapshot(PowerStats &st) {
+    unsigned long now = millis();
+    portENTER_CRITICAL(&statsMux);
+    memcpy(st.modeMs, modeTimeMs, sizeof(st.modeMs));
+    st.modeMs[curMode] += now - modeSince;
+    st.mode        = curMode;
+    st.wakeCount   = wakeCount;
+    st.wakeLastUs  = wakeLastUs;
+    st.wakeMaxUs   = wakeMaxUs;
+    st.wakeTotalUs = wakeTotalUs;
+    portEXIT_CRITICAL(&statsMux);
+
+    st.totalMs = 0;
+    for (int i = 0; i < PWR_MODE_COUNT; i++) st.totalMs += st.modeMs[i];
+    if (st.totalMs == 0) st.totalMs = 1;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void power_prepare_sta() {
+    // Only max modem sleep uses it, so it is set on every connect and
+    // toggling low-power mode never needs a reassociation
+    wifi_config_t conf;
+    if (esp_wifi_get_config(WIFI_IF_STA, &conf) != ESP_OK) return;
+    conf.sta.listen_interval = WIFI_LISTEN_INTERVAL;
+    esp_wifi_set_config(WIFI_IF_STA, &conf);
+}
+
+void power_init(bool lowPowerEnabled) {
+    modeSince = millis();
+    lastReport = modeSince;
+    lowPower = lowPowerEnabled;
+
+    if (!lowPower) return;
+    configure_pm(false);
+    Serial.println("[PWR] Low-power mode enabled");
+}
+
+void power_set_low_power(bool enabled) {
+    if (enabled == lowPower) return;
+    lowPower = enabled;
+
+    if (enabled) {
+        configure_pm(false);
+        if (curMode == PWR_SLEEP) enter_sleep();
+    } else if (curMode == PWR_SLEEP) {
+        exit_sleep();
+    }
+    Serial.printf("[PWR] Low-power mode %s\n", enabled ? "enabled" : "disabled");
+}
+
+void power_set_mode(PowerMode mode) {
+    if (mode == curMode) return;
+    account_mode_time();
+
+    PowerMode prev = curMode;
+    portENTER_CRITICAL(&statsMux);
+    curMode = mode;
+    portEXIT_CRITICAL(&statsMux);
+
+    if (!lowPower) return;
+    if (mode == PWR_SLEEP) enter_sleep();
+    else if (prev == PWR_SLEEP) exit_sleep();
+}
+
+void power_wake_begin() {
+    wakeStartUs = micros();
+}
+
+void power_wake_first_pixel() {
+    if (wakeStartUs == 0) return;
+    uint32_t us = micros() - wakeStartUs;
+    wakeStartUs = 0;
+
+    portENTER_CRITICAL(&statsMux);
+    wakeCount++;
+    wakeLastUs = us;
+    wakeTotalUs += us;
+    if (us > wakeMaxUs) wakeMaxUs = us;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+void power_idle() {
+    if (!lowPower) return;
+    htp1_wait_for_data(POWER_IDLE_WAIT_MS);
+}
+
+void power_poll() {
+    if (millis() - lastReport < POWER_REPORT_INTERVAL_MS) return;
+    lastReport = millis();
+    power_report(Serial);
+}
+
+void power_report(Print &out) {
+    PowerStats st;
+    snapshot(st);
+
+    float avg_mA = 0;
+    out.printf("[PWR] Budget (low-power %s, light sleep %s):\n",
+               lowPower ? "on" : "off", lightSleepAvailable ? "yes" : "n/a");
+    for (int i = 0; i < PWR_MODE_COUNT; i++) {
+        uint16_t mA = lowPower ? BUDGET[i].mA_lowPower : BUDGET[i].mA;
+        float share = (float)st.modeMs[i] / st.totalMs;
+        avg_mA += mA * share;
+        out.printf("[PWR]   %-7s ~%3u mA  %7lus  %5.1f%%\n",
+                   BUDGET[i].name, mA, st.modeMs[i] / 1000, share * 100.0f);
+    }
+    out.printf("[PWR]   average ~%.1f mA\n", avg_mA);
+    out.printf("[PWR] Wake-to-pixel: n=%u last=%.1fms avg=%.1fms max=%.1fms\n",
+               st.wakeCount, st.wakeLastUs / 1000.0f,
+               st.wakeCount ? (float)(st.wakeTotalUs / st.wakeCount) / 1000.0f : 0.0f,
+               st.wakeMaxUs / 1000.0f);
+}
+
+String power_report_json() {
+    PowerStats st;
+    snapshot(st);
+
+    JsonDocument doc;
+    doc["lowPower"]   = lowPower;
+    doc["lightSleep"] = lightSleepAvailable;
+    doc["mode"]       = BUDGET[st.mode].name;
+
+    float avg_mA = 0;
+    JsonArray modes = doc["modes"].to<JsonArray>();
+    for (int i = 0; i < PWR_MODE_COUNT; i++) {
+        uint16_t mA = lowPower ? BUDGET[i].mA_lowPower : BUDGET[i].mA;
+        JsonObject m = modes.add<JsonObject>();
+        m["name"] = BUDGET[i].name;
+        m["mA"]   = mA;
+        m["secs"] = st.modeMs[i] / 1000;
+        avg_mA += mA * (float)st.modeMs[i] / st.totalMs;
+    }
+    doc["avg_mA"] = avg_mA;
+
+    JsonObject wake = doc["wake"].to<JsonObject>();
+    wake["count"]   = st.wakeCount;
+    wake["last_ms"] = st.wakeLastUs / 1000.0f;
+    wake["avg_ms"]  = st.wakeCount ? (float)(st.wakeTotalUs / st.wakeCount) / 1000.0f : 0.0f;
+    wake["max_ms"]  = st.wakeMaxUs / 1000.0f;
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
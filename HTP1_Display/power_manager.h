@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Power states tracked for the power-budget report
+enum PowerMode : uint8_t {
+    PWR_ACTIVE = 0,   // Display on at the configured brightness
+    PWR_DIMMED,       // Display on, auto-dimmed
+    PWR_SLEEP,        // Display off (light sleep when low-power mode is on)
+    PWR_MODE_COUNT
+};
+
+// Set the STA's DTIM listen interval. The driver only reads it when it
+// associates, so call it after WiFi.begin(..., connect = false) and before
+// esp_wifi_connect().
+void power_prepare_sta();
+
+// Initialize power management (call once in setup, after WiFi is up)
+void power_init(bool lowPowerEnabled);
+
+// Enable / disable low-power mode at runtime (e.g. after settings change)
+void power_set_low_power(bool enabled);
+
+// Record a power state transition. Entering / leaving PWR_SLEEP switches
+// automatic light sleep, WiFi modem sleep and the button wake sources.
+void power_set_mode(PowerMode mode);
+
+// Mark the start of a wake-up (button press or HTP-1 data while asleep)
+void power_wake_begin();
+
+// Mark the first pixel visible after a wake-up — closes the latency sample
+void power_wake_first_pixel();
+
+// Idle the main loop while asleep. Blocks until HTP-1 TCP data arrives or
+// POWER_IDLE_WAIT_MS elapses, letting the CPU drop into light sleep.
+void power_idle();
+
+// Call from loop() — prints the power-budget report periodically
+void power_poll();
+
+// Print the power-budget report (estimated current per mode, wake latency)
+void power_report(Print &out);
+
+// Power-budget report as JSON (for the /power endpoint)
+String power_report_json();
@@ -0,0 +1,178 @@
+#include "profiler.h"
+
+#if LOOP_PROFILER
+
+#include <atomic>
+#include <esp_timer.h>
+
+static const char* const PHASE_NAMES[LP_COUNT + 1] = {
+    "settings", "buttons", "htp1", "render", "autodim", "anim", "web", "nvs", "ota", "power", "idle"
+};
+
+// Histogram upper bounds in µs — the last bucket is +Inf
+static const uint32_t BUCKET_US[] = { 50, 200, 1000, 5000, 20000, 100000 };
+#define PROF_BUCKETS (sizeof(BUCKET_US) / sizeof(BUCKET_US[0]) + 1)
+
+// Written by the loop task only. The 64-bit sums are guarded by sumLock so
+// a /metrics scrape never reads a torn value.
+struct PhaseStats {
+    std::atomic<uint32_t> hist[PROF_BUCKETS];   // Per-pass phase time
+    uint64_t sumUs;                             // sumLock
+    std::atomic<uint32_t> stalls;               // Stalls where this phase took the most time
+    uint32_t windowMaxUs;                       // Serial report window
+    uint64_t windowUs;
+};
+
+static PhaseStats phases[LP_COUNT];
+static portMUX_TYPE sumLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Sampler: which phase the loop is in, every PROF_SAMPLE_US
+static std::atomic<uint32_t> samples[LP_COUNT + 1];
+static uint32_t windowSamples[LP_COUNT + 1];   // Counts at the last serial report
+static esp_timer_handle_t sampleTimer = nullptr;
+
+// Current pass
+static volatile LoopPhase curPhase = LP_IDLE;
+static int64_t markUs = 0;
+static int64_t passStartUs = 0;
+static uint32_t passUs[LP_COUNT];
+
+static unsigned long lastReport = 0;
+static uint32_t windowPasses = 0;
+static uint32_t windowStalls = 0;
+
+// Runs in the esp_timer task — one relaxed add
+static void sample_cb(void *arg) {
+    samples[curPhase].fetch_add(1, std::memory_order_relaxed);
+}
+
+static void record(LoopPhase p, uint32_t us) {
+    PhaseStats &ph = phases[p];
+    int b = 0;
+    while (b < (int)PROF_BUCKETS - 1 && us > BUCKET_US[b]) b++;
+    ph.hist[b].fetch_add(1, std::memory_order_relaxed);
+    portENTER_CRITICAL(&sumLock);
+    ph.sumUs += us;
+    portEXIT_CRITICAL(&sumLock);
+    if (us > ph.windowMaxUs) ph.windowMaxUs = us;
+    ph.windowUs += us;
+}
+
+static void report_serial() {
+    if (millis() - lastReport < PROF_REPORT_INTERVAL_MS) return;
+    lastReport = millis();
+    if (windowPasses == 0) return;
+
+    uint32_t sampleDelta[LP_COUNT + 1];
+    uint32_t sampleTotal = 0;
+    for (int i = 0; i <= LP_COUNT; i++) {
+        uint32_t n = samples[i].load(std::memory_order_relaxed);
+        sampleDelta[i] = n - windowSamples[i];
+        windowSamples[i] = n;
+        sampleTotal += sampleDelta[i];
+    }
+
+    Serial.printf("[PROF] %u passes, %u stalls (>%u us)\n", windowPasses, windowStalls, PROF_STALL_US);
+    for (int i = 0; i < LP_COUNT; i++) {
+        PhaseStats &ph = phases[i];
+        Serial.printf("[PROF]   %-8s avg %6u us  max %7u us  samples %5.1f%%\n", PHASE_NAMES[i],
+                      (uint32_t)(ph.windowUs / windowPasses), ph.windowMaxUs,
+                      sampleTotal ? sampleDelta[i] * 100.0f / sampleTotal : 0.0f);
+        ph.windowMaxUs = 0;
+        ph.windowUs = 0;
+    }
+    Serial.printf("[PROF]   %-8s samples %5.1f%%\n", PHASE_NAMES[LP_IDLE],
+                  sampleTotal ? sampleDelta[LP_IDLE] * 100.0f / sampleTotal : 0.0f);
+    windowPasses = 0;
+    windowStalls = 0;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void prof_init() {
+    esp_timer_create_args_t args = {};
+    args.callback = sample_cb;
+    args.name = "prof_sample";
+    if (esp_timer_create(&args, &sampleTimer) == ESP_OK) {
+        esp_timer_start_periodic(sampleTimer, PROF_SAMPLE_US);
+    }
+    lastReport = millis();
+    Serial.printf("[PROF] Loop profiler on: stall > %u us, sampling every %u us\n",
+                  PROF_STALL_US, PROF_SAMPLE_US);
+}
+
+void prof_loop_begin() {
+    memset(passUs, 0, sizeof(passUs));
+    passStartUs = esp_timer_get_time();
+    markUs = passStartUs;
+}
+
+void prof_phase(LoopPhase next) {
+    // esp_timer counts real µs whatever the CPU clock does (DFS / light sleep)
+    int64_t now = esp_timer_get_time();
+    if (curPhase != LP_IDLE) passUs[curPhase] += (uint32_t)(now - markUs);
+    markUs = now;
+    curPhase = next;
+}
+
+void prof_loop_end() {
+    prof_phase(LP_IDLE);
+    uint32_t totalUs = (uint32_t)(markUs - passStartUs);
+
+    int worst = 0;
+    for (int i = 0; i < LP_COUNT; i++) {
+        record((LoopPhase)i, passUs[i]);
+        if (passUs[i] > passUs[worst]) worst = i;
+    }
+    windowPasses++;
+
+    if (totalUs > PROF_STALL_US) {
+        phases[worst].stalls.fetch_add(1, std::memory_order_relaxed);
+        windowStalls++;
+        Serial.printf("[PROF] Stall: loop pass %u us, %s took %u us\n",
+                      totalUs, PHASE_NAMES[worst], passUs[worst]);
+    }
+    report_serial();
+}
+
+void prof_report_metrics(Print &out) {
+    out.printf("# HELP htp1_loop_phase_seconds Time per main loop pass spent in each phase\n"
+               "# TYPE htp1_loop_phase_seconds histogram\n");
+    for (int i = 0; i < LP_COUNT; i++) {
+        PhaseStats &ph = phases[i];
+        uint32_t cum = 0;
+        for (int b = 0; b < (int)PROF_BUCKETS; b++) {
+            cum += ph.hist[b].load(std::memory_order_relaxed);
+            if (b < (int)PROF_BUCKETS - 1) {
+                out.printf("htp1_loop_phase_seconds_bucket{phase=\"%s\",le=\"%g\"} %u\n",
+                           PHASE_NAMES[i], BUCKET_US[b] / 1e6, cum);
+            } else {
+                out.printf("htp1_loop_phase_seconds_bucket{phase=\"%s\",le=\"+Inf\"} %u\n",
+                           PHASE_NAMES[i], cum);
+            }
+        }
+        portENTER_CRITICAL(&sumLock);
+        uint64_t sumUs = ph.sumUs;
+        portEXIT_CRITICAL(&sumLock);
+        out.printf("htp1_loop_phase_seconds_sum{phase=\"%s\"} %.6f\n", PHASE_NAMES[i], sumUs / 1e6);
+        out.printf("htp1_loop_phase_seconds_count{phase=\"%s\"} %u\n", PHASE_NAMES[i], cum);
+    }
+
+    out.printf("# HELP htp1_loop_phase_samples_total Sampler hits per loop phase (every %u us)\n"
+               "# TYPE htp1_loop_phase_samples_total counter\n", PROF_SAMPLE_US);
+    for (int i = 0; i <= LP_COUNT; i++) {
+        out.printf("htp1_loop_phase_samples_total{phase=\"%s\"} %u\n", PHASE_NAMES[i],
+                   samples[i].load(std::memory_order_relaxed));
+    }
+
+    out.printf("# HELP htp1_loop_stalls_total Loop passes over %u us, by the phase that took longest\n"
+               "# TYPE htp1_loop_stalls_total counter\n", PROF_STALL_US);
+    for (int i = 0; i < LP_COUNT; i++) {
+        out.printf("htp1_loop_stalls_total{phase=\"%s\"} %u\n", PHASE_NAMES[i],
+                   phases[i].stalls.load(std::memory_order_relaxed));
+    }
+}
+
+#endif // LOOP_PROFILER
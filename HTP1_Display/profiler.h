@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+// Main-loop profiler (LOOP_PROFILER in config.h).
+//
+// loop() is split into phases with PROF_PHASE() marks. Each mark closes the
+// running phase, adding its esp_timer duration to a per-pass total; at
+// PROF_LOOP_END() every phase's total goes into a fixed-bucket histogram.
+// A pass longer than PROF_STALL_US is logged with the phase that took the
+// most time. Independently, a PROF_SAMPLE_US timer samples which phase the
+// loop is in, which also catches a phase that never returns.
+//
+// With LOOP_PROFILER 0 the macros expand to nothing and no code or RAM is
+// used.
+
+enum LoopPhase : uint8_t {
+    LP_SETTINGS = 0,  // OTA confirm + deferred settings apply
+    LP_BUTTONS,
+    LP_HTP1,          // WebSocket / HTTP polling
+    LP_RENDER,        // Redraws on new data + periodic re-render
+    LP_AUTODIM,
+    LP_ANIM,          // display_tick
+    LP_WEB,           // SSE push
+    LP_NVS,           // Delayed settings save
+    LP_OTA,
+    LP_POWER,
+    LP_COUNT,
+    LP_IDLE = LP_COUNT  // Between passes (power_idle, Arduino core)
+};
+
+#if LOOP_PROFILER
+
+void prof_init();
+void prof_loop_begin();
+void prof_phase(LoopPhase next);
+void prof_loop_end();
+
+// Phase histograms, sampler hits and stalls in Prometheus text format
+void prof_report_metrics(Print &out);
+
+#define PROF_INIT()        prof_init()
+#define PROF_LOOP_BEGIN()  prof_loop_begin()
+#define PROF_PHASE(p)      prof_phase(p)
+#define PROF_LOOP_END()    prof_loop_end()
+
+#else
+
+#define PROF_INIT()        ((void)0)
+#define PROF_LOOP_BEGIN()  ((void)0)
+#define PROF_PHASE(p)      ((void)0)
+#define PROF_LOOP_END()    ((void)0)
+
+#endif
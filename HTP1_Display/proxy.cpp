@@ -0,0 +1,276 @@
+#include "proxy.h"
+#include "config.h"
+#include "htp1_client.h"
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <atomic>
+
+static AsyncWebSocket ws(HTP1_WS_PATH);
+static volatile bool enabled = false;
+
+// --- Local clients ---
+// Written by async_tcp (connect / disconnect / getmso), read by the loop
+// when fanning out (clientMux).
+struct ProxyClient {
+    uint32_t id;            // 0 = free slot
+    bool needSnapshot;      // Waiting for an mso dump (new, or fell behind)
+};
+static ProxyClient clients[PROXY_MAX_CLIENTS];
+static portMUX_TYPE clientMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool snapshotWanted = false;
+static unsigned long lastSnapshotReq = 0;
+
+// --- Client -> HTP-1 messages (async_tcp -> loop) ---
+struct ProxyCmd {
+    char text[PROXY_CMD_MAX_LEN];
+};
+static QueueHandle_t cmdQueue = nullptr;
+static ProxyCmd cmdBuf;
+
+// --- Last /ircmd payload (written by the loop, served by async_tcp) ---
+static String ircmdCache;
+static unsigned long ircmdCacheMs = 0;
+static SemaphoreHandle_t cacheLock = nullptr;
+
+// --- Stats ---
+// Bumped from async_tcp (and cmdsDropped from the loop too)
+static std::atomic<uint32_t> connects{0};
+static std::atomic<uint32_t> rejects{0};
+static std::atomic<uint32_t> cmdsDropped{0};
+static std::atomic<uint32_t> ircmdServed{0};
+// Loop only
+static uint32_t framesForwarded = 0;
+static uint32_t framesDropped = 0;
+static uint32_t snapshotsSent = 0;
+static uint32_t snapshotRequests = 0;
+static uint32_t cmdsForwarded = 0;
+
+static bool add_client(uint32_t id) {
+    bool added = false;
+    portENTER_CRITICAL(&clientMux);
+    for (ProxyClient &c : clients) {
+        if (c.id == 0) {
+            c.id = id;
+            c.needSnapshot = true;
+            added = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&clientMux);
+    if (added) snapshotWanted = true;
+    return added;
+}
+
+static void remove_client(uint32_t id) {
+    portENTER_CRITICAL(&clientMux);
+    for (ProxyClient &c : clients) {
+        if (c.id == id) c.id = 0;
+    }
+    portEXIT_CRITICAL(&clientMux);
+}
+
+static void mark_lagging(uint32_t id) {
+    portENTER_CRITICAL(&clientMux);
+    for (ProxyClient &c : clients) {
+        if (c.id == id) c.needSnapshot = true;
+    }
+    portEXIT_CRITICAL(&clientMux);
+    snapshotWanted = true;
+}
+
+// --- WebSocket events (async_tcp task) ---
+static void onWsEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
+                      AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    if (type == WS_EVT_CONNECT) {
+        if (!enabled || !add_client(client->id())) {
+            rejects++;
+            client->close(1013, "proxy unavailable");
+            return;
+        }
+        connects++;
+        Serial.printf("[PROXY] Client %u connected from %s\n",
+                      client->id(), client->remoteIP().toString().c_str());
+    } else if (type == WS_EVT_DISCONNECT) {
+        remove_client(client->id());
+    } else if (type == WS_EVT_DATA) {
+        // HTP-1 commands are short: only whole, unfragmented text messages
+        AwsFrameInfo *info = (AwsFrameInfo*)arg;
+        if (!info->final || info->index != 0 || info->len != len || info->opcode != WS_TEXT) return;
+
+        // Full dumps come from the shared upstream connection
+        if (len == 6 && memcmp(data, "getmso", 6) == 0) {
+            mark_lagging(client->id());
+            return;
+        }
+        if (len >= PROXY_CMD_MAX_LEN) {
+            cmdsDropped++;
+            return;
+        }
+        ProxyCmd cmd;
+        memcpy(cmd.text, data, len);
+        cmd.text[len] = '\0';
+        if (xQueueSend(cmdQueue, &cmd, 0) != pdTRUE) cmdsDropped++;
+    }
+}
+
+// --- Upstream WebSocket frame (loop, from htp1_client) ---
+// Clients belong to async_tcp and can be freed there at any time, so the
+// fan-out only uses the id-based calls, which look the client up under the
+// library's own lock. A client whose send queue is full counts as lagging.
+static void on_upstream_frame(const String &frame) {
+    if (!enabled || ws.count() == 0) return;
+    bool snapshot = frame.startsWith("mso ");
+
+    ProxyClient snap[PROXY_MAX_CLIENTS];
+    portENTER_CRITICAL(&clientMux);
+    memcpy(snap, clients, sizeof(snap));
+    portEXIT_CRITICAL(&clientMux);
+
+    bool stillWaiting = false;
+    for (const ProxyClient &pc : snap) {
+        if (pc.id == 0) continue;
+
+        // A client that missed patches only resumes on a full dump
+        if (pc.needSnapshot && !snapshot) {
+            framesDropped++;
+            continue;
+        }
+        if (!ws.availableForWrite(pc.id)) {
+            framesDropped++;
+            mark_lagging(pc.id);
+            stillWaiting = true;
+            continue;
+        }
+
+        ws.text(pc.id, frame.c_str(), frame.length());
+        if (snapshot) {
+            snapshotsSent++;
+            portENTER_CRITICAL(&clientMux);
+            for (ProxyClient &cc : clients) {
+                if (cc.id == pc.id) cc.needSnapshot = false;
+            }
+            portEXIT_CRITICAL(&clientMux);
+        } else {
+            framesForwarded++;
+        }
+    }
+    if (snapshot && !stillWaiting) snapshotWanted = false;
+}
+
+// --- Upstream /ircmd payload (loop, from htp1_client) ---
+static void on_upstream_ircmd(const String &payload) {
+    if (!enabled) return;
+    xSemaphoreTake(cacheLock, portMAX_DELAY);
+    ircmdCache = payload;
+    ircmdCacheMs = millis();
+    xSemaphoreGive(cacheLock);
+}
+
+// --- GET /ircmd — served from the display's own last poll ---
+static void handleIrcmd(AsyncWebServerRequest *req) {
+    if (!enabled) {
+        req->send(404, "text/plain", "Proxy mode is off");
+        return;
+    }
+    // IR commands would need the processor itself; only state reads are proxied
+    if (req->args() > 0) {
+        req->send(501, "text/plain", "Only plain /ircmd is proxied");
+        return;
+    }
+    String body;
+    if (xSemaphoreTake(cacheLock, pdMS_TO_TICKS(50)) == pdTRUE) {
+        body = ircmdCache;
+        xSemaphoreGive(cacheLock);
+    }
+    if (body.length() == 0) {
+        req->send(503, "text/plain", "No state from the HTP-1 yet");
+        return;
+    }
+    ircmdServed++;
+    req->send(200, "application/json", body);
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void proxy_begin(AsyncWebServer &server) {
+    cmdQueue = xQueueCreate(PROXY_CMD_QUEUE, sizeof(ProxyCmd));
+    cacheLock = xSemaphoreCreateMutex();
+
+    ws.onEvent(onWsEvent);
+    server.addHandler(&ws);
+    server.on("/ircmd", HTTP_GET, handleIrcmd);
+    htp1_add_hooks(on_upstream_frame, on_upstream_ircmd);
+}
+
+void proxy_set_enabled(bool en) {
+    if (en == enabled) return;
+    enabled = en;
+    if (!en) {
+        ws.closeAll(1001, "proxy disabled");
+        portENTER_CRITICAL(&clientMux);
+        memset(clients, 0, sizeof(clients));
+        portEXIT_CRITICAL(&clientMux);
+        xQueueReset(cmdQueue);
+        xSemaphoreTake(cacheLock, portMAX_DELAY);
+        ircmdCache = String();
+        xSemaphoreGive(cacheLock);
+    }
+    Serial.printf("[PROXY] %s\n", en ? "Enabled on " HTP1_WS_PATH : "Disabled");
+}
+
+void proxy_poll() {
+    if (!enabled) return;
+    ws.cleanupClients(PROXY_MAX_CLIENTS);
+
+    // Client messages go out on the shared upstream connection
+    while (xQueueReceive(cmdQueue, &cmdBuf, 0) == pdTRUE) {
+        if (htp1_send_raw(cmdBuf.text)) cmdsForwarded++;
+        else cmdsDropped++;
+    }
+
+    // One getmso serves every client waiting for a snapshot
+    unsigned long now = millis();
+    if (snapshotWanted && htp1_connected(0) &&
+        now - lastSnapshotReq >= PROXY_SNAPSHOT_INTERVAL_MS) {
+        lastSnapshotReq = now;
+        if (htp1_send_raw("getmso")) snapshotRequests++;
+    }
+}
+
+void proxy_report_metrics(Print &out) {
+    out.printf("# HELP htp1_proxy_enabled Proxy mode active\n"
+               "# TYPE htp1_proxy_enabled gauge\n"
+               "htp1_proxy_enabled %d\n", enabled ? 1 : 0);
+    out.printf("# HELP htp1_proxy_clients Connected local /ws/controller clients\n"
+               "# TYPE htp1_proxy_clients gauge\n"
+               "htp1_proxy_clients %u\n", (unsigned)ws.count());
+    out.printf("# HELP htp1_proxy_connects_total Local clients accepted / rejected\n"
+               "# TYPE htp1_proxy_connects_total counter\n"
+               "htp1_proxy_connects_total{result=\"accepted\"} %u\n"
+               "htp1_proxy_connects_total{result=\"rejected\"} %u\n", connects.load(), rejects.load());
+    out.printf("# HELP htp1_proxy_frames_total Upstream frames per client by result\n"
+               "# TYPE htp1_proxy_frames_total counter\n"
+               "htp1_proxy_frames_total{result=\"forwarded\"} %u\n"
+               "htp1_proxy_frames_total{result=\"snapshot\"} %u\n"
+               "htp1_proxy_frames_total{result=\"dropped\"} %u\n",
+               framesForwarded, snapshotsSent, framesDropped);
+    out.printf("# HELP htp1_proxy_snapshot_requests_total getmso sent upstream for lagging / new clients\n"
+               "# TYPE htp1_proxy_snapshot_requests_total counter\n"
+               "htp1_proxy_snapshot_requests_total %u\n", snapshotRequests);
+    out.printf("# HELP htp1_proxy_commands_total Client messages relayed upstream by result\n"
+               "# TYPE htp1_proxy_commands_total counter\n"
+               "htp1_proxy_commands_total{result=\"forwarded\"} %u\n"
+               "htp1_proxy_commands_total{result=\"dropped\"} %u\n", cmdsForwarded, cmdsDropped.load());
+    out.printf("# HELP htp1_proxy_ircmd_served_total /ircmd requests answered from cache\n"
+               "# TYPE htp1_proxy_ircmd_served_total counter\n"
+               "htp1_proxy_ircmd_served_total %u\n", ircmdServed.load());
+    if (ircmdCacheMs) {
+        out.printf("# HELP htp1_proxy_ircmd_age_seconds Age of the cached /ircmd payload\n"
+                   "# TYPE htp1_proxy_ircmd_age_seconds gauge\n"
+                   "htp1_proxy_ircmd_age_seconds %.1f\n", (millis() - ircmdCacheMs) / 1000.0f);
+    }
+}
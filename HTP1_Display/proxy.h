@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Arduino.h>
+
+class AsyncWebServer;
+class Print;
+
+// Proxy mode — this display keeps the only connection to the HTP-1 and
+// serves the same interface to other displays and control apps on the LAN.
+//
+// Local clients connect to ws://<display>/ws/controller and GET /ircmd as
+// they would on the processor. Upstream frames (mso dumps and msoupdate
+// patches) are fanned out to every client; each client has its own send
+// queue, and a client that falls behind skips patches until a fresh mso
+// dump resynchronises it. Client messages are relayed upstream from the
+// loop, and /ircmd is answered from the display's own last poll.
+
+// Register the WebSocket and /ircmd routes (call before server.begin())
+void proxy_begin(AsyncWebServer &server);
+
+// Enable / disable relaying (disabling closes all local clients)
+void proxy_set_enabled(bool enabled);
+
+// Relay queued client messages and request snapshots. Call from loop().
+void proxy_poll();
+
+// Proxy counters in Prometheus text format (for /metrics)
+void proxy_report_metrics(Print &out);
@@ -0,0 +1,417 @@
+#include "recorder.h"
+#include "config.h"
+#include "htp1_client.h"
+#include <ESPAsyncWebServer.h>
+#include <LittleFS.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#define REC_MAGIC "HTP1REC1"
+
+struct SegHeader {
+    char     magic[8];
+    uint32_t seq;        // Increases per segment; orders the ring
+    uint32_t reserved;
+};
+
+struct RecHeader {
+    uint32_t ms;         // Since the recording started
+    uint8_t  kind;       // RecKind
+    uint8_t  reserved[3];
+    uint32_t len;
+};
+
+static bool mounted = false;
+static volatile bool recording = false;
+static volatile bool downloading = false;   // Writer pauses meanwhile
+static SemaphoreHandle_t fileLock = nullptr;  // Writer task vs. async_tcp reader
+static TaskHandle_t writerTask = nullptr;
+
+// Start / stop / clear from the web server, applied by the writer task
+enum RecRequest : uint8_t { REQ_NONE = 0, REQ_START, REQ_STOP, REQ_CLEAR };
+static volatile uint8_t request = REQ_NONE;
+
+// --- RAM ring: records queued by the loop, written by the task ---
+// Single producer (loop) / single consumer (writer task). Positions run
+// freely; the byte offset is pos & (REC_RING_BYTES - 1).
+static uint8_t *ring = nullptr;
+static std::atomic<uint32_t> ringHead{0};   // Written by the loop
+static std::atomic<uint32_t> ringTail{0};   // Written by the writer task
+
+// --- Segment files (writer task) ---
+static File seg;
+static uint8_t segIndex = 0;
+static uint32_t segSeq = 0;
+static uint32_t segBytes = 0;
+static volatile unsigned long startMs = 0;
+static unsigned long lastFlush = 0;
+static bool unflushed = false;
+
+// --- Download (async_tcp; one at a time) ---
+static File dlFile;
+static uint8_t dlOrder[REC_SEGMENTS];
+static uint8_t dlCount = 0;
+static uint8_t dlNext = 0;
+
+// --- Stats ---
+static uint32_t records[2] = { 0, 0 };
+static uint32_t bytesWritten = 0;
+static uint32_t droppedFull = 0;       // RAM ring full (slow flash, download)
+static uint32_t droppedError = 0;
+static uint32_t rotations = 0;
+static uint32_t downloads = 0;
+
+static_assert((REC_RING_BYTES & (REC_RING_BYTES - 1)) == 0, "REC_RING_BYTES must be a power of 2");
+
+static void ring_put(uint32_t pos, const void *src, size_t n) {
+    uint32_t off = pos & (REC_RING_BYTES - 1);
+    size_t first = min(n, (size_t)(REC_RING_BYTES - off));
+    memcpy(ring + off, src, first);
+    memcpy(ring, (const uint8_t*)src + first, n - first);
+}
+
+static void ring_get(uint32_t pos, void *dst, size_t n) {
+    uint32_t off = pos & (REC_RING_BYTES - 1);
+    size_t first = min(n, (size_t)(REC_RING_BYTES - off));
+    memcpy(dst, ring + off, first);
+    memcpy((uint8_t*)dst + first, ring, n - first);
+}
+
+// Write `n` ring bytes at `pos` to the open segment (at most two pieces)
+static bool ring_write(uint32_t pos, size_t n) {
+    uint32_t off = pos & (REC_RING_BYTES - 1);
+    size_t first = min(n, (size_t)(REC_RING_BYTES - off));
+    return seg.write(ring + off, first) == first &&
+           (first == n || seg.write(ring, n - first) == n - first);
+}
+
+static void seg_path(uint8_t i, char *buf, size_t len) {
+    snprintf(buf, len, REC_DIR "/%u.bin", i);
+}
+
+// Sequence number in a segment's header (0 = missing / not a segment)
+static uint32_t seg_seq(uint8_t i) {
+    char path[24];
+    seg_path(i, path, sizeof(path));
+    File f = LittleFS.open(path, "r");
+    if (!f) return 0;
+    SegHeader h;
+    bool ok = f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && memcmp(h.magic, REC_MAGIC, 8) == 0;
+    f.close();
+    return ok ? h.seq : 0;
+}
+
+// Truncate segment `i` and write its header (caller holds fileLock)
+static bool open_segment(uint8_t i) {
+    char path[24];
+    seg_path(i, path, sizeof(path));
+    seg = LittleFS.open(path, "w");
+    if (!seg) return false;
+    SegHeader h;
+    memcpy(h.magic, REC_MAGIC, 8);
+    h.seq = ++segSeq;
+    h.reserved = 0;
+    segBytes = seg.write((const uint8_t*)&h, sizeof(h));
+    return segBytes == sizeof(h);
+}
+
+static bool mount(bool format) {
+    if (mounted) return true;
+    mounted = LittleFS.begin(format);
+    if (mounted) LittleFS.mkdir(REC_DIR);
+    else if (format) Serial.println("[REC] LittleFS mount failed");
+    return mounted;
+}
+
+static void remove_segments() {
+    char path[24];
+    for (uint8_t i = 0; i < REC_SEGMENTS; i++) {
+        seg_path(i, path, sizeof(path));
+        if (LittleFS.exists(path)) LittleFS.remove(path);
+    }
+    segSeq = 0;
+}
+
+// --- Write queued records to the segment ring (writer task) ---
+// Pauses while a download reads the files; records wait in RAM meanwhile.
+// False on a write error: recording ends and the queued records are dropped.
+static bool drain() {
+    uint32_t tail = ringTail.load(std::memory_order_relaxed);
+    while (tail != ringHead.load(std::memory_order_acquire) && !downloading) {
+        RecHeader h;
+        ring_get(tail, &h, sizeof(h));
+        size_t need = sizeof(h) + h.len;
+
+        xSemaphoreTake(fileLock, portMAX_DELAY);
+        if (downloading) {
+            xSemaphoreGive(fileLock);
+            break;
+        }
+        // Next segment (overwriting the oldest) once this one would overflow;
+        // a record bigger than a segment gets one to itself
+        bool ok = true;
+        if (segBytes > sizeof(SegHeader) && segBytes + need > REC_SEGMENT_BYTES) {
+            seg.close();
+            segIndex = (segIndex + 1) % REC_SEGMENTS;
+            rotations++;
+            ok = open_segment(segIndex);
+        }
+        ok = ok && ring_write(tail, need);
+        xSemaphoreGive(fileLock);
+
+        tail += need;
+        ringTail.store(tail, std::memory_order_release);
+        if (!ok) {
+            // Filesystem full or failing: keep what was recorded so far
+            droppedError++;
+            recording = false;
+            ringTail.store(ringHead.load(std::memory_order_acquire), std::memory_order_release);
+            Serial.println("[REC] Write failed, stopping");
+            return false;
+        }
+        segBytes += need;
+        bytesWritten += need;
+        records[h.kind]++;
+        unflushed = true;
+    }
+    return true;
+}
+
+static void stop() {
+    if (!recording && !seg) return;
+    recording = false;
+    drain();   // What the loop queued before the stop
+    xSemaphoreTake(fileLock, portMAX_DELAY);
+    seg.close();
+    xSemaphoreGive(fileLock);
+    Serial.printf("[REC] Stopped: %u frames, %u /ircmd, %u bytes\n",
+                  records[REC_WS_FRAME], records[REC_IRCMD], bytesWritten);
+}
+
+static void start() {
+    if (recording || !mount(true)) return;
+    if (!ring) {
+        // PSRAM when the board has it
+        ring = (uint8_t*)heap_caps_malloc(REC_RING_BYTES, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!ring) ring = (uint8_t*)malloc(REC_RING_BYTES);
+        if (!ring) {
+            Serial.println("[REC] No memory for the record buffer");
+            return;
+        }
+    }
+    xSemaphoreTake(fileLock, portMAX_DELAY);
+    remove_segments();
+    segIndex = 0;
+    bool ok = open_segment(0);
+    xSemaphoreGive(fileLock);
+    if (!ok) {
+        Serial.println("[REC] Could not create " REC_DIR "/0.bin");
+        return;
+    }
+    ringTail.store(ringHead.load(std::memory_order_acquire), std::memory_order_release);
+    records[REC_WS_FRAME] = records[REC_IRCMD] = 0;
+    bytesWritten = 0;
+    startMs = lastFlush = millis();
+    recording = true;
+    Serial.printf("[REC] Recording to LittleFS (%u x %u KB ring)\n",
+                  REC_SEGMENTS, REC_SEGMENT_BYTES / 1024);
+}
+
+static void clear() {
+    stop();
+    if (!mounted || downloading) return;
+    xSemaphoreTake(fileLock, portMAX_DELAY);
+    remove_segments();
+    xSemaphoreGive(fileLock);
+    Serial.println("[REC] Recording cleared");
+}
+
+// --- Writer task: applies requests, writes queued records, flushes ---
+static void writer_task(void *arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, recording ? pdMS_TO_TICKS(REC_FLUSH_INTERVAL_MS) : portMAX_DELAY);
+
+        uint8_t r = request;
+        if (r != REQ_NONE) {
+            request = REQ_NONE;
+            if (r == REQ_START) start();
+            else if (r == REQ_STOP) stop();
+            else clear();
+        }
+        if (!recording) continue;
+        if (!drain()) {
+            stop();
+            continue;
+        }
+
+        // Flush so a download (or a power cut) sees recent records
+        if (unflushed && !downloading && millis() - lastFlush >= REC_FLUSH_INTERVAL_MS) {
+            lastFlush = millis();
+            unflushed = false;
+            xSemaphoreTake(fileLock, portMAX_DELAY);
+            seg.flush();
+            xSemaphoreGive(fileLock);
+        }
+    }
+}
+
+// --- Queue one record (loop, from the htp1_client hooks) ---
+// Only a copy into RAM; the writer task does the flash I/O.
+static void write_record(RecKind kind, const String &data) {
+    if (!recording) return;
+
+    RecHeader h = { (uint32_t)(millis() - startMs), kind, { 0, 0, 0 }, data.length() };
+    uint32_t need = sizeof(h) + h.len;
+    uint32_t head = ringHead.load(std::memory_order_relaxed);
+    uint32_t used = head - ringTail.load(std::memory_order_acquire);
+    if (need > REC_RING_BYTES - used) {
+        droppedFull++;
+        return;
+    }
+    ring_put(head, &h, sizeof(h));
+    ring_put(head + sizeof(h), data.c_str(), h.len);
+    ringHead.store(head + need, std::memory_order_release);
+    xTaskNotifyGive(writerTask);
+}
+
+static void on_frame(const String &data) { write_record(REC_WS_FRAME, data); }
+static void on_ircmd(const String &data) { write_record(REC_IRCMD, data); }
+
+// ============================================================
+// HTTP handlers (async_tcp task)
+// ============================================================
+
+// --- GET /recorder — status ---
+static void handleStatus(AsyncWebServerRequest *req) {
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+             "{\"recording\":%s,\"frames\":%u,\"ircmd\":%u,\"bytes\":%u,\"dropped\":%u,"
+             "\"ring_bytes\":%u,\"fs_used\":%u,\"fs_total\":%u}",
+             recording ? "true" : "false", records[REC_WS_FRAME], records[REC_IRCMD],
+             bytesWritten, droppedFull + droppedError, REC_SEGMENTS * REC_SEGMENT_BYTES,
+             mounted ? (unsigned)LittleFS.usedBytes() : 0, mounted ? (unsigned)LittleFS.totalBytes() : 0);
+    req->send(200, "application/json", buf);
+}
+
+static void handleRequest(AsyncWebServerRequest *req, RecRequest r) {
+    request = r;
+    xTaskNotifyGive(writerTask);
+    req->send(200, "application/json", "{\"ok\":true}");
+}
+
+// --- GET /recorder/download — every segment, oldest first ---
+static void handleDownload(AsyncWebServerRequest *req) {
+    if (!mounted) {
+        req->send(404, "text/plain", "No recording");
+        return;
+    }
+    if (downloading) {
+        req->send(409, "text/plain", "A download is already in progress");
+        return;
+    }
+    downloading = true;
+
+    // Flush the open segment and order the ring by sequence number
+    uint32_t seqs[REC_SEGMENTS];
+    xSemaphoreTake(fileLock, portMAX_DELAY);
+    if (recording) seg.flush();
+    dlCount = 0;
+    for (uint8_t i = 0; i < REC_SEGMENTS; i++) {
+        uint32_t s = seg_seq(i);
+        if (!s) continue;
+        uint8_t j = dlCount++;
+        while (j > 0 && seqs[j - 1] > s) {
+            seqs[j] = seqs[j - 1];
+            dlOrder[j] = dlOrder[j - 1];
+            j--;
+        }
+        seqs[j] = s;
+        dlOrder[j] = i;
+    }
+    xSemaphoreGive(fileLock);
+
+    if (dlCount == 0) {
+        downloading = false;
+        req->send(404, "text/plain", "No recording");
+        return;
+    }
+    dlNext = 0;
+
+    AsyncWebServerResponse *res = req->beginChunkedResponse("application/octet-stream",
+        [](uint8_t *buf, size_t maxLen, size_t index) -> size_t {
+            while (dlFile || dlNext < dlCount) {
+                if (!dlFile) {
+                    char path[24];
+                    seg_path(dlOrder[dlNext++], path, sizeof(path));
+                    dlFile = LittleFS.open(path, "r");
+                    continue;
+                }
+                size_t n = dlFile.read(buf, maxLen);
+                if (n > 0) return n;
+                dlFile.close();
+            }
+            downloading = false;
+            return 0;
+        });
+    res->addHeader("Content-Disposition", "attachment; filename=\"htp1-recording.bin\"");
+    req->onDisconnect([]() {
+        if (dlFile) dlFile.close();
+        downloading = false;
+    });
+    req->send(res);
+    downloads++;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+void recorder_begin(AsyncWebServer &server) {
+    fileLock = xSemaphoreCreateMutex();
+    mount(false);  // Formatted on the first recording if needed
+    xTaskCreatePinnedToCore(writer_task, "recorder", 4096, nullptr, 1, &writerTask, 0);
+
+    // "/recorder" would also match "/recorder/..." — register the longer paths first
+    server.on("/recorder/download", HTTP_GET, handleDownload);
+    server.on("/recorder/start", HTTP_POST, [](AsyncWebServerRequest *req) { handleRequest(req, REQ_START); });
+    server.on("/recorder/stop", HTTP_POST, [](AsyncWebServerRequest *req) { handleRequest(req, REQ_STOP); });
+    server.on("/recorder/clear", HTTP_POST, [](AsyncWebServerRequest *req) { handleRequest(req, REQ_CLEAR); });
+    server.on("/recorder", HTTP_GET, handleStatus);
+
+    htp1_add_hooks(on_frame, on_ircmd);
+}
+
+bool recorder_active() {
+    return recording;
+}
+
+void recorder_report_metrics(Print &out) {
+    out.printf("# HELP htp1_recorder_active Traffic recording in progress\n"
+               "# TYPE htp1_recorder_active gauge\n"
+               "htp1_recorder_active %d\n", recording ? 1 : 0);
+    out.printf("# HELP htp1_recorder_records_total Records written in this recording by kind\n"
+               "# TYPE htp1_recorder_records_total counter\n"
+               "htp1_recorder_records_total{kind=\"ws\"} %u\n"
+               "htp1_recorder_records_total{kind=\"ircmd\"} %u\n",
+               records[REC_WS_FRAME], records[REC_IRCMD]);
+    out.printf("# HELP htp1_recorder_bytes_total Bytes written in this recording\n"
+               "# TYPE htp1_recorder_bytes_total counter\n"
+               "htp1_recorder_bytes_total %u\n", bytesWritten);
+    out.printf("# HELP htp1_recorder_dropped_total Records not written by reason\n"
+               "# TYPE htp1_recorder_dropped_total counter\n"
+               "htp1_recorder_dropped_total{reason=\"full\"} %u\n"
+               "htp1_recorder_dropped_total{reason=\"error\"} %u\n", droppedFull, droppedError);
+    out.printf("# HELP htp1_recorder_rotations_total Segments started after the first (oldest overwritten)\n"
+               "# TYPE htp1_recorder_rotations_total counter\n"
+               "htp1_recorder_rotations_total %u\n", rotations);
+    out.printf("# HELP htp1_recorder_downloads_total Recording downloads started\n"
+               "# TYPE htp1_recorder_downloads_total counter\n"
+               "htp1_recorder_downloads_total %u\n", downloads);
+    uint32_t used = ringHead.load(std::memory_order_relaxed) - ringTail.load(std::memory_order_relaxed);
+    out.printf("# HELP htp1_recorder_buffer_bytes RAM record buffer between the loop and the writer task\n"
+               "# TYPE htp1_recorder_buffer_bytes gauge\n"
+               "htp1_recorder_buffer_bytes{state=\"used\"} %u\n"
+               "htp1_recorder_buffer_bytes{state=\"size\"} %u\n", used, ring ? REC_RING_BYTES : 0);
+}
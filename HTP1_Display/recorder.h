@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Arduino.h>
+
+class AsyncWebServer;
+
+// Traffic recorder: raw HTP-1 WebSocket frames and /ircmd responses,
+// timestamped, into a ring of segment files on LittleFS.
+//
+// A recording is downloaded as one file (segments oldest first) and fed
+// back through tools/replay_htp1.py, which plays it to a display as a fake
+// HTP-1 at original or accelerated speed.
+//
+// File format (little-endian), repeated per segment:
+//   segment header: "HTP1REC1", uint32 seq, uint32 reserved
+//   record:         uint32 ms (since the recording started), uint8 kind,
+//                   3 bytes reserved, uint32 len, then len bytes of payload
+// When the ring is full the oldest segment is overwritten.
+//
+// The htp1_client hooks only copy each record into a RAM ring
+// (REC_RING_BYTES); a low-priority task on core 0 writes it to flash, so
+// LittleFS latency never stalls the loop. Start / stop / clear requested
+// from the web server are applied by that task. While a download is in
+// progress the task pauses so the files it reads stay put; records wait in
+// RAM, and are dropped (and counted) only when the ring is full.
+
+enum RecKind : uint8_t {
+    REC_WS_FRAME = 0,   // WebSocket frame from the HTP-1 (mso / msoupdate)
+    REC_IRCMD    = 1,   // HTTP /ircmd response body
+};
+
+// Mount LittleFS (if formatted), start the writer task and register the
+// /recorder routes
+void recorder_begin(AsyncWebServer &server);
+
+bool recorder_active();
+
+// Recorder counters in Prometheus text format (for /metrics)
+void recorder_report_metrics(Print &out);
@@ -2,6 +2,8 @@
 #include "SPI.h"
 #include "Arduino.h"
 #include "driver/spi_master.h"
+#include "freertos/semphr.h"
+#include "metrics.h"
 
 const static lcd_cmd_t rm67162_spi_init[] = {
     {0xFE, {0x00}, 0x01}, // PAGE
@@ -33,6 +35,30 @@ const static lcd_cmd_t rm67162_qspi_init[] = {
 
 static spi_device_handle_t spi;
 
+// Indexed push: RGB565 expansion buffer (DMA-capable, two halves) and the
+// palette expanded to a byte -> pixel-pair table
+#define BOUNCE_PX (LCD_BOUNCE_BYTES / 4)   // Pixels per half
+static uint16_t *bounce = NULL;
+static uint16_t lutPalette[16];
+static uint32_t lut[256];
+static bool lutValid = false;
+
+// Serializes panel access — the brightness fade task sends commands while
+// the main loop pushes frames. Recursive: lcd_PushColors -> lcd_address_set.
+static SemaphoreHandle_t lcd_mutex = NULL;
+
+static inline void lcd_lock()
+{
+    if (lcd_mutex)
+        xSemaphoreTakeRecursive(lcd_mutex, portMAX_DELAY);
+}
+
+static inline void lcd_unlock()
+{
+    if (lcd_mutex)
+        xSemaphoreGiveRecursive(lcd_mutex);
+}
+
 static void WriteComm(uint8_t data)
 {
     TFT_CS_L;
@@ -67,6 +93,7 @@ static void WriteData16(uint16_t data)
 
 static void lcd_send_cmd(uint32_t cmd, uint8_t *dat, uint32_t len)
 {
+    lcd_lock();
 #if LCD_USB_QSPI_DREVER == 1
     TFT_CS_L;
     spi_transaction_t t;
@@ -95,10 +122,16 @@ static void lcd_send_cmd(uint32_t cmd, uint8_t *dat, uint32_t len)
             WriteData(dat[i]);
     }
 #endif
+    lcd_unlock();
 }
 
 void rm67162_init(void)
 {
+    if (!lcd_mutex)
+        lcd_mutex = xSemaphoreCreateRecursiveMutex();
+    if (!bounce)
+        bounce = (uint16_t *)heap_caps_malloc(LCD_BOUNCE_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+
     pinMode(TFT_CS, OUTPUT);
     pinMode(TFT_RES, OUTPUT);
 
@@ -216,8 +249,10 @@ void lcd_fill(uint16_t xsta,
 
 void lcd_DrawPoint(uint16_t x, uint16_t y, uint16_t color)
 {
+    lcd_lock();
     lcd_address_set(x, y, x + 1, y + 1);
     lcd_PushColors(&color, 1);
+    lcd_unlock();
 }
 
 void lcd_PushColors(uint16_t x,
@@ -226,6 +261,8 @@ void lcd_PushColors(uint16_t x,
                     uint16_t high,
                     uint16_t *data)
 {
+    lcd_lock();
+    metrics_add(MET_QSPI_BYTES, (uint32_t)width * high * 2);
 #if LCD_USB_QSPI_DREVER == 1
     bool first_send = 1;
     size_t len = width * high;
@@ -277,10 +314,13 @@ void lcd_PushColors(uint16_t x,
     SPI.endTransaction();
     TFT_CS_H;
 #endif
+    lcd_unlock();
 }
 
 void lcd_PushColors(uint16_t *data, uint32_t len)
 {
+    lcd_lock();
+    metrics_add(MET_QSPI_BYTES, len * 2);
 #if LCD_USB_QSPI_DREVER == 1
     bool first_send = 1;
     uint16_t *p = (uint16_t *)data;
@@ -328,6 +368,139 @@ void lcd_PushColors(uint16_t *data, uint32_t len)
     SPI.endTransaction();
     TFT_CS_H;
 #endif
+    lcd_unlock();
+}
+
+// Byte of two indexed pixels -> both pixels in RGB565, byte-swapped for
+// the panel, first pixel in the low half (little-endian store order)
+static void build_lut(const uint16_t *palette)
+{
+    for (int b = 0; b < 256; b++)
+    {
+        uint16_t p0 = __builtin_bswap16(palette[b >> 4]);
+        uint16_t p1 = __builtin_bswap16(palette[b & 0x0F]);
+        lut[b] = (uint32_t)p1 << 16 | p0;
+    }
+    memcpy(lutPalette, palette, sizeof(lutPalette));
+    lutValid = true;
+}
+
+// One table load and one 32-bit store per two pixels, unrolled by four
+static void IRAM_ATTR expand4(const uint8_t *src, uint32_t *dst, size_t bytes)
+{
+    for (; bytes >= 4; bytes -= 4, src += 4, dst += 4)
+    {
+        uint32_t a = lut[src[0]], b = lut[src[1]], c = lut[src[2]], d = lut[src[3]];
+        dst[0] = a;
+        dst[1] = b;
+        dst[2] = c;
+        dst[3] = d;
+    }
+    while (bytes--)
+        *dst++ = lut[*src++];
+}
+
+// Expand the next `n` pixels of the window into `dst`, row by row
+static void expand_window(uint16_t *dst, size_t n, const uint8_t *fb, uint16_t stride,
+                          uint16_t x, uint16_t width, uint16_t &row, uint16_t &col)
+{
+    while (n)
+    {
+        size_t take = width - col;
+        if (take > n)
+            take = n;
+        expand4(fb + (size_t)row * stride + (x + col) / 2, (uint32_t *)dst, take / 2);
+        dst += take;
+        n -= take;
+        col += take;
+        if (col == width)
+        {
+            col = 0;
+            row++;
+        }
+    }
+}
+
+void lcd_PushIndexed(uint16_t x,
+                     uint16_t y,
+                     uint16_t width,
+                     uint16_t high,
+                     const uint8_t *fb,
+                     uint16_t stride,
+                     const uint16_t *palette)
+{
+    if (!bounce || width == 0 || high == 0)
+        return;
+    lcd_lock();
+    metrics_add(MET_QSPI_BYTES, (uint32_t)width * high * 2);
+    if (!lutValid || memcmp(palette, lutPalette, sizeof(lutPalette)) != 0)
+        build_lut(palette);
+
+    size_t len = (size_t)width * high;
+    uint16_t row = y, col = 0;
+    uint32_t expandUs = 0;
+    lcd_address_set(x, y, x + width - 1, y + high - 1);
+    TFT_CS_L;
+#if LCD_USB_QSPI_DREVER == 1
+    // Ping-pong: expand into one half while the other is on the wire
+    static spi_transaction_ext_t t[2];
+    bool first_send = 1, inflight = 0;
+    int half = 0;
+    while (len > 0)
+    {
+        size_t chunk_size = len > BOUNCE_PX ? BOUNCE_PX : len;
+        uint16_t *buf = bounce + half * BOUNCE_PX;
+        unsigned long startUs = micros();
+        expand_window(buf, chunk_size, fb, stride, x, width, row, col);
+        expandUs += micros() - startUs;
+
+        spi_transaction_t *done;
+        if (inflight)
+            spi_device_get_trans_result(spi, &done, portMAX_DELAY);
+
+        memset(&t[half], 0, sizeof(t[half]));
+        if (first_send)
+        {
+            t[half].base.flags = SPI_TRANS_MODE_QIO;
+            t[half].base.cmd = 0x32;
+            t[half].base.addr = 0x002C00;
+            first_send = 0;
+        }
+        else
+        {
+            t[half].base.flags = SPI_TRANS_MODE_QIO | SPI_TRANS_VARIABLE_CMD |
+                                 SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_DUMMY;
+        }
+        t[half].base.tx_buffer = buf;
+        t[half].base.length = chunk_size * 16;
+        spi_device_queue_trans(spi, (spi_transaction_t *)&t[half], portMAX_DELAY);
+        inflight = 1;
+
+        len -= chunk_size;
+        half ^= 1;
+    }
+    if (inflight)
+    {
+        spi_transaction_t *done;
+        spi_device_get_trans_result(spi, &done, portMAX_DELAY);
+    }
+#else
+    SPI.beginTransaction(SPISettings(SPI_FREQUENCY, MSBFIRST, TFT_SPI_MODE));
+    TFT_DC_H;
+    while (len > 0)
+    {
+        size_t chunk_size = len > BOUNCE_PX ? BOUNCE_PX : len;
+        unsigned long startUs = micros();
+        expand_window(bounce, chunk_size, fb, stride, x, width, row, col);
+        expandUs += micros() - startUs;
+        SPI.writeBytes((uint8_t *)bounce, chunk_size * 2);
+        len -= chunk_size;
+    }
+    SPI.endTransaction();
+#endif
+    TFT_CS_H;
+    metrics_add(MET_LCD_EXPAND_US, expandUs);
+    lcd_unlock();
 }
 
 void lcd_sleep()
@@ -51,6 +51,18 @@ void lcd_PushColors(uint16_t x,
                     uint16_t high,
                     uint16_t *data);
 void lcd_PushColors(uint16_t *data, uint32_t len);
+
+// Push a window of a 4-bit indexed framebuffer: two pixels per byte, left
+// pixel in the high nibble, `stride` bytes per row. Pixels are expanded to
+// RGB565 through `palette` (16 entries) one chunk at a time into a DMA
+// bounce buffer of LCD_BOUNCE_BYTES. x and width must be even.
+void lcd_PushIndexed(uint16_t x,
+                     uint16_t y,
+                     uint16_t width,
+                     uint16_t high,
+                     const uint8_t *fb,
+                     uint16_t stride,
+                     const uint16_t *palette);
 void lcd_sleep();
 
 //nikthefix added functions
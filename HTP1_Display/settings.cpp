@@ -1,5 +1,6 @@
 #include "settings.h"
 #include "config.h"
+#include "metrics.h"
 #include <Preferences.h>
 
 static Preferences prefs;
@@ -11,20 +12,30 @@ static void apply_defaults(AppSettings &s) {
     strlcpy(s.htp1_ip,       "",              sizeof(s.htp1_ip));
     s.htp1_port        = HTP1_DEFAULT_PORT;
     s.volume_offset    = HTP1_VOLUME_OFFSET;
+    memset(s.unit_ip, 0, sizeof(s.unit_ip));
+    for (int i = 0; i < HTP1_MAX_UNITS - 1; i++) s.unit_port[i] = HTP1_DEFAULT_PORT;
+    s.active_unit      = 0;
+    s.split_view       = false;
     s.brightness_level = BRIGHTNESS_DEFAULT;
     s.autodim_timeout  = AUTODIM_TIMEOUT_MS;
     s.dim_brightness   = DIM_BRIGHTNESS;
     s.color_theme      = THEME_WHITE;
     s.display_mode     = MODE_VOLUME_ONLY;
+    s.burnin_protect   = true;
     s.sleep_enabled    = false;
     s.sleep_timeout    = SLEEP_TIMEOUT_MS;
+    s.low_power        = false;
+    s.button_remote    = false;
+    s.proxy_mode       = false;
+    strlcpy(s.update_url,    "",              sizeof(s.update_url));
+    s.update_auto      = false;
     s.input_name_count = 0;
     memset(s.input_names, 0, sizeof(s.input_names));
 
     // Per-mode display element sizes
-    // {Volume Only, Vol+Source, Vol+Codec, Full Status}
-    s.vol_sizes[0] = 5;  s.vol_sizes[1] = 4;  s.vol_sizes[2] = 4;  s.vol_sizes[3] = 4;
-    s.label_sizes[0] = 1; s.label_sizes[1] = 2; s.label_sizes[2] = 2; s.label_sizes[3] = 1;
+    // {Volume Only, Vol+Source, Vol+Codec, Full Status, Custom}
+    s.vol_sizes[0] = 5;  s.vol_sizes[1] = 4;  s.vol_sizes[2] = 4;  s.vol_sizes[3] = 4;  s.vol_sizes[4] = 4;
+    s.label_sizes[0] = 1; s.label_sizes[1] = 2; s.label_sizes[2] = 2; s.label_sizes[3] = 1; s.label_sizes[4] = 1;
 }
 
 void settings_load(AppSettings &s) {
@@ -42,8 +53,26 @@ void settings_load(AppSettings &s) {
         s.dim_brightness   = prefs.getUChar("dimbrt",    DIM_BRIGHTNESS);
         s.color_theme      = (ColorTheme)prefs.getUChar("theme",  THEME_WHITE);
         s.display_mode     = (DisplayMode)prefs.getUChar("dmode",  MODE_VOLUME_ONLY);
+        s.burnin_protect   = prefs.getBool("burnin",     true);
         s.sleep_enabled    = prefs.getBool("sleepen",    false);
         s.sleep_timeout    = prefs.getULong("sleeptm",   SLEEP_TIMEOUT_MS);
+        s.low_power        = prefs.getBool("lowpwr",     false);
+        s.button_remote    = prefs.getBool("btnrem",     false);
+        s.proxy_mode       = prefs.getBool("proxy",      false);
+        strlcpy(s.update_url,  prefs.getString("updurl", "").c_str(), sizeof(s.update_url));
+        s.update_auto      = prefs.getBool("updauto",    false);
+        s.active_unit      = prefs.getUChar("actunit",   0);
+        s.split_view       = prefs.getBool("split",      false);
+        if (s.active_unit >= HTP1_MAX_UNITS) s.active_unit = 0;
+
+        // Extra units (unit 0 is htp1ip / htp1port)
+        for (int i = 0; i < HTP1_MAX_UNITS - 1; i++) {
+            char ik[8], pk[8];
+            snprintf(ik, sizeof(ik), "u%dip", i + 1);
+            snprintf(pk, sizeof(pk), "u%dport", i + 1);
+            strlcpy(s.unit_ip[i], prefs.getString(ik, "").c_str(), sizeof(s.unit_ip[i]));
+            s.unit_port[i] = prefs.getUShort(pk, HTP1_DEFAULT_PORT);
+        }
 
         // Per-mode sizes
         for (int i = 0; i < MODE_COUNT; i++) {
@@ -71,6 +100,7 @@ void settings_load(AppSettings &s) {
 
 void settings_save(const AppSettings &s) {
     prefs.begin(NS, false);  // read-write
+    metrics_inc(MET_NVS_WRITES);
 
     prefs.putString("ssid",     s.wifi_ssid);
     prefs.putString("pass",     s.wifi_password);
@@ -82,8 +112,25 @@ void settings_save(const AppSettings &s) {
     prefs.putUChar("dimbrt",    s.dim_brightness);
     prefs.putUChar("theme",     (uint8_t)s.color_theme);
     prefs.putUChar("dmode",     (uint8_t)s.display_mode);
+    prefs.putBool("burnin",     s.burnin_protect);
     prefs.putBool("sleepen",    s.sleep_enabled);
     prefs.putULong("sleeptm",   s.sleep_timeout);
+    prefs.putBool("lowpwr",     s.low_power);
+    prefs.putBool("btnrem",     s.button_remote);
+    prefs.putBool("proxy",      s.proxy_mode);
+    prefs.putString("updurl",   s.update_url);
+    prefs.putBool("updauto",    s.update_auto);
+    prefs.putUChar("actunit",   s.active_unit);
+    prefs.putBool("split",      s.split_view);
+
+    // Extra units
+    for (int i = 0; i < HTP1_MAX_UNITS - 1; i++) {
+        char ik[8], pk[8];
+        snprintf(ik, sizeof(ik), "u%dip", i + 1);
+        snprintf(pk, sizeof(pk), "u%dport", i + 1);
+        prefs.putString(ik, s.unit_ip[i]);
+        prefs.putUShort(pk, s.unit_port[i]);
+    }
 
     // Per-mode sizes
     for (int i = 0; i < MODE_COUNT; i++) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include "config.h"
 
 // --- Color Theme ---
 enum ColorTheme : uint8_t {
@@ -19,6 +20,7 @@ enum DisplayMode : uint8_t {
     MODE_VOLUME_SOURCE,
     MODE_VOLUME_CODEC,
     MODE_FULL_STATUS,
+    MODE_CUSTOM,        // User-defined layout (see layout.h)
     MODE_COUNT
 };
 
@@ -41,12 +43,19 @@ struct AppSettings {
     uint16_t htp1_port;
     int8_t volume_offset;
 
+    // Extra HTP-1 units (unit 0 is htp1_ip / htp1_port; "" = unused)
+    char unit_ip[HTP1_MAX_UNITS - 1][40];
+    uint16_t unit_port[HTP1_MAX_UNITS - 1];
+    uint8_t active_unit;        // Unit shown and controlled
+    bool split_view;            // Every configured unit side by side
+
     // Display
     uint8_t brightness_level;   // Index into BRIGHTNESS_PRESETS
     uint32_t autodim_timeout;   // ms
     uint8_t dim_brightness;     // Raw brightness value when dimmed
     ColorTheme color_theme;
     DisplayMode display_mode;
+    bool burnin_protect;        // Orbit / idle-shift the layout (see burnin.h)
 
     // Per-mode display element sizes (indexed by DisplayMode)
     uint8_t vol_sizes[MODE_COUNT];    // Font 7 textSize: 1-5
@@ -55,6 +64,17 @@ struct AppSettings {
     // Power
     bool sleep_enabled;
     uint32_t sleep_timeout;     // ms
+    bool low_power;             // Light sleep + modem sleep while display is off
+
+    // Proxy
+    bool proxy_mode;            // Relay the HTP-1 to other displays / apps
+
+    // Buttons
+    bool button_remote;         // Buttons send volume / mute to the HTP-1
+
+    // Pull OTA
+    char update_url[96];        // Update server base URL (empty = disabled)
+    bool update_auto;           // Check the server periodically
 
     // Input name mapping
     InputName input_names[MAX_INPUT_NAMES];
@@ -0,0 +1,203 @@
+#include "str_table.h"
+#include "config.h"
+#include <algorithm>
+
+#define SLOTS     (1 << STR_TABLE_SLOT_BITS)
+#define SLOT_MASK (SLOTS - 1)
+#define GEN_MASK  (0xFFFF >> STR_TABLE_SLOT_BITS)
+
+struct Entry {
+    uint32_t hash;
+    uint32_t lastUse;   // LRU clock at the last intern
+    uint16_t off;       // Text in arena (NUL-terminated)
+    uint16_t len;
+    uint16_t gen;       // Bumped on eviction
+    uint16_t refs;
+    bool     used;
+};
+
+// Slot 0 is the permanent empty string (id STR_EMPTY)
+static Entry entries[SLOTS];
+static char arena[STR_TABLE_ARENA] = "";
+static uint16_t arenaTop = 1;     // arena[0] = "" for slot 0
+static uint16_t garbage = 0;      // Bytes of evicted text below arenaTop
+static uint32_t lruClock = 0;
+
+// The loop writes; str_copy readers on other tasks take the same lock
+static portMUX_TYPE tabMux = portMUX_INITIALIZER_UNLOCKED;
+
+// --- Stats ---
+static uint32_t hits = 0;
+static uint32_t inserts = 0;
+static uint32_t evictions = 0;
+static uint32_t compactions = 0;
+static uint32_t failures = 0;
+static uint32_t clipped = 0;
+
+static uint32_t hash_str(const char *s, size_t n) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    while (n--) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static StrId make_id(int slot) {
+    return (entries[slot].gen << STR_TABLE_SLOT_BITS) | slot;
+}
+
+// Slot for a live id, or -1 if it was evicted
+static int slot_of(StrId id) {
+    int slot = id & SLOT_MASK;
+    const Entry &e = entries[slot];
+    return e.used && e.gen == (id >> STR_TABLE_SLOT_BITS) ? slot : -1;
+}
+
+// Evict the least recently used unreferenced value
+static bool evict_lru() {
+    int victim = -1;
+    for (int i = 1; i < SLOTS; i++) {
+        const Entry &e = entries[i];
+        if (e.used && e.refs == 0 && (victim < 0 || (int32_t)(e.lastUse - entries[victim].lastUse) < 0)) {
+            victim = i;
+        }
+    }
+    if (victim < 0) return false;
+    Entry &e = entries[victim];
+    e.used = false;
+    e.gen = (e.gen + 1) & GEN_MASK;
+    garbage += e.len + 1;
+    evictions++;
+    return true;
+}
+
+// Slide live text down over evicted values
+static void compact() {
+    uint8_t order[SLOTS];
+    int count = 0;
+    for (int i = 1; i < SLOTS; i++) {
+        if (entries[i].used) order[count++] = i;
+    }
+    std::sort(order, order + count, [](uint8_t a, uint8_t b) {
+        return entries[a].off < entries[b].off;
+    });
+    uint16_t top = 1;
+    for (int i = 0; i < count; i++) {
+        Entry &e = entries[order[i]];
+        memmove(arena + top, arena + e.off, e.len + 1);
+        e.off = top;
+        top += e.len + 1;
+    }
+    arenaTop = top;
+    garbage = 0;
+    compactions++;
+}
+
+static int free_slot() {
+    for (int i = 1; i < SLOTS; i++) {
+        if (!entries[i].used) return i;
+    }
+    return -1;
+}
+
+// ============================================================
+// Public API
+// ============================================================
+
+StrId str_intern(const char *s, size_t len) {
+    if (len == 0) return STR_EMPTY;
+    if (len > STR_TABLE_MAX_LEN) {
+        len = STR_TABLE_MAX_LEN;
+        clipped++;
+    }
+    uint32_t h = hash_str(s, len);
+    StrId id = STR_EMPTY;
+
+    portENTER_CRITICAL(&tabMux);
+    for (int i = 1; i < SLOTS; i++) {
+        Entry &e = entries[i];
+        if (e.used && e.hash == h && e.len == len && memcmp(arena + e.off, s, len) == 0) {
+            e.lastUse = ++lruClock;
+            e.refs++;
+            hits++;
+            id = make_id(i);
+            break;
+        }
+    }
+
+    // New value: make room (slot + arena bytes), evicting LRU as needed
+    while (id == STR_EMPTY) {
+        int slot = free_slot();
+        size_t need = len + 1;
+        if (slot > 0 && arenaTop + need <= STR_TABLE_ARENA) {
+            Entry &e = entries[slot];
+            memcpy(arena + arenaTop, s, len);
+            arena[arenaTop + len] = '\0';
+            e.hash = h;
+            e.off = arenaTop;
+            e.len = len;
+            e.refs = 1;
+            e.lastUse = ++lruClock;
+            e.used = true;
+            arenaTop += need;
+            inserts++;
+            id = make_id(slot);
+        } else if (slot > 0 && garbage && arenaTop - garbage + need <= STR_TABLE_ARENA) {
+            compact();
+        } else if (!evict_lru()) {
+            failures++;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&tabMux);
+    return id;
+}
+
+void str_release(StrId id) {
+    portENTER_CRITICAL(&tabMux);
+    int slot = slot_of(id);
+    if (slot > 0 && entries[slot].refs > 0) entries[slot].refs--;
+    portEXIT_CRITICAL(&tabMux);
+}
+
+const char* str_get(StrId id) {
+    int slot = slot_of(id);
+    return slot > 0 ? arena + entries[slot].off : "";
+}
+
+size_t str_copy(StrId id, char *buf, size_t len) {
+    if (len == 0) return 0;
+    portENTER_CRITICAL(&tabMux);
+    int slot = slot_of(id);
+    size_t n = slot > 0 ? min((size_t)entries[slot].len, len - 1) : 0;
+    if (n) memcpy(buf, arena + entries[slot].off, n);
+    portEXIT_CRITICAL(&tabMux);
+    buf[n] = '\0';
+    return n;
+}
+
+void str_report_metrics(Print &out) {
+    int used = 0;
+    for (int i = 1; i < SLOTS; i++) used += entries[i].used;
+    out.printf("# HELP htp1_strings Interned HTP-1 text values held\n"
+               "# TYPE htp1_strings gauge\n"
+               "htp1_strings %d\n", used);
+    out.printf("# HELP htp1_strings_arena_bytes String arena: allocated / evicted / capacity\n"
+               "# TYPE htp1_strings_arena_bytes gauge\n"
+               "htp1_strings_arena_bytes{state=\"used\"} %u\n"
+               "htp1_strings_arena_bytes{state=\"garbage\"} %u\n"
+               "htp1_strings_arena_bytes{state=\"capacity\"} %u\n", arenaTop, garbage, STR_TABLE_ARENA);
+    out.printf("# HELP htp1_strings_interned_total Interns by result\n"
+               "# TYPE htp1_strings_interned_total counter\n"
+               "htp1_strings_interned_total{result=\"hit\"} %u\n"
+               "htp1_strings_interned_total{result=\"insert\"} %u\n"
+               "htp1_strings_interned_total{result=\"failed\"} %u\n"
+               "htp1_strings_interned_total{result=\"clipped\"} %u\n", hits, inserts, failures, clipped);
+    out.printf("# HELP htp1_strings_evictions_total Unreferenced values evicted, least recently used first\n"
+               "# TYPE htp1_strings_evictions_total counter\n"
+               "htp1_strings_evictions_total %u\n", evictions);
+    out.printf("# HELP htp1_strings_compactions_total String arena compactions\n"
+               "# TYPE htp1_strings_compactions_total counter\n"
+               "htp1_strings_compactions_total %u\n", compactions);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Interned strings for the HTP-1 text fields (input, codec, program
+// format, surround mode, listening format).
+//
+// Each distinct value is stored once and named by a 16-bit id, so the
+// client detects changes with an integer compare and the renderer can key
+// its caches (abbreviated text, fitted size) by id. Text lives in a fixed
+// arena; when it is full, unreferenced values are evicted least recently
+// used first and the arena is compacted. An id carries its slot's
+// generation, so an evicted id never aliases a newer string.
+//
+// str_intern / str_release / str_get are for the loop. str_copy may be
+// called from any task.
+
+typedef uint16_t StrId;
+#define STR_EMPTY 0   // Id of "" (never evicted)
+
+// Look up or add a value; the returned id holds one reference.
+// Values longer than STR_TABLE_MAX_LEN are clipped. Returns STR_EMPTY if
+// every slot is referenced.
+StrId str_intern(const char *s, size_t len);
+inline StrId str_intern(const char *s) { return str_intern(s ? s : "", s ? strlen(s) : 0); }
+
+// Drop a reference taken by str_intern (the value stays cached until evicted)
+void str_release(StrId id);
+
+// Text for an id ("" if evicted). Valid until the next str_intern.
+const char* str_get(StrId id);
+
+// Copy the text into `buf` (NUL-terminated) — safe from any task
+size_t str_copy(StrId id, char *buf, size_t len);
+
+// Interning counters in Prometheus text format (for /metrics)
+void str_report_metrics(Print &out);
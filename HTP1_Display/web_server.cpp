@@ -1,40 +1,438 @@
 #include "web_server.h"
 #include "config.h"
 #include "web_ui.h"
+#include "power_manager.h"
+#include "layout.h"
+#include "ota_manager.h"
+#include "ota_pull.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "button_handler.h"
+#include "proxy.h"
+#include "recorder.h"
+#include "discovery.h"
+#include "burnin.h"
+#include "display_manager.h"
+#include "brightness.h"
+#include "mso_mirror.h"
 #include <WiFi.h>
 #include <ESPAsyncWebServer.h>
 #include <ArduinoJson.h>
-#include <Update.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 static AsyncWebServer server(80);
+static AsyncEventSource events("/events");
 static AppSettings *cfg = nullptr;
 static void (*settingsChangedCb)() = nullptr;
+static volatile int cachedRssi = 0;   // Sampled by webserver_poll()
 
 // --- GET / — serve the web UI ---
+// The page is embedded pre-gzipped (tools/embed_web_ui.py) with a strong
+// ETag. "no-cache" makes browsers revalidate on every load, which costs a
+// header-only 304 instead of re-sending the page.
+static uint32_t uiServed = 0, uiNotModified = 0;
+
 static void handleRoot(AsyncWebServerRequest *req) {
-    req->send_P(200, "text/html", WEB_HTML);
+    if (req->hasHeader("If-None-Match") &&
+        req->getHeader("If-None-Match")->value() == WEB_UI_ETAG) {
+        AsyncWebServerResponse *res = req->beginResponse(304);
+        res->addHeader("ETag", WEB_UI_ETAG);
+        res->addHeader("Cache-Control", "no-cache");
+        req->send(res);
+        uiNotModified++;
+        return;
+    }
+
+    AsyncWebServerResponse *res = req->beginResponse_P(200, "text/html", WEB_UI_GZ, WEB_UI_GZ_LEN);
+    res->addHeader("Content-Encoding", "gzip");
+    res->addHeader("ETag", WEB_UI_ETAG);
+    res->addHeader("Cache-Control", "no-cache");
+    req->send(res);
+    uiServed++;
 }
 
 // --- GET /status — live status JSON ---
 static void handleStatus(AsyncWebServerRequest *req) {
-    const HTP1State &st = htp1_get_state();
+    HTP1State st;
+    htp1_snapshot(st);
+    char input[STR_TABLE_MAX_LEN + 1], codec[STR_TABLE_MAX_LEN + 1];
+    str_copy(st.inputLabel, input, sizeof(input));
+    str_copy(st.codecName, codec, sizeof(codec));
     JsonDocument doc;
 
     doc["wifi"]  = (WiFi.status() == WL_CONNECTED);
     doc["ip"]    = WiFi.localIP().toString();
-    doc["rssi"]  = WiFi.RSSI();
+    doc["rssi"]  = cachedRssi;
     doc["htp1"]  = htp1_connected();
     doc["vol"]   = st.volume + st.volumeOffset;
     doc["muted"] = st.muted;
-    doc["input"] = st.inputLabel;
-    doc["codec"] = st.codecName;
+    doc["input"] = input;
+    doc["codec"] = codec;
     doc["power"] = st.powerIsOn;
 
+    // Every configured processor (1-based, like the settings and /api/*)
+    doc["unit"] = htp1_active() + 1;
+    JsonArray units = doc["units"].to<JsonArray>();
+    for (uint8_t u = 0; u < htp1_unit_count(); u++) {
+        HTP1State us;
+        htp1_snapshot(us, u);
+        char uinput[STR_TABLE_MAX_LEN + 1];
+        str_copy(us.inputLabel, uinput, sizeof(uinput));
+        JsonObject o = units.add<JsonObject>();
+        o["target"] = htp1_target(u);
+        o["htp1"]   = htp1_connected(u);
+        o["vol"]    = us.volume + us.volumeOffset;
+        o["muted"]  = us.muted;
+        o["input"]  = uinput;
+        o["power"]  = us.powerIsOn;
+    }
+
     String json;
     serializeJson(doc, json);
     req->send(200, "application/json", json);
 }
 
+// ============================================================
+// Live status stream — GET /events (Server-Sent Events)
+// ============================================================
+// The loop takes a snapshot and sends only the fields that changed since
+// the last push ("delta" events): HTP-1 fields by their change generation,
+// link fields by value. New clients get a full "status" event on connect.
+// Pushes are coalesced to at most one per SSE_MIN_INTERVAL_MS. Each
+// subscriber's backlog is tracked on its own: a client with
+// SSE_MAX_BACKLOG events still queued is skipped while the others stay
+// live, and once it drains it gets one full "status" event instead of the
+// deltas it missed. RSSI is sampled on its own slow timer.
+
+struct StatusSnapshot {
+    bool wifi;
+    bool htp1;
+    int  rssi;
+    uint8_t unit;           // Active unit the state below belongs to
+    HTP1State st;           // Published HTP-1 state (carries its field generations)
+};
+
+// Subscribers — added / removed on async_tcp, sent to from the loop (sseLock)
+struct SseClient {
+    AsyncEventSourceClient *client;
+    bool resync;            // Skipped a delta: next push is a full "status"
+};
+static SseClient sseClients[SSE_MAX_CLIENTS];
+static SemaphoreHandle_t sseLock = nullptr;
+
+static StatusSnapshot lastSent;
+static bool lastSentValid = false;
+static unsigned long lastRssiSample = 0;
+static unsigned long lastPush = 0;
+static uint32_t eventSeq = 0;
+
+// Counters for /metrics
+static uint32_t sseEventsSent = 0;
+static uint32_t sseEventsSkipped = 0;
+static uint32_t sseResyncs = 0;
+static uint32_t sseConnects = 0;
+static uint32_t sseRejected = 0;
+
+// Safe from any task: onEventsConnect runs on async_tcp
+static void take_snapshot(StatusSnapshot &s) {
+    s.wifi = (WiFi.status() == WL_CONNECTED);
+    s.unit = htp1_active();
+    s.htp1 = htp1_connected(s.unit);
+    s.rssi = cachedRssi;
+    htp1_snapshot(s.st, s.unit);
+}
+
+// Serialize `s`; with `prev`, only the fields that changed. Returns false if none did.
+static bool snapshot_json(const StatusSnapshot &s, const StatusSnapshot *prev, String &out) {
+    JsonDocument doc;
+    if (!prev || s.wifi != prev->wifi) doc["wifi"] = s.wifi;
+    if (!prev || s.htp1 != prev->htp1) doc["htp1"] = s.htp1;
+    if (!prev || s.rssi != prev->rssi) doc["rssi"] = s.rssi;
+
+    // Generations are per unit: after a switch every field is new
+    bool sameUnit = prev && prev->unit == s.unit;
+    if (!sameUnit) doc["unit"] = s.unit + 1;
+
+    const HTP1State &st = s.st;
+    uint16_t dirty = sameUnit ? htp1_changed_since(st, prev->st.generation) : HF_ALL;
+    if (dirty & (HF_BIT(HF_VOLUME) | HF_BIT(HF_VOLUME_OFFSET))) doc["vol"] = st.volume + st.volumeOffset;
+    if (dirty & HF_BIT(HF_MUTED)) doc["muted"] = st.muted;
+    if (dirty & HF_BIT(HF_POWER)) doc["power"] = st.powerIsOn;
+    // Copied out: this also runs on the async_tcp task (new subscribers)
+    char input[STR_TABLE_MAX_LEN + 1], codec[STR_TABLE_MAX_LEN + 1];
+    if (dirty & HF_BIT(HF_INPUT)) {
+        str_copy(st.inputLabel, input, sizeof(input));
+        doc["input"] = input;
+    }
+    if (dirty & HF_BIT(HF_CODEC)) {
+        str_copy(st.codecName, codec, sizeof(codec));
+        doc["codec"] = codec;
+    }
+    if (!prev) doc["ip"] = WiFi.localIP().toString();
+    if (doc.size() == 0) return false;
+
+    out = "";
+    serializeJson(doc, out);
+    return true;
+}
+
+// --- Subscriber limit: every accepted client needs a tracking slot ---
+static bool onEventsAuthorize(AsyncWebServerRequest *req) {
+    if (events.count() < SSE_MAX_CLIENTS) return true;
+    sseRejected++;
+    return false;
+}
+
+// --- New subscriber: track it, send the full picture to that client only ---
+static void onEventsConnect(AsyncEventSourceClient *client) {
+    xSemaphoreTake(sseLock, portMAX_DELAY);
+    for (SseClient &c : sseClients) {
+        if (c.client) continue;
+        c.client = client;
+        c.resync = false;
+        break;
+    }
+    StatusSnapshot s;
+    take_snapshot(s);
+    String json;
+    snapshot_json(s, nullptr, json);
+    client->send(json.c_str(), "status", eventSeq, 3000);  // 3 s browser retry
+    xSemaphoreGive(sseLock);
+    sseConnects++;
+}
+
+// --- Subscriber gone: the library deletes the client after this returns ---
+static void onEventsDisconnect(AsyncEventSourceClient *client) {
+    xSemaphoreTake(sseLock, portMAX_DELAY);
+    for (SseClient &c : sseClients) {
+        if (c.client == client) c.client = nullptr;
+    }
+    xSemaphoreGive(sseLock);
+}
+
+void webserver_poll() {
+    unsigned long now = millis();
+
+    // Link quality: sample slowly, counts as a change only past a threshold
+    if (now - lastRssiSample >= SSE_RSSI_INTERVAL_MS || lastRssiSample == 0) {
+        lastRssiSample = now;
+        int rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+        if (abs(rssi - cachedRssi) >= SSE_RSSI_DELTA || rssi == 0) cachedRssi = rssi;
+    }
+
+    if (events.count() == 0) {
+        lastSentValid = false;  // Next subscriber starts from a full snapshot
+        return;
+    }
+    if (now - lastPush < SSE_MIN_INTERVAL_MS) return;
+
+    StatusSnapshot s;
+    take_snapshot(s);
+    String json;
+    if (!snapshot_json(s, lastSentValid ? &lastSent : nullptr, json)) {
+        if (now - lastPush >= SSE_KEEPALIVE_MS) {
+            events.send("", "ping", 0, 0);
+            lastPush = now;
+        }
+        return;
+    }
+
+    // Per client: skip laggards, resync them with a full status once drained
+    const char *kind = lastSentValid ? "delta" : "status";
+    String full;
+    ++eventSeq;
+    xSemaphoreTake(sseLock, portMAX_DELAY);
+    for (SseClient &c : sseClients) {
+        if (!c.client) continue;
+        if (c.client->packetsWaiting() >= SSE_MAX_BACKLOG) {
+            c.resync = true;
+            sseEventsSkipped++;
+            continue;
+        }
+        if (c.resync && lastSentValid) {
+            if (full.isEmpty()) snapshot_json(s, nullptr, full);
+            c.client->send(full.c_str(), "status", eventSeq);
+            sseResyncs++;
+        } else {
+            c.client->send(json.c_str(), kind, eventSeq);
+        }
+        c.resync = false;
+    }
+    xSemaphoreGive(sseLock);
+    lastSent = s;
+    lastSentValid = true;
+    lastPush = now;
+    sseEventsSent++;
+}
+
+// --- GET /metrics — Prometheus text exposition ---
+static void handleMetrics(AsyncWebServerRequest *req) {
+    AsyncResponseStream *res = req->beginResponseStream("text/plain; version=0.0.4");
+    metrics_report(*res);
+    res->printf("# HELP htp1_wifi_rssi_dbm WiFi signal strength\n"
+                "# TYPE htp1_wifi_rssi_dbm gauge\n"
+                "htp1_wifi_rssi_dbm %d\n", (int)cachedRssi);
+    res->printf("# HELP htp1_connected HTP-1 WebSocket connected (active unit)\n"
+                "# TYPE htp1_connected gauge\n"
+                "htp1_connected %d\n", htp1_connected() ? 1 : 0);
+    res->printf("# HELP htp1_sse_clients Connected /events subscribers\n"
+                "# TYPE htp1_sse_clients gauge\n"
+                "htp1_sse_clients %u\n", (unsigned)events.count());
+    res->printf("# HELP htp1_sse_events_sent_total Status events pushed\n"
+                "# TYPE htp1_sse_events_sent_total counter\n"
+                "htp1_sse_events_sent_total %u\n", sseEventsSent);
+    res->printf("# HELP htp1_sse_events_skipped_total Events not sent to a client with a full backlog\n"
+                "# TYPE htp1_sse_events_skipped_total counter\n"
+                "htp1_sse_events_skipped_total %u\n", sseEventsSkipped);
+    res->printf("# HELP htp1_sse_resyncs_total Full status events sent to clients that had skipped deltas\n"
+                "# TYPE htp1_sse_resyncs_total counter\n"
+                "htp1_sse_resyncs_total %u\n", sseResyncs);
+    res->printf("# HELP htp1_sse_connects_total /events subscriptions by result\n"
+                "# TYPE htp1_sse_connects_total counter\n"
+                "htp1_sse_connects_total{result=\"accepted\"} %u\n"
+                "htp1_sse_connects_total{result=\"rejected\"} %u\n", sseConnects, sseRejected);
+    res->printf("# HELP htp1_web_ui_requests_total Web UI page loads by result\n"
+                "# TYPE htp1_web_ui_requests_total counter\n"
+                "htp1_web_ui_requests_total{result=\"200\"} %u\n"
+                "htp1_web_ui_requests_total{result=\"304\"} %u\n", uiServed, uiNotModified);
+    htp1_report_metrics(*res);
+    ota_report_metrics(*res);
+    buttons_report_metrics(*res);
+    proxy_report_metrics(*res);
+    recorder_report_metrics(*res);
+    discovery_report_metrics(*res);
+    display_report_metrics(*res);
+    brightness_report_metrics(*res);
+    burnin_report_metrics(*res);
+    mso_report_metrics(*res);
+    str_report_metrics(*res);
+#if LOOP_PROFILER
+    prof_report_metrics(*res);
+#endif
+    req->send(res);
+}
+
+// --- GET /mso?path=/status — subtree of the HTP-1 state mirror ---
+static void handleMso(AsyncWebServerRequest *req) {
+    if (!mso_loaded()) {
+        req->send(503, "text/plain", "No mso document yet");
+        return;
+    }
+    String path = req->hasParam("path") ? req->getParam("path")->value() : String();
+    AsyncResponseStream *res = req->beginResponseStream("application/json");
+    if (!mso_write_json(path.c_str(), *res)) res->setCode(404);
+    req->send(res);
+}
+
+// ============================================================
+// Command API — POST /api/volume, /api/mute, /api/input, /api/power
+// ============================================================
+// Sent to the HTP-1 as changemso commands over the display's own
+// WebSocket, so home automation doesn't need a connection of its own.
+// Parameters come from the query string or a form body. Commands are
+// queued and coalesced by htp1_client; the reply is 202 once queued.
+
+static const char* api_param(AsyncWebServerRequest *req, const char *name) {
+    if (req->hasParam(name, true)) return req->getParam(name, true)->value().c_str();
+    if (req->hasParam(name)) return req->getParam(name)->value().c_str();
+    return nullptr;
+}
+
+static bool parse_int(const char *s, int &out) {
+    if (!s || !*s) return false;
+    char *end;
+    long v = strtol(s, &end, 10);
+    if (*end) return false;
+    out = (int)v;
+    return true;
+}
+
+// ?unit=<1..N> picks a processor (default: the active one)
+static bool api_unit(AsyncWebServerRequest *req, uint8_t &unit) {
+    const char *s = api_param(req, "unit");
+    int n;
+    unit = HTP1_ACTIVE;
+    if (!s) return true;
+    if (!parse_int(s, n) || n < 1 || n > htp1_unit_count()) return false;
+    unit = n - 1;
+    return true;
+}
+
+static void api_reply(AsyncWebServerRequest *req, bool queued) {
+    if (queued) req->send(202, "application/json", "{\"ok\":true}");
+    else        req->send(503, "application/json", "{\"ok\":false,\"error\":\"HTP-1 not connected\"}");
+}
+
+static void api_bad(AsyncWebServerRequest *req, const char *msg) {
+    JsonDocument doc;
+    doc["ok"] = false;
+    doc["error"] = msg;
+    String json;
+    serializeJson(doc, json);
+    req->send(400, "application/json", json);
+}
+
+// ?value=<raw dB> or ?step=<+/-dB>
+static void handleApiVolume(AsyncWebServerRequest *req) {
+    int v;
+    uint8_t unit;
+    if (!api_unit(req, unit)) { api_bad(req, "no such unit"); return; }
+    if (parse_int(api_param(req, "value"), v)) {
+        if (v < HTP1_VOLUME_MIN || v > HTP1_VOLUME_MAX) { api_bad(req, "value out of range"); return; }
+        api_reply(req, htp1_queue_volume(v, false, unit));
+    } else if (parse_int(api_param(req, "step"), v)) {
+        if (v == 0 || abs(v) > 20) { api_bad(req, "step must be -20..20"); return; }
+        api_reply(req, htp1_queue_volume(v, true, unit));
+    } else {
+        api_bad(req, "value or step required");
+    }
+}
+
+// ?state=on|off|toggle (default toggle)
+static void handleApiMute(AsyncWebServerRequest *req) {
+    const char *st = api_param(req, "state");
+    int8_t mute;
+    uint8_t unit;
+    if (!api_unit(req, unit)) { api_bad(req, "no such unit"); return; }
+    if (!st || strcmp(st, "toggle") == 0) mute = -1;
+    else if (strcmp(st, "on") == 0)       mute = 1;
+    else if (strcmp(st, "off") == 0)      mute = 0;
+    else { api_bad(req, "state must be on, off or toggle"); return; }
+    api_reply(req, htp1_queue_mute(mute, unit));
+}
+
+// ?id=<HTP-1 input code>, e.g. h1
+static void handleApiInput(AsyncWebServerRequest *req) {
+    const char *id = api_param(req, "id");
+    size_t len = id ? strlen(id) : 0;
+    uint8_t unit;
+    if (!api_unit(req, unit)) { api_bad(req, "no such unit"); return; }
+    if (len == 0 || len > 15) { api_bad(req, "id required (1-15 chars)"); return; }
+    for (size_t i = 0; i < len; i++) {
+        if (!isalnum((unsigned char)id[i]) && id[i] != '_' && id[i] != '-') {
+            api_bad(req, "id may only contain letters, digits, _ and -");
+            return;
+        }
+    }
+    api_reply(req, htp1_queue_input(id, unit));
+}
+
+// ?state=on|off
+static void handleApiPower(AsyncWebServerRequest *req) {
+    const char *st = api_param(req, "state");
+    uint8_t unit;
+    if (!api_unit(req, unit)) { api_bad(req, "no such unit"); return; }
+    if (st && strcmp(st, "on") == 0)       api_reply(req, htp1_queue_power(true, unit));
+    else if (st && strcmp(st, "off") == 0) api_reply(req, htp1_queue_power(false, unit));
+    else api_bad(req, "state must be on or off");
+}
+
+// --- GET /power — power-budget report JSON ---
+static void handlePower(AsyncWebServerRequest *req) {
+    req->send(200, "application/json", power_report_json());
+}
+
 // --- GET /settings — current settings as JSON ---
 static void handleGetSettings(AsyncWebServerRequest *req) {
     if (!cfg) { req->send(500); return; }
@@ -50,8 +448,24 @@ static void handleGetSettings(AsyncWebServerRequest *req) {
     doc["dimbrt"]   = cfg->dim_brightness;
     doc["dmode"]    = (uint8_t)cfg->display_mode;
     doc["theme"]    = (uint8_t)cfg->color_theme;
+    doc["burnin"]   = cfg->burnin_protect;
     doc["sleepen"]  = cfg->sleep_enabled;
     doc["sleeptm"]  = cfg->sleep_timeout;
+    doc["lowpwr"]   = cfg->low_power;
+    doc["btnrem"]   = cfg->button_remote;
+    doc["proxy"]    = cfg->proxy_mode;
+    doc["updurl"]   = cfg->update_url;
+    doc["updauto"]  = cfg->update_auto;
+    doc["unit"]     = cfg->active_unit + 1;
+    doc["split"]    = cfg->split_view;
+
+    // Extra processors (unit 2 onwards)
+    JsonArray units = doc["units"].to<JsonArray>();
+    for (int i = 0; i < HTP1_MAX_UNITS - 1; i++) {
+        JsonObject u = units.add<JsonObject>();
+        u["ip"]   = cfg->unit_ip[i];
+        u["port"] = cfg->unit_port[i];
+    }
 
     JsonArray vs = doc["volSizes"].to<JsonArray>();
     JsonArray ls = doc["labelSizes"].to<JsonArray>();
@@ -99,6 +513,7 @@ static void handlePostSettingsRequest(AsyncWebServerRequest *req) {
     // Factory reset
     if (doc["reset"].as<bool>()) {
         settings_reset(*cfg);
+        layout_custom_load();  // Blob was cleared with the namespace
         if (settingsChangedCb) settingsChangedCb();
         req->send(200, "application/json", "{\"ok\":true}");
         return;
@@ -128,10 +543,36 @@ static void handlePostSettingsRequest(AsyncWebServerRequest *req) {
         cfg->display_mode = (DisplayMode)constrain(doc["dmode"].as<int>(), 0, MODE_COUNT - 1);
     if (doc["theme"].is<int>())
         cfg->color_theme = (ColorTheme)constrain(doc["theme"].as<int>(), 0, THEME_COUNT - 1);
+    if (doc["burnin"].is<bool>())
+        cfg->burnin_protect = doc["burnin"];
     if (doc["sleepen"].is<bool>())
         cfg->sleep_enabled = doc["sleepen"];
     if (doc["sleeptm"].is<int>())
         cfg->sleep_timeout = doc["sleeptm"];
+    if (doc["lowpwr"].is<bool>())
+        cfg->low_power = doc["lowpwr"];
+    if (doc["btnrem"].is<bool>())
+        cfg->button_remote = doc["btnrem"];
+    if (doc["proxy"].is<bool>())
+        cfg->proxy_mode = doc["proxy"];
+    if (doc["updurl"].is<const char*>())
+        strlcpy(cfg->update_url, doc["updurl"] | "", sizeof(cfg->update_url));
+    if (doc["updauto"].is<bool>())
+        cfg->update_auto = doc["updauto"];
+    if (doc["unit"].is<int>())
+        cfg->active_unit = constrain(doc["unit"].as<int>(), 1, HTP1_MAX_UNITS) - 1;
+    if (doc["split"].is<bool>())
+        cfg->split_view = doc["split"];
+    if (doc["units"].is<JsonArray>()) {
+        JsonArray units = doc["units"];
+        for (int i = 0; i < HTP1_MAX_UNITS - 1 && i < (int)units.size(); i++) {
+            JsonObject u = units[i];
+            if (u["ip"].is<const char*>())
+                strlcpy(cfg->unit_ip[i], u["ip"] | "", sizeof(cfg->unit_ip[i]));
+            if (u["port"].is<int>())
+                cfg->unit_port[i] = u["port"];
+        }
+    }
 
     if (doc["volSizes"].is<JsonArray>()) {
         JsonArray vs = doc["volSizes"];
@@ -167,38 +608,245 @@ static void handlePostSettingsRequest(AsyncWebServerRequest *req) {
     req->send(200, "application/json", "{\"ok\":true}");
 }
 
+// --- Custom layout JSON <-> LayoutSlot ---
+// Enum values travel as names so the stored format can change freely.
+static const char* const FIELD_NAMES[FIELD_COUNT] = {
+    "volume", "input", "codec", "surround", "listenfmt", "power" };
+static const char* const COLOR_NAMES[COLOR_ROLE_COUNT] = { "fg", "dim", "alert" };
+static const char* const H_NAMES[] = { "left", "center", "right" };
+static const char* const V_NAMES[] = {
+    "top", "center", "belowlabel", "between", "bottomrow", "bottom" };
+
+static int name_index(const char* const *names, int count, const char *name) {
+    for (int i = 0; i < count; i++) {
+        if (name && strcmp(names[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+#define NAME_COUNT(a) (int)(sizeof(a) / sizeof(a[0]))
+
+// --- GET /layout — custom layout as JSON ---
+static void handleGetLayout(AsyncWebServerRequest *req) {
+    LayoutSlot slots[LAYOUT_MAX_OPS];
+    uint8_t n = layout_custom_get(slots);
+    JsonDocument doc;
+
+    doc["max"] = LAYOUT_MAX_OPS;
+    JsonArray arr = doc["slots"].to<JsonArray>();
+    for (uint8_t i = 0; i < n; i++) {
+        const LayoutSlot &s = slots[i];
+        JsonObject o = arr.add<JsonObject>();
+        o["field"] = FIELD_NAMES[s.field];
+        o["font"]  = s.font;
+        if (s.size == SIZE_VOLUME)     o["size"] = "vol";
+        else if (s.size == SIZE_LABEL) o["size"] = "label";
+        else                           o["size"] = s.fixedSize;
+        o["h"]      = H_NAMES[s.h];
+        o["x"]      = s.margin;
+        o["v"]      = V_NAMES[s.v];
+        o["y"]      = s.offset;
+        o["color"]  = COLOR_NAMES[s.color];
+        o["shrink"] = s.maxWidth;
+    }
+
+    String json;
+    serializeJson(doc, json);
+    req->send(200, "application/json", json);
+}
+
+// --- POST /layout — body handler (accumulates JSON) ---
+static String layoutBody;
+
+static void handlePostLayoutBody(AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total) {
+    if (index == 0) layoutBody = "";
+    layoutBody.concat((const char*)data, len);
+}
+
+static void send_layout_error(AsyncWebServerRequest *req, const char *msg) {
+    JsonDocument doc;
+    doc["ok"] = false;
+    doc["error"] = msg;
+    String json;
+    serializeJson(doc, json);
+    req->send(400, "application/json", json);
+}
+
+// --- POST /layout — validate, store and apply a custom layout ---
+static void handlePostLayoutRequest(AsyncWebServerRequest *req) {
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, layoutBody);
+    layoutBody = "";
+
+    if (err || !doc["slots"].is<JsonArray>()) {
+        send_layout_error(req, "bad json");
+        return;
+    }
+
+    JsonArray arr = doc["slots"];
+    if (arr.size() == 0 || arr.size() > LAYOUT_MAX_OPS) {
+        send_layout_error(req, "bad field count");
+        return;
+    }
+
+    LayoutSlot slots[LAYOUT_MAX_OPS];
+    uint8_t n = 0;
+    for (JsonObject o : arr) {
+        LayoutSlot &s = slots[n];
+        int field = name_index(FIELD_NAMES, FIELD_COUNT, o["field"]);
+        int h     = name_index(H_NAMES, NAME_COUNT(H_NAMES), o["h"] | "left");
+        int v     = name_index(V_NAMES, NAME_COUNT(V_NAMES), o["v"] | "top");
+        int color = name_index(COLOR_NAMES, COLOR_ROLE_COUNT, o["color"] | "fg");
+        if (field < 0 || h < 0 || v < 0 || color < 0) {
+            send_layout_error(req, "unknown field / anchor / colour name");
+            return;
+        }
+
+        // Range-checked as int before narrowing, so 300 can't wrap to a valid 44
+        const char *size = o["size"].is<const char*>() ? o["size"].as<const char*>() : nullptr;
+        int font   = o["font"] | (field == FIELD_VOLUME ? 7 : 4);
+        int fixed  = size ? 0 : (o["size"] | 1);
+        int x      = o["x"] | 0;
+        int y      = o["y"] | 0;
+        int shrink = o["shrink"] | 0;
+        const char *bad = nullptr;
+        if (font < 0 || font > 255)                              bad = "font";
+        else if (!size && (fixed < 1 || fixed > 7))              bad = "size";
+        else if (x < -DISPLAY_WIDTH || x > DISPLAY_WIDTH)        bad = "x";
+        else if (y < -DISPLAY_HEIGHT || y > DISPLAY_HEIGHT)      bad = "y";
+        else if (shrink < 0 || shrink > DISPLAY_WIDTH)           bad = "shrink width";
+        if (bad) {
+            char msg[32];
+            snprintf(msg, sizeof(msg), "slot %u: bad %s", n, bad);
+            send_layout_error(req, msg);
+            return;
+        }
+
+        s.field = (LayoutField)field;
+        s.font  = font;
+        if (size && strcmp(size, "vol") == 0) {
+            s.size = SIZE_VOLUME;  s.fixedSize = 0;
+        } else if (size && strcmp(size, "label") == 0) {
+            s.size = SIZE_LABEL;   s.fixedSize = 0;
+        } else {
+            s.size = SIZE_FIXED;   s.fixedSize = size ? 1 : fixed;
+        }
+        s.h        = (HAnchor)h;
+        s.margin   = x;
+        s.v        = (VAnchor)v;
+        s.offset   = y;
+        s.color    = (ColorRole)color;
+        s.maxWidth = shrink;
+        n++;
+    }
+
+    char msg[48];
+    if (!layout_custom_set(slots, n, msg, sizeof(msg))) {
+        send_layout_error(req, msg);
+        return;
+    }
+
+    if (settingsChangedCb) settingsChangedCb();  // Loop re-resolves the layout
+    req->send(200, "application/json", "{\"ok\":true}");
+}
+
 // --- POST /update — OTA firmware upload ---
+// The expected SHA-256 travels alongside the image as ?sha256=<hex> (or an
+// X-SHA256 header); ?size= lets Update pre-check the partition size.
+// Per-request state lives in _tempObject (freed by the library), so a
+// second upload while one is running is answered 409 and never touches it.
+struct OtaUpload {
+    OtaToken token;           // 0 = this request does not own the update
+    OtaBeginResult begin;
+    bool done;                // ota_end succeeded
+    char error[48];
+};
+
 static void handleOTAUpload(AsyncWebServerRequest *req, const String& filename,
                              size_t index, uint8_t *data, size_t len, bool final) {
-    if (index == 0) {
-        Serial.printf("[OTA] Begin: %s\n", filename.c_str());
-        if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
-            Update.printError(Serial);
+    if (index == 0 && !req->_tempObject) {
+        OtaUpload *up = (OtaUpload*)calloc(1, sizeof(OtaUpload));
+        if (!up) return;
+        req->_tempObject = up;
+        String sha = req->hasParam("sha256") ? req->getParam("sha256")->value()
+                   : req->hasHeader("X-SHA256") ? req->getHeader("X-SHA256")->value()
+                   : String();
+        size_t size = req->hasParam("size") ? req->getParam("size")->value().toInt() : 0;
+        Serial.printf("[OTA] Upload: %s\n", filename.c_str());
+        up->begin = ota_begin(up->token, size, sha.c_str());
+        if (up->begin == OTA_STARTED) {
+            OtaToken token = up->token;
+            req->onDisconnect([token]() { ota_abort(token, "upload disconnected"); });
         }
     }
 
-    if (Update.isRunning()) {
-        if (Update.write(data, len) != len) {
-            Update.printError(Serial);
-        }
+    OtaUpload *up = (OtaUpload*)req->_tempObject;
+    if (!up || !up->token || up->error[0]) return;
+    if (len > 0 && !ota_write(up->token, data, len)) {
+        strlcpy(up->error, ota_last_error() ? ota_last_error() : "write failed", sizeof(up->error));
+        return;
     }
-
     if (final) {
-        if (Update.end(true)) {
-            Serial.printf("[OTA] Success: %u bytes\n", index + len);
-        } else {
-            Update.printError(Serial);
+        up->done = ota_end(up->token);
+        if (!up->done) {
+            strlcpy(up->error, ota_last_error() ? ota_last_error() : "verify failed", sizeof(up->error));
         }
     }
 }
 
 static void handleOTADone(AsyncWebServerRequest *req) {
-    bool ok = !Update.hasError();
-    req->send(ok ? 200 : 500, "text/plain", ok ? "OK" : "FAIL");
-    if (ok) {
-        delay(500);
-        ESP.restart();
+    OtaUpload *up = (OtaUpload*)req->_tempObject;
+    if (up && up->begin == OTA_BUSY) {
+        req->send(409, "text/plain", "another update is running");
+        return;
+    }
+    if (!up || !up->done) {
+        const char *err = up && up->error[0] ? up->error
+                        : up && up->begin == OTA_FAILED && ota_last_error() ? ota_last_error()
+                        : "upload incomplete";
+        if (up) ota_abort(up->token, "upload incomplete");
+        req->send(500, "text/plain", err);
+        return;
     }
+    req->send(200, "text/plain", "OK");
+    ota_request_reboot();  // Loop reboots once the reply is out
+}
+
+// --- GET /ota — last update stats + fleet counters ---
+static void handleOTAStatus(AsyncWebServerRequest *req) {
+    req->send(200, "application/json", ota_report_json());
+}
+
+// --- GET /ota/pull — update server check status; POST — check now ---
+static void handlePullStatus(AsyncWebServerRequest *req) {
+    req->send(200, "application/json", ota_pull_status_json());
+}
+
+static void handlePullCheck(AsyncWebServerRequest *req) {
+    ota_pull_check_now();
+    req->send(200, "application/json", "{\"ok\":true}");
+}
+
+static void handleDiscover(AsyncWebServerRequest *req) {
+    req->send(200, "application/json", discovery_json());
+}
+
+static void handleDiscoverScan(AsyncWebServerRequest *req) {
+    discovery_rescan();
+    req->send(200, "application/json", "{\"ok\":true}");
+}
+
+// --- GET /burnin — wear map and current offset ---
+static void handleBurnin(AsyncWebServerRequest *req) {
+    AsyncResponseStream *res = req->beginResponseStream("application/json");
+    burnin_write_json(*res);
+    req->send(res);
+}
+
+// --- POST /burnin/reset — clear the wear map (e.g. after a panel swap) ---
+static void handleBurninReset(AsyncWebServerRequest *req) {
+    burnin_reset();
+    req->send(200, "application/json", "{\"ok\":true}");
 }
 
 // ============================================================
@@ -211,10 +859,39 @@ void webserver_begin(AppSettings *settings, void (*onSettingsChanged)()) {
 
     server.on("/", HTTP_GET, handleRoot);
     server.on("/status", HTTP_GET, handleStatus);
+    server.on("/power", HTTP_GET, handlePower);
+    server.on("/metrics", HTTP_GET, handleMetrics);
+    server.on("/mso", HTTP_GET, handleMso);
     server.on("/settings", HTTP_GET, handleGetSettings);
     server.on("/settings", HTTP_POST, handlePostSettingsRequest, nullptr, handlePostSettingsBody);
+    server.on("/layout", HTTP_GET, handleGetLayout);
+    server.on("/layout", HTTP_POST, handlePostLayoutRequest, nullptr, handlePostLayoutBody);
+
+    server.on("/api/volume", HTTP_POST, handleApiVolume);
+    server.on("/api/mute", HTTP_POST, handleApiMute);
+    server.on("/api/input", HTTP_POST, handleApiInput);
+    server.on("/api/power", HTTP_POST, handleApiPower);
 
     server.on("/update", HTTP_POST, handleOTADone, handleOTAUpload);
+    // "/ota" would also match "/ota/..." — register the longer path first
+    server.on("/ota/pull", HTTP_GET, handlePullStatus);
+    server.on("/ota/pull", HTTP_POST, handlePullCheck);
+    server.on("/ota", HTTP_GET, handleOTAStatus);
+    server.on("/discover", HTTP_GET, handleDiscover);
+    server.on("/discover", HTTP_POST, handleDiscoverScan);
+    server.on("/burnin/reset", HTTP_POST, handleBurninReset);
+    server.on("/burnin", HTTP_GET, handleBurnin);
+
+    sseLock = xSemaphoreCreateMutex();
+    events.authorizeConnect(onEventsAuthorize);
+    events.onConnect(onEventsConnect);
+    events.onDisconnect(onEventsDisconnect);
+    server.addHandler(&events);
+
+    // Local /ws/controller + /ircmd for proxy mode (idle until enabled)
+    proxy_begin(server);
+    // /recorder: raw HTP-1 traffic capture to LittleFS
+    recorder_begin(server);
 
     server.begin();
     Serial.println("[WEB] Server started on port 80");
@@ -8,4 +8,6 @@
 void webserver_begin(AppSettings *settings,
                      void (*onSettingsChanged)());
 
-// Nothing to poll — ESPAsyncWebServer runs on its own task
+// Push live status deltas to /events subscribers. Call from loop();
+// cheap when nothing changed or no browser is connected.
+void webserver_poll();
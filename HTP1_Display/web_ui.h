@@ -1,359 +1,614 @@
 #pragma once
 
-#include <Arduino.h>
-
-static const char WEB_HTML[] PROGMEM = R"rawliteral(<!DOCTYPE html>
-<html lang="en">
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width,initial-scale=1">
-<title>HTP-1 Display</title>
-<style>
-*{box-sizing:border-box;margin:0;padding:0}
-body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Roboto,sans-serif;
-  background:#1a1a2e;color:#e0e0e0;min-height:100vh}
-.header{background:#16213e;padding:12px 20px;display:flex;justify-content:space-between;align-items:center;
-  border-bottom:1px solid #0f3460}
-.header h1{font-size:1.2em;color:#e94560}
-.header .ver{font-size:0.8em;color:#888}
-.status-bar{background:#0f3460;padding:8px 20px;display:flex;gap:20px;flex-wrap:wrap;font-size:0.85em}
-.status-bar .item{display:flex;align-items:center;gap:5px}
-.status-bar .dot{width:8px;height:8px;border-radius:50%;display:inline-block}
-.dot.on{background:#4ecca3}.dot.off{background:#e94560}
-.container{max-width:720px;margin:20px auto;padding:0 16px}
-.card{background:#16213e;border-radius:8px;padding:16px 20px;margin-bottom:16px;border:1px solid #0f3460}
-.card h2{font-size:1em;color:#e94560;margin-bottom:12px;border-bottom:1px solid #0f3460;padding-bottom:8px}
-.field{margin-bottom:12px;display:flex;flex-wrap:wrap;align-items:center;gap:8px}
-.field label{min-width:140px;font-size:0.9em;color:#aaa}
-.field input[type=text],.field input[type=number],.field input[type=password],.field select{
-  flex:1;min-width:160px;padding:8px 10px;background:#1a1a2e;border:1px solid #0f3460;
-  border-radius:4px;color:#e0e0e0;font-size:0.9em}
-.field input:focus,.field select:focus{outline:none;border-color:#e94560}
-.themes{display:flex;gap:8px;flex-wrap:wrap}
-.themes .swatch{width:36px;height:36px;border-radius:50%;cursor:pointer;border:3px solid transparent;
-  transition:border-color 0.2s}
-.themes .swatch.active{border-color:#fff}
-.themes .swatch:hover{opacity:0.8}
-.btn{padding:8px 20px;border:none;border-radius:4px;cursor:pointer;font-size:0.9em;
-  transition:background 0.2s}
-.btn-primary{background:#e94560;color:#fff}
-.btn-primary:hover{background:#c73652}
-.btn-secondary{background:#0f3460;color:#e0e0e0}
-.btn-secondary:hover{background:#16213e}
-.btn-row{display:flex;gap:10px;margin-top:8px}
-.slider-wrap{flex:1;display:flex;align-items:center;gap:10px}
-.slider-wrap input[type=range]{flex:1;accent-color:#e94560}
-.slider-wrap .val{min-width:30px;text-align:right;font-size:0.9em;color:#4ecca3}
-.toggle{position:relative;width:44px;height:24px}
-.toggle input{opacity:0;width:0;height:0}
-.toggle .slider{position:absolute;inset:0;background:#333;border-radius:12px;cursor:pointer;
-  transition:background 0.3s}
-.toggle .slider::before{content:'';position:absolute;width:18px;height:18px;left:3px;top:3px;
-  background:#fff;border-radius:50%;transition:transform 0.3s}
-.toggle input:checked+.slider{background:#4ecca3}
-.toggle input:checked+.slider::before{transform:translateX(20px)}
-.upload-zone{border:2px dashed #0f3460;border-radius:8px;padding:30px;text-align:center;
-  cursor:pointer;transition:border-color 0.3s}
-.upload-zone:hover{border-color:#e94560}
-.upload-zone.active{border-color:#4ecca3}
-.progress{width:100%;height:6px;background:#1a1a2e;border-radius:3px;margin-top:12px;display:none}
-.progress .bar{height:100%;background:#4ecca3;border-radius:3px;width:0%;transition:width 0.3s}
-.msg{padding:8px 12px;border-radius:4px;margin-top:8px;display:none;font-size:0.85em}
-.msg.ok{display:block;background:#1a3a2a;color:#4ecca3;border:1px solid #4ecca3}
-.msg.err{display:block;background:#3a1a1a;color:#e94560;border:1px solid #e94560}
-.input-row{display:flex;gap:8px;align-items:center;margin-bottom:6px}
-.input-row input{padding:8px 10px;background:#1a1a2e;border:1px solid #0f3460;
-  border-radius:4px;color:#e0e0e0;font-size:0.9em}
-.input-row input.code{width:80px}.input-row input.name{flex:1}
-.input-row .del{background:none;border:none;color:#e94560;cursor:pointer;font-size:1.2em;padding:4px 8px}
-@media(max-width:480px){.field{flex-direction:column;align-items:flex-start}
-  .field label{min-width:auto}}
-</style>
-</head>
-<body>
-<div class="header">
-  <h1>HTP-1 Display</h1>
-  <span class="ver" id="fw">v--</span>
-</div>
-<div class="status-bar" id="statusBar">
-  <div class="item"><span class="dot" id="dotWifi"></span><span id="stWifi">WiFi: --</span></div>
-  <div class="item"><span class="dot" id="dotHtp"></span><span id="stHtp">HTP-1: --</span></div>
-  <div class="item" id="stVolWrap">Vol: <strong id="stVol">--</strong></div>
-  <div class="item">Input: <span id="stInput">--</span></div>
-  <div class="item">Codec: <span id="stCodec">--</span></div>
-</div>
-<div class="container">
-
-  <!-- WiFi Settings -->
-  <div class="card">
-    <h2>WiFi</h2>
-    <div class="field"><label>SSID</label><input type="text" id="ssid" maxlength="63"></div>
-    <div class="field"><label>Password</label><input type="password" id="wifipass" maxlength="63"></div>
-  </div>
-
-  <!-- HTP-1 Connection -->
-  <div class="card">
-    <h2>HTP-1 Connection</h2>
-    <div class="field"><label>IP Address</label><input type="text" id="htp1ip" placeholder="192.168.1.x"></div>
-    <div class="field"><label>Port</label><input type="number" id="htp1port" min="1" max="65535"></div>
-    <div class="field"><label>Volume Offset</label><input type="number" id="voloff" min="-20" max="20"></div>
-  </div>
-
-  <!-- Input Names -->
-  <div class="card">
-    <h2>Input Names</h2>
-    <p style="font-size:0.8em;color:#888;margin-bottom:10px">Map HTP-1 input codes (e.g. h1, h2, usb) to friendly names</p>
-    <div id="inputRows"></div>
-    <button class="btn btn-secondary" style="margin-top:8px" onclick="addInputRow('','')">+ Add Input</button>
-  </div>
-
-  <!-- Display Settings -->
-  <div class="card">
-    <h2>Display</h2>
-    <div class="field"><label>Brightness</label>
-      <div class="slider-wrap">
-        <input type="range" id="bright" min="0" max="6" step="1">
-        <span class="val" id="brightVal">3</span>
-      </div>
-    </div>
-    <div class="field"><label>Auto-dim (sec)</label>
-      <input type="number" id="dimtime" min="1" max="300"></div>
-    <div class="field"><label>Dim Brightness</label>
-      <div class="slider-wrap">
-        <input type="range" id="dimbrt" min="1" max="60" step="1">
-        <span class="val" id="dimbrtVal">7</span>
-      </div>
-    </div>
-    <div class="field"><label>Display Mode</label>
-      <select id="dmode">
-        <option value="0">Volume Only</option>
-        <option value="1">Volume + Source</option>
-        <option value="2">Volume + Codec</option>
-        <option value="3">Full Status</option>
-      </select>
-    </div>
-    <div class="field"><label>Volume Size</label>
-      <div class="slider-wrap">
-        <input type="range" id="volsize" min="1" max="5" step="1">
-        <span class="val" id="volsizeVal">3 (144px)</span>
-      </div>
-    </div>
-    <div class="field"><label>Label Size</label>
-      <div class="slider-wrap">
-        <input type="range" id="labelsize" min="1" max="3" step="1">
-        <span class="val" id="labelsizeVal">1 (26px)</span>
-      </div>
-    </div>
-    <div class="field"><label>Color Theme</label>
-      <div class="themes" id="themeRow">
-        <div class="swatch" data-t="0" style="background:#fff" title="White"></div>
-        <div class="swatch" data-t="1" style="background:#0f0" title="Green"></div>
-        <div class="swatch" data-t="2" style="background:#ffbe00" title="Amber"></div>
-        <div class="swatch" data-t="3" style="background:#00f" title="Blue"></div>
-        <div class="swatch" data-t="4" style="background:#f00" title="Red"></div>
-        <div class="swatch" data-t="5" style="background:#0ff" title="Cyan"></div>
-      </div>
-    </div>
-  </div>
-
-  <!-- Power Management -->
-  <div class="card">
-    <h2>Power Management</h2>
-    <div class="field"><label>Sleep Enabled</label>
-      <label class="toggle"><input type="checkbox" id="sleepen"><span class="slider"></span></label>
-    </div>
-    <div class="field"><label>Sleep Timeout (sec)</label>
-      <input type="number" id="sleeptm" min="10" max="3600"></div>
-  </div>
+// Generated by tools/embed_web_ui.py from web_ui.html — do not edit.
+// 30561 bytes HTML -> 9617 bytes gzip (69% smaller)
 
-  <div class="btn-row">
-    <button class="btn btn-primary" onclick="saveSettings()">Save Settings</button>
-    <button class="btn btn-secondary" onclick="resetSettings()">Reset to Defaults</button>
-  </div>
-  <div class="msg" id="settingsMsg"></div>
-
-  <!-- OTA Firmware Update -->
-  <div class="card" style="margin-top:16px">
-    <h2>Firmware Update</h2>
-    <div class="upload-zone" id="uploadZone" onclick="document.getElementById('fwFile').click()">
-      <p>Click or drag .bin file here</p>
-      <input type="file" id="fwFile" accept=".bin" style="display:none">
-    </div>
-    <div class="progress" id="progWrap"><div class="bar" id="progBar"></div></div>
-    <div class="msg" id="otaMsg"></div>
-  </div>
-
-</div>
-
-<script>
-let currentTheme=0;
-let volSizes=[5,4,4,4];
-let labelSizes=[1,2,2,1];
-const $=id=>document.getElementById(id);
-
-function setTheme(t){
-  currentTheme=t;
-  document.querySelectorAll('.swatch').forEach(s=>{
-    s.classList.toggle('active',parseInt(s.dataset.t)===t);
-  });
-}
-document.querySelectorAll('.swatch').forEach(s=>{
-  s.addEventListener('click',()=>setTheme(parseInt(s.dataset.t)));
-});
+#include <Arduino.h>
 
-$('bright').oninput=function(){$('brightVal').textContent=this.value};
-$('dimbrt').oninput=function(){$('dimbrtVal').textContent=this.value};
+#define WEB_UI_ETAG "\"da697806dbb936ca\""
+#define WEB_UI_GZ_LEN 9617
 
-function volSizeLabel(v){return v+' ('+v*48+'px)'}
-function labelSizeLabel(v){return v+' ('+v*26+'px)'}
-function updateSizeSliders(){
-  var m=parseInt($('dmode').value);
-  $('volsize').value=volSizes[m];
-  $('volsizeVal').textContent=volSizeLabel(volSizes[m]);
-  $('labelsize').value=labelSizes[m];
-  $('labelsizeVal').textContent=labelSizeLabel(labelSizes[m]);
-}
-$('volsize').oninput=function(){
-  var m=parseInt($('dmode').value),v=parseInt(this.value);
-  volSizes[m]=v;$('volsizeVal').textContent=volSizeLabel(v);
-};
-$('labelsize').oninput=function(){
-  var m=parseInt($('dmode').value),v=parseInt(this.value);
-  labelSizes[m]=v;$('labelsizeVal').textContent=labelSizeLabel(v);
+static const uint8_t WEB_UI_GZ[WEB_UI_GZ_LEN] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x7d, 0x6b, 0x7b, 0xdb, 0xb6,
+    0xd2, 0xe0, 0xf7, 0xfc, 0x0a, 0xd6, 0xe7, 0x6d, 0x48, 0xd6, 0x94, 0x44, 0xea, 0x6e, 0xc9, 0x74,
+    0x36, 0xd7, 0x4d, 0xf7, 0x24, 0x4d, 0x9e, 0x38, 0x6d, 0xdf, 0x77, 0xb3, 0xde, 0x3e, 0x20, 0x09,
+    0x4a, 0xac, 0x25, 0x52, 0x87, 0xa4, 0x64, 0xfb, 0xd8, 0xde, 0xdf, 0xbe, 0x33, 0x03, 0x90, 0x04,
+    0x29, 0xc9, 0x56, 0x9a, 0x74, 0xb7, 0x7d, 0x12, 0x91, 0xb8, 0x0c, 0x06, 0x83, 0xb9, 0x03, 0x60,
+    0x4e, 0x7f, 0x78, 0xf5, 0xe1, 0xe5, 0xe7, 0xff, 0xfa, 0xf8, 0x5a, 0x9b, 0xe7, 0xcb, 0xc5, 0xd9,
+    0x93, 0x53, 0xfc, 0xd1, 0x16, 0x2c, 0x9e, 0xb9, 0x47, 0x3c, 0x3e, 0xc2, 0x02, 0xce, 0x02, 0xf8,
+    0x59, 0xf2, 0x9c, 0x69, 0xfe, 0x9c, 0xa5, 0x19, 0xcf, 0xdd, 0xa3, 0x5f, 0x3f, 0xbf, 0x69, 0x8d,
+    0x8f, 0x8a, 0xe2, 0x98, 0x2d, 0xb9, 0x7b, 0xb4, 0x89, 0xf8, 0xd5, 0x2a, 0x49, 0xf3, 0x23, 0xcd,
+    0x4f, 0xe2, 0x9c, 0xc7, 0xd0, 0xec, 0x2a, 0x0a, 0xf2, 0xb9, 0x1b, 0xf0, 0x4d, 0xe4, 0xf3, 0x16,
+    0xbd, 0x58, 0x51, 0x1c, 0xe5, 0x11, 0x5b, 0xb4, 0x32, 0x9f, 0x2d, 0xb8, 0xeb, 0x20, 0x8c, 0x3c,
+    0xca, 0x17, 0xfc, 0xec, 0xed, 0xe7, 0x8f, 0x2d, 0x47, 0x7b, 0x15, 0x65, 0xab, 0x05, 0xbb, 0x39,
+    0xed, 0x88, 0xc2, 0x27, 0xa7, 0x59, 0x7e, 0x83, 0xbf, 0x3f, 0xdd, 0x7a, 0xc9, 0x75, 0x2b, 0x8b,
+    0xfe, 0x1d, 0xc5, 0xb3, 0x89, 0x97, 0xa4, 0x01, 0x4f, 0x5b, 0x50, 0x32, 0x5d, 0xb2, 0x74, 0x16,
+    0xc5, 0x13, 0x7b, 0xba, 0x62, 0x41, 0x80, 0x75, 0xf6, 0xfd, 0x13, 0x2f, 0x09, 0x6e, 0x6e, 0x43,
+    0xc0, 0xa1, 0x15, 0xb2, 0x65, 0xb4, 0xb8, 0x99, 0xb4, 0xd8, 0x6a, 0xb5, 0xe0, 0xad, 0xec, 0x26,
+    0xcb, 0xf9, 0xd2, 0x7a, 0xb1, 0x88, 0xe2, 0xcb, 0xf7, 0xcc, 0x3f, 0xa7, 0xd7, 0x37, 0xd0, 0xce,
+    0xd2, 0xcf, 0xf9, 0x2c, 0xe1, 0xda, 0xaf, 0x3f, 0xeb, 0xd6, 0xa7, 0xc4, 0x4b, 0xf2, 0xc4, 0xca,
+    0x58, 0x9c, 0xb5, 0x32, 0x9e, 0x46, 0xe1, 0xf4, 0x89, 0xa6, 0x79, 0xcc, 0xbf, 0x9c, 0xa5, 0xc9,
+    0x3a, 0x0e, 0x26, 0xff, 0x70, 0x98, 0xc3, 0xba, 0x7c, 0xea, 0x27, 0x8b, 0x24, 0x9d, 0xfc, 0x83,
+    0xdb, 0xf8, 0xff, 0x74, 0x19, 0xc5, 0xad, 0x39, 0x8f, 0x66, 0xf3, 0x7c, 0xe2, 0xd8, 0xf6, 0x66,
+    0x7e, 0xff, 0xa4, 0x8d, 0x74, 0xe3, 0xe9, 0x6d, 0xad, 0xeb, 0xb0, 0xeb, 0xf4, 0x78, 0x89, 0xaa,
+    0xd3, 0x5d, 0x5d, 0x6b, 0x5d, 0x7b, 0x75, 0x3d, 0x0d, 0xc4, 0xac, 0x27, 0xe1, 0x82, 0x5f, 0x4f,
+    0xff, 0x5c, 0x67, 0x79, 0x14, 0xde, 0xb4, 0x24, 0x15, 0x27, 0xd9, 0x8a, 0x01, 0xf5, 0x3c, 0x9e,
+    0x5f, 0x71, 0x1e, 0x4f, 0xd9, 0x22, 0x9a, 0xc5, 0xad, 0x08, 0x30, 0xcf, 0x26, 0x3e, 0x54, 0xf3,
+    0x94, 0x10, 0x2c, 0x28, 0x92, 0xe7, 0xc9, 0x72, 0xe2, 0x00, 0xdc, 0x2c, 0x59, 0x44, 0x81, 0xf6,
+    0x0f, 0x3b, 0xec, 0xf5, 0x87, 0x76, 0x89, 0x8e, 0x36, 0x77, 0x04, 0x65, 0x80, 0x92, 0x7c, 0xe2,
+    0xb4, 0xbb, 0x7c, 0x59, 0xce, 0xe4, 0xa4, 0x3f, 0x50, 0x5b, 0xb6, 0x37, 0x80, 0x7d, 0xd5, 0xd6,
+    0x6e, 0x8f, 0xab, 0xb6, 0xe3, 0xf1, 0x18, 0x1a, 0x66, 0x39, 0xcb, 0xd7, 0x59, 0xcb, 0x63, 0xf5,
+    0x59, 0x8a, 0x21, 0xcb, 0x59, 0x8e, 0x77, 0x4e, 0x72, 0xc6, 0x56, 0x13, 0x2a, 0xc5, 0xb7, 0xd6,
+    0x55, 0x0a, 0xaf, 0xf8, 0xd7, 0xb4, 0x36, 0xe0, 0x80, 0x2f, 0x6b, 0xc3, 0x68, 0x6d, 0x9c, 0xf7,
+    0x6d, 0x0d, 0xd0, 0x0e, 0x7a, 0x20, 0xec, 0xc1, 0xea, 0xba, 0xd1, 0x35, 0x48, 0xf2, 0x5b, 0x62,
+    0x41, 0xc4, 0x68, 0x2a, 0x17, 0x0b, 0x1f, 0x25, 0xed, 0x52, 0x16, 0x44, 0xeb, 0x6c, 0x32, 0xb0,
+    0x7f, 0x2c, 0x31, 0x8d, 0x62, 0x60, 0x15, 0x20, 0xfd, 0x22, 0xf1, 0x2f, 0x01, 0x1a, 0x40, 0x68,
+    0x27, 0x71, 0x6d, 0xae, 0x7d, 0xee, 0xfb, 0xac, 0x77, 0x2f, 0xaa, 0xc2, 0xb0, 0x56, 0x57, 0x12,
+    0x14, 0x17, 0x92, 0x01, 0xa0, 0xf4, 0x76, 0xc9, 0xae, 0x85, 0x18, 0x4c, 0x46, 0x34, 0x79, 0xc9,
+    0xbd, 0xf8, 0xac, 0xb1, 0x75, 0x9e, 0x54, 0x5c, 0xac, 0x39, 0x43, 0x9a, 0x81, 0xcf, 0xd2, 0x60,
+    0x17, 0x0f, 0xd5, 0x91, 0xc6, 0x69, 0x94, 0x5c, 0x35, 0x2c, 0x08, 0x2e, 0xa0, 0x97, 0x4c, 0x31,
+    0x2c, 0xe7, 0xba, 0x93, 0x41, 0x70, 0x24, 0x6d, 0xde, 0x55, 0xd9, 0xa3, 0xc9, 0x1c, 0x4d, 0x88,
+    0xdd, 0x8a, 0x7a, 0xfb, 0x38, 0xaf, 0x40, 0xab, 0x68, 0x30, 0xa6, 0x59, 0x85, 0x11, 0x5f, 0x04,
+    0xb7, 0x3b, 0xa0, 0xd5, 0x96, 0xb6, 0xc1, 0x1a, 0x7b, 0x56, 0x5a, 0x81, 0x08, 0x7a, 0xcb, 0xe3,
+    0x8b, 0x5b, 0x14, 0x46, 0x41, 0x65, 0xa7, 0x4f, 0x2c, 0xa6, 0xf0, 0xd4, 0x49, 0x35, 0x27, 0xc6,
+    0x58, 0xd9, 0x31, 0x8a, 0x57, 0xeb, 0xfc, 0x4b, 0x7e, 0xb3, 0xe2, 0x6e, 0xce, 0xaf, 0xf3, 0x0b,
+    0x6b, 0xbb, 0x3c, 0x5e, 0x2f, 0x3d, 0x9e, 0xee, 0xaa, 0x59, 0xb1, 0x2c, 0xbb, 0x02, 0x32, 0x94,
+    0x75, 0x19, 0x5f, 0x70, 0x3f, 0xbf, 0x05, 0xb9, 0xc4, 0x29, 0x4c, 0x9c, 0xa9, 0x82, 0xd1, 0xd0,
+    0x56, 0xd6, 0x0a, 0x65, 0xc3, 0xc1, 0x82, 0x1d, 0x0a, 0x66, 0xdf, 0x52, 0x29, 0xe2, 0x2e, 0x57,
+    0xbf, 0x0f, 0x00, 0xea, 0xea, 0xa8, 0x31, 0xe3, 0xfa, 0x34, 0x27, 0x61, 0xe2, 0xaf, 0xb3, 0x3a,
+    0xae, 0xa2, 0xec, 0x36, 0x59, 0xe7, 0xc8, 0xf1, 0x93, 0x38, 0x89, 0x4b, 0x16, 0x6b, 0xaa, 0x87,
+    0x7c, 0xce, 0x97, 0x3c, 0xbb, 0xdd, 0x92, 0xe6, 0xf1, 0x96, 0x30, 0x97, 0x8d, 0xb5, 0x76, 0x76,
+    0xc5, 0x72, 0x7f, 0x2e, 0xe5, 0xaf, 0x37, 0xac, 0x04, 0xb0, 0x37, 0xdc, 0x29, 0x81, 0xfe, 0x3a,
+    0xcd, 0x60, 0xd4, 0x55, 0x12, 0xd1, 0x3a, 0x4b, 0x5a, 0xf4, 0x4a, 0x5a, 0xe4, 0x29, 0xe8, 0xe7,
+    0x15, 0x4b, 0x81, 0x0d, 0x90, 0x1e, 0xf4, 0x0a, 0x76, 0x25, 0x89, 0x27, 0x2a, 0xd6, 0x9a, 0xdd,
+    0xee, 0x66, 0x5b, 0x58, 0xb4, 0x99, 0x9f, 0x47, 0x1b, 0x7e, 0x5b, 0x9f, 0x5f, 0x18, 0x86, 0x5b,
+    0x2d, 0x27, 0xf3, 0x04, 0x95, 0x60, 0x02, 0x0a, 0x38, 0xca, 0x6f, 0x50, 0x23, 0x41, 0x13, 0x2f,
+    0x8f, 0x6f, 0xb7, 0x74, 0x9b, 0x44, 0x50, 0xa5, 0x9b, 0xba, 0x38, 0xf5, 0xd9, 0x34, 0xf9, 0xb1,
+    0x31, 0x81, 0x92, 0x15, 0x0a, 0xf4, 0x61, 0xc4, 0xd6, 0x2a, 0x8d, 0x40, 0x5c, 0x6e, 0x76, 0x28,
+    0x98, 0x69, 0x6d, 0x02, 0x4a, 0x5b, 0x89, 0xbd, 0xda, 0xc3, 0x1f, 0xf5, 0x86, 0x83, 0xae, 0x6c,
+    0x96, 0x71, 0x50, 0x4c, 0x41, 0x13, 0xa8, 0x64, 0xb2, 0x1a, 0x3f, 0x35, 0x3b, 0xec, 0x80, 0x2c,
+    0xd4, 0x92, 0x6c, 0x98, 0x26, 0x57, 0xdb, 0xfc, 0xe1, 0x28, 0x2a, 0x29, 0x4f, 0x0a, 0xb9, 0xcd,
+    0x60, 0x35, 0x81, 0x58, 0xc8, 0x2e, 0xb7, 0x52, 0x58, 0x0e, 0x51, 0xef, 0x08, 0xac, 0xde, 0x5b,
+    0x15, 0x48, 0x20, 0xe6, 0x8c, 0x5f, 0x14, 0xf0, 0x98, 0x8f, 0x1d, 0xb7, 0xf8, 0x58, 0xed, 0xdb,
+    0xde, 0x30, 0x55, 0x6d, 0xf4, 0x10, 0x55, 0xd4, 0x03, 0x2d, 0x1a, 0x7e, 0x92, 0x22, 0xab, 0xee,
+    0x53, 0x23, 0xd2, 0x04, 0x00, 0xef, 0x24, 0xb3, 0xd9, 0x82, 0xdf, 0xae, 0x12, 0xb9, 0x90, 0x29,
+    0x5f, 0x30, 0x64, 0xb4, 0xa9, 0x00, 0xda, 0xef, 0x57, 0x5c, 0xdf, 0xed, 0x13, 0xfa, 0xa2, 0x87,
+    0xc0, 0xbc, 0xe2, 0x32, 0xd9, 0xde, 0x2e, 0x1a, 0xdb, 0x55, 0x4b, 0x89, 0x74, 0x35, 0x06, 0xf3,
+    0x40, 0x1e, 0xd6, 0x39, 0x9f, 0x46, 0x31, 0xf8, 0x65, 0xd0, 0x47, 0x5d, 0x93, 0x5e, 0xaf, 0xd7,
+    0x60, 0x46, 0xd2, 0xb1, 0x0d, 0x6e, 0x7c, 0x80, 0xfb, 0x7a, 0xd9, 0xd6, 0xd0, 0x93, 0x89, 0xc7,
+    0xc3, 0x24, 0xe5, 0xb7, 0x85, 0x77, 0xa2, 0xeb, 0xd3, 0x6d, 0x6c, 0xa4, 0xae, 0x53, 0x0c, 0x2d,
+    0x3d, 0x2f, 0x78, 0x98, 0xa3, 0x10, 0x4f, 0x71, 0xfd, 0xf1, 0xb7, 0xe1, 0x5a, 0x01, 0x0b, 0xef,
+    0xd0, 0x05, 0x0a, 0x76, 0xf4, 0x08, 0xc3, 0x2f, 0x1b, 0xc8, 0x09, 0xbd, 0xe6, 0xcf, 0xb9, 0x7f,
+    0xc9, 0x83, 0xe3, 0x82, 0x4a, 0x3b, 0x0c, 0xf5, 0xc3, 0x3d, 0xca, 0xc9, 0x95, 0xe3, 0x88, 0x11,
+    0x61, 0x1d, 0xf9, 0x7f, 0x1a, 0x28, 0xe8, 0x26, 0x40, 0x58, 0xaf, 0x16, 0x09, 0x0b, 0x5a, 0xff,
+    0x06, 0x59, 0x97, 0x3a, 0x64, 0x82, 0x8e, 0x5c, 0xc0, 0xb2, 0x39, 0xaf, 0xb4, 0xf4, 0x7e, 0x03,
+    0xdd, 0xe4, 0xae, 0xca, 0x8b, 0x6b, 0xac, 0xcc, 0x7e, 0xad, 0x46, 0x73, 0x57, 0xf0, 0x28, 0x04,
+    0x72, 0xb7, 0xc6, 0x56, 0x1a, 0xee, 0xd6, 0x7d, 0x25, 0x71, 0x56, 0x69, 0x32, 0x4b, 0x79, 0x96,
+    0x49, 0x45, 0x0d, 0xae, 0xec, 0x8f, 0xc5, 0x02, 0x0e, 0x1f, 0xb2, 0x52, 0xc5, 0x34, 0x7b, 0x75,
+    0x11, 0xaf, 0x99, 0x74, 0xd4, 0x8d, 0xca, 0x10, 0x5a, 0x1b, 0xfd, 0xc6, 0xca, 0x67, 0xfe, 0x71,
+    0xba, 0xbd, 0x5c, 0x3b, 0xa0, 0x4b, 0xd9, 0xa8, 0x71, 0x05, 0x95, 0x15, 0x54, 0x59, 0x66, 0xb3,
+    0x9a, 0x7a, 0x56, 0x9d, 0x14, 0x45, 0x25, 0xd7, 0x15, 0x51, 0x0d, 0xc9, 0x5d, 0x3e, 0x28, 0x40,
+    0x6d, 0x27, 0x97, 0xa5, 0x52, 0x23, 0x8f, 0xb0, 0x41, 0x8e, 0x1e, 0xeb, 0xb2, 0xba, 0x4e, 0xd8,
+    0x61, 0xc2, 0x4b, 0x4a, 0x23, 0x40, 0x9e, 0xa6, 0x0f, 0x40, 0xec, 0x31, 0x24, 0x71, 0xc3, 0x01,
+    0xdb, 0x86, 0x58, 0xae, 0x32, 0x71, 0xf4, 0x6e, 0xd5, 0x8b, 0x33, 0xdc, 0xa1, 0x48, 0xeb, 0xfe,
+    0x97, 0xf0, 0x37, 0x4b, 0x28, 0x52, 0x2b, 0xfd, 0xbf, 0xf7, 0x54, 0x1a, 0x18, 0x80, 0xf7, 0x1c,
+    0xf0, 0xc2, 0x71, 0x47, 0xad, 0xbf, 0xd5, 0x00, 0xa3, 0x4f, 0xa9, 0xeb, 0x6b, 0xdd, 0xdb, 0x01,
+    0xf8, 0x82, 0x0a, 0xba, 0x8a, 0x71, 0x16, 0xcf, 0x75, 0xd2, 0xee, 0x35, 0xd2, 0x22, 0x4a, 0x2a,
+    0x08, 0x01, 0x53, 0xd0, 0x84, 0xe9, 0x02, 0x12, 0xef, 0x26, 0x77, 0xff, 0x40, 0x72, 0x6f, 0xbb,
+    0x4b, 0x12, 0xa4, 0x74, 0xca, 0xac, 0xf2, 0xbd, 0xbe, 0x16, 0xc3, 0xbf, 0x77, 0x19, 0xc6, 0xb4,
+    0x0c, 0xf5, 0xa1, 0x05, 0xfd, 0x07, 0xb5, 0x89, 0xff, 0xdd, 0x04, 0xfe, 0x6f, 0x4b, 0x1e, 0x44,
+    0xcc, 0xa8, 0x62, 0xa6, 0x3e, 0xae, 0xbf, 0x79, 0x2b, 0xa3, 0x07, 0x22, 0x5e, 0x10, 0xa5, 0x40,
+    0x28, 0x54, 0x02, 0x30, 0xd6, 0x7a, 0x59, 0x0f, 0x8f, 0xa9, 0x05, 0x84, 0x80, 0x69, 0x7e, 0x0f,
+    0x24, 0xd8, 0x13, 0x22, 0x60, 0xd8, 0x75, 0x7f, 0xff, 0xe4, 0xb4, 0x23, 0x13, 0x0d, 0xa7, 0x1d,
+    0x99, 0xf0, 0xc0, 0x2c, 0x02, 0xfc, 0x04, 0xd1, 0x46, 0xf3, 0x17, 0xe0, 0xe1, 0xbb, 0x47, 0x22,
+    0x30, 0x3e, 0x3a, 0x03, 0x60, 0xa7, 0x73, 0xa7, 0x99, 0xb0, 0x80, 0x12, 0xac, 0x00, 0xaf, 0x34,
+    0x2e, 0x3a, 0x80, 0x4e, 0x3e, 0xd2, 0xa2, 0xc0, 0x3d, 0x0a, 0xaf, 0x8e, 0xce, 0x36, 0xad, 0x16,
+    0x0c, 0x02, 0xb5, 0x38, 0x06, 0x40, 0xad, 0xc3, 0xae, 0x22, 0x55, 0xd1, 0x43, 0xbc, 0xbf, 0x60,
+    0x72, 0x38, 0xa5, 0x25, 0xce, 0xed, 0xe8, 0xac, 0x36, 0x0e, 0x44, 0x9f, 0xa2, 0x17, 0x3c, 0xfc,
+    0x1e, 0x85, 0x11, 0x54, 0x8b, 0x91, 0x44, 0x2b, 0x01, 0x4f, 0x54, 0xfc, 0x1e, 0xbd, 0x89, 0x26,
+    0x5a, 0x89, 0x8a, 0xc4, 0xe4, 0xab, 0x46, 0x78, 0x9b, 0xaf, 0x76, 0x0e, 0x40, 0xe5, 0x44, 0x94,
+    0x83, 0x06, 0x90, 0xbd, 0x7e, 0x4b, 0x16, 0xbf, 0x03, 0xf3, 0x1f, 0x9d, 0xc1, 0xc3, 0x04, 0xc8,
+    0x97, 0xa7, 0x49, 0x3c, 0xab, 0xea, 0x8e, 0xce, 0x08, 0x14, 0x95, 0x3e, 0x84, 0xed, 0xcf, 0x64,
+    0xcf, 0x35, 0x15, 0x1f, 0x2a, 0x92, 0xfd, 0x1f, 0x99, 0xeb, 0x4b, 0xd0, 0x31, 0x7e, 0xbd, 0x37,
+    0x15, 0x6d, 0xf7, 0xde, 0xb1, 0x74, 0x65, 0x78, 0x0f, 0x4b, 0x85, 0xd0, 0x7f, 0x68, 0xb5, 0x34,
+    0x24, 0xb3, 0x76, 0xce, 0xf3, 0x1c, 0x38, 0x3a, 0x03, 0x6a, 0x34, 0x87, 0xc5, 0x60, 0x9b, 0x56,
+    0x16, 0x59, 0xa9, 0x4b, 0xab, 0x02, 0x1c, 0xd4, 0x95, 0x25, 0x4a, 0x43, 0x62, 0x5a, 0x20, 0x37,
+    0xb1, 0xed, 0xd9, 0xf9, 0xf9, 0xcf, 0xaf, 0x4e, 0x3b, 0xe2, 0xf9, 0x94, 0x24, 0x53, 0x23, 0x87,
+    0xf7, 0x08, 0xdd, 0x09, 0x49, 0xd1, 0x2c, 0x0a, 0x8e, 0x34, 0x10, 0x9a, 0x05, 0x8f, 0x67, 0xf9,
+    0xdc, 0x3d, 0x1a, 0xf6, 0x8e, 0xaa, 0xa9, 0x3f, 0x04, 0xfc, 0xa3, 0x0c, 0x63, 0x77, 0x0e, 0x50,
+    0xc4, 0xb8, 0x62, 0x90, 0x2b, 0xe0, 0x25, 0x2c, 0xd9, 0x3f, 0x90, 0x7c, 0x28, 0xe8, 0x21, 0x64,
+    0xe5, 0x65, 0x12, 0xc7, 0x42, 0x5c, 0x1f, 0x27, 0x49, 0xb3, 0xc7, 0x21, 0xe4, 0x79, 0x1e, 0x04,
+    0xe8, 0x5a, 0x3c, 0x42, 0xa1, 0x79, 0xbe, 0x72, 0xa2, 0xd5, 0x91, 0x06, 0x62, 0xeb, 0xf3, 0x79,
+    0xb2, 0x00, 0x99, 0x76, 0x8f, 0x9c, 0x93, 0x6e, 0xdb, 0x19, 0x8e, 0xdb, 0x4e, 0xfb, 0x5a, 0x03,
+    0x17, 0x0b, 0xda, 0xb4, 0x9c, 0x36, 0xd8, 0x64, 0xb6, 0xd8, 0x4b, 0x3d, 0x19, 0xe9, 0x48, 0x9c,
+    0xa1, 0xce, 0x5b, 0x83, 0x66, 0x8f, 0x95, 0x6a, 0xad, 0x16, 0x35, 0x49, 0x55, 0x10, 0xc5, 0xc1,
+    0x8b, 0x3c, 0x3e, 0xd2, 0x92, 0xd8, 0x5f, 0x44, 0xfe, 0xa5, 0x28, 0x01, 0xd9, 0x71, 0x0c, 0xf3,
+    0xe8, 0xec, 0x0d, 0x3c, 0x9f, 0x76, 0x04, 0x20, 0x39, 0x62, 0x63, 0x70, 0x82, 0x81, 0xea, 0xf6,
+    0xd0, 0x55, 0x4d, 0xd2, 0x7c, 0x27, 0x41, 0x44, 0x3e, 0xa3, 0x22, 0x89, 0x48, 0xdd, 0x82, 0x62,
+    0x04, 0x62, 0xd0, 0xba, 0xc2, 0x8a, 0x0e, 0x06, 0xbd, 0xc1, 0x81, 0xe3, 0xfc, 0x86, 0xfa, 0x97,
+    0x6b, 0x1f, 0xc2, 0x10, 0x02, 0x91, 0x47, 0x07, 0xdc, 0x80, 0x65, 0x08, 0x43, 0x39, 0x5c, 0xab,
+    0x6b, 0xcb, 0x01, 0xe1, 0xe1, 0xc0, 0x59, 0xa5, 0xc9, 0xf5, 0x8d, 0xf6, 0x1e, 0x64, 0xb4, 0x18,
+    0xaa, 0x58, 0x04, 0x7a, 0x2b, 0x3a, 0x09, 0x67, 0xff, 0xa8, 0x8e, 0x07, 0x39, 0xfd, 0x5e, 0x72,
+    0x2d, 0x30, 0x59, 0x21, 0xa4, 0x86, 0xb6, 0x13, 0xd1, 0x40, 0xa5, 0xe4, 0xd4, 0x21, 0x54, 0xf4,
+    0x56, 0x1a, 0x19, 0x0d, 0x5c, 0x90, 0x7d, 0x69, 0xd2, 0xa3, 0xb3, 0x0f, 0xf9, 0x9c, 0xa7, 0x9a,
+    0x74, 0x12, 0x32, 0x8d, 0x41, 0x64, 0xc5, 0x56, 0xab, 0x0c, 0x93, 0xe4, 0xc8, 0xda, 0x5a, 0x9e,
+    0x68, 0xf9, 0x3c, 0xca, 0x8a, 0x16, 0x60, 0x70, 0xb3, 0x1c, 0x0c, 0x8d, 0x96, 0x84, 0x50, 0xce,
+    0x85, 0xe4, 0xc8, 0xc9, 0x19, 0x19, 0xb8, 0x3a, 0x1a, 0x2e, 0x94, 0x36, 0xb6, 0x09, 0x52, 0xe7,
+    0x2a, 0xeb, 0xa0, 0xfe, 0x49, 0x93, 0xc5, 0x02, 0x46, 0x59, 0xb1, 0x7c, 0x6e, 0x5a, 0x60, 0xfe,
+    0xa9, 0x2b, 0x4c, 0xcd, 0x07, 0x71, 0x00, 0x76, 0x4e, 0xe2, 0xc5, 0x0d, 0x38, 0x15, 0xe9, 0x86,
+    0x67, 0xf0, 0xcc, 0x61, 0x9e, 0x11, 0xf8, 0x24, 0xed, 0xd3, 0xce, 0x6a, 0x87, 0xac, 0xbe, 0x87,
+    0x08, 0x48, 0xfb, 0x58, 0xf4, 0x3d, 0x40, 0x7b, 0x35, 0x3a, 0x28, 0x92, 0x7a, 0x00, 0x81, 0x9a,
+    0x39, 0x45, 0x30, 0xf1, 0x20, 0x06, 0x30, 0x1d, 0x70, 0x30, 0x98, 0x26, 0x84, 0x47, 0xaa, 0x0f,
+    0x83, 0xb7, 0x67, 0x6d, 0x98, 0x76, 0x42, 0x14, 0xc5, 0x70, 0xc6, 0xd4, 0x58, 0x4e, 0x53, 0x25,
+    0xc2, 0xe4, 0xd1, 0x92, 0xb7, 0x25, 0xa9, 0xde, 0x71, 0xb6, 0xe1, 0x54, 0xc5, 0x84, 0x52, 0xd0,
+    0xf8, 0x72, 0x95, 0xdf, 0x20, 0xb5, 0x81, 0xd0, 0xcc, 0x5b, 0xf0, 0xb6, 0x26, 0x98, 0x68, 0x09,
+    0x4c, 0x44, 0xb4, 0xc4, 0xc6, 0xe0, 0x4d, 0x90, 0xff, 0x02, 0x78, 0xc3, 0x52, 0x80, 0x30, 0x63,
+    0x61, 0x18, 0xa5, 0x59, 0x8e, 0x74, 0x2b, 0x08, 0xa6, 0x88, 0xe2, 0x3a, 0x8e, 0xf2, 0x4f, 0xc9,
+    0x55, 0x76, 0x20, 0xdf, 0x9e, 0xcf, 0x93, 0xab, 0x52, 0x38, 0x84, 0x97, 0x57, 0x82, 0xf9, 0x2d,
+    0xe2, 0x57, 0xc4, 0x73, 0x54, 0xbc, 0x57, 0x95, 0x92, 0x59, 0xd3, 0x7e, 0x61, 0x98, 0xa7, 0x7a,
+    0x74, 0x69, 0x94, 0xc6, 0xdf, 0x61, 0x59, 0xde, 0xb3, 0x95, 0x5c, 0x0a, 0x21, 0x4f, 0xe8, 0x9a,
+    0x67, 0x72, 0x59, 0xe6, 0x8e, 0xa5, 0xcd, 0xbb, 0x96, 0xb6, 0xce, 0x3c, 0x13, 0xa9, 0x1c, 0xa6,
+    0xc0, 0x62, 0x01, 0xb0, 0x5d, 0x2c, 0x06, 0x6f, 0x12, 0x8e, 0x20, 0x6c, 0x53, 0xee, 0x51, 0x1d,
+    0x2a, 0x31, 0xaf, 0xc7, 0x6f, 0x8a, 0x36, 0x85, 0xe5, 0xfe, 0x59, 0x82, 0x36, 0x74, 0xdd, 0xd2,
+    0x75, 0xd0, 0xaa, 0xc7, 0x1a, 0x58, 0x06, 0x41, 0x38, 0x55, 0xb9, 0x36, 0x08, 0x2b, 0x3d, 0xb9,
+    0xaf, 0x30, 0xdb, 0x95, 0xef, 0xf7, 0xa8, 0x69, 0x7a, 0x41, 0x39, 0xa4, 0x58, 0xb1, 0x4e, 0x85,
+    0xc2, 0x52, 0x9d, 0xc0, 0x2a, 0x25, 0x55, 0x5a, 0x15, 0x68, 0xa1, 0x2a, 0x2f, 0x4a, 0x6d, 0x09,
+    0xcd, 0xe5, 0x11, 0x48, 0xa9, 0x43, 0x0b, 0x0d, 0x3a, 0x44, 0x0a, 0xf1, 0x15, 0xea, 0x70, 0x05,
+    0x42, 0xcd, 0x29, 0x05, 0x93, 0xa6, 0xf4, 0xff, 0x0d, 0x2d, 0x5c, 0xaf, 0xf0, 0x4c, 0x65, 0x7b,
+    0x65, 0x41, 0x0e, 0xe1, 0xea, 0xe7, 0xe0, 0x43, 0x83, 0x2b, 0xbe, 0x04, 0x05, 0xc5, 0x7d, 0xb3,
+    0x39, 0xc1, 0x7d, 0x36, 0x00, 0x3a, 0xa0, 0xc4, 0x36, 0x6c, 0x4e, 0xcf, 0x3e, 0xd4, 0x06, 0xbc,
+    0x82, 0x01, 0xff, 0x06, 0xb2, 0x02, 0x5a, 0xde, 0xb6, 0x25, 0xb4, 0x0f, 0xa7, 0xab, 0x00, 0x40,
+    0x74, 0x1d, 0x7d, 0x1b, 0x5d, 0x0b, 0x8e, 0xdc, 0x65, 0xe7, 0x14, 0xe5, 0x11, 0xa0, 0x0a, 0x53,
+    0xd1, 0x4a, 0x56, 0xe4, 0x63, 0x01, 0x46, 0x6b, 0x8e, 0xac, 0x51, 0x1a, 0x67, 0x30, 0x03, 0xa7,
+    0x1d, 0x51, 0xbb, 0xb7, 0xb9, 0x53, 0x36, 0x3f, 0xd6, 0xce, 0x93, 0x75, 0xea, 0xf3, 0x47, 0xbb,
+    0x74, 0x95, 0x2e, 0xe4, 0x37, 0x3f, 0xda, 0x03, 0x5c, 0xc5, 0x37, 0xeb, 0xc5, 0x42, 0x3b, 0xa7,
+    0x30, 0xe7, 0xd1, 0xe6, 0x7d, 0x70, 0xd1, 0xd7, 0x19, 0x28, 0xa2, 0x66, 0xcb, 0x52, 0x5b, 0x1e,
+    0x4e, 0x54, 0x89, 0xe9, 0x39, 0x68, 0xbd, 0xef, 0xc6, 0x33, 0xe0, 0xce, 0xa0, 0x16, 0x6d, 0x30,
+    0xcd, 0xe0, 0x70, 0x9e, 0x91, 0x00, 0x84, 0x30, 0x6a, 0x86, 0x83, 0xc9, 0x62, 0xf3, 0xdb, 0x98,
+    0xe7, 0x1d, 0x39, 0x42, 0xdf, 0x75, 0x9a, 0x04, 0x66, 0xc7, 0x44, 0x7b, 0x87, 0x4f, 0xb4, 0x04,
+    0x41, 0x53, 0x05, 0x9b, 0xde, 0x1d, 0x7e, 0xf3, 0x4c, 0x5f, 0x52, 0x56, 0xf4, 0x33, 0x6e, 0xdd,
+    0x3c, 0x30, 0x55, 0xb1, 0xb5, 0x23, 0xb0, 0xa0, 0xe7, 0x4f, 0x8a, 0xef, 0xde, 0xa0, 0x0a, 0xed,
+    0xfe, 0x1c, 0x69, 0x01, 0xcb, 0x59, 0x2b, 0x27, 0xe5, 0x2a, 0xcd, 0x4e, 0x23, 0x5b, 0x7d, 0xa4,
+    0xd1, 0x31, 0x05, 0xf7, 0xe8, 0xf7, 0x39, 0x04, 0x92, 0x35, 0xbd, 0xf5, 0x18, 0x4c, 0x67, 0x27,
+    0x4c, 0x3b, 0xb4, 0x4b, 0x98, 0xff, 0x3d, 0xe5, 0x78, 0x02, 0xe3, 0x2b, 0x60, 0x76, 0xf7, 0xe0,
+    0xe9, 0x71, 0xbb, 0x02, 0xfb, 0x9c, 0x34, 0xf0, 0xd7, 0x80, 0xed, 0xed, 0x46, 0xd5, 0xae, 0xa6,
+    0xff, 0x02, 0xa4, 0xf4, 0xab, 0x40, 0xf6, 0x77, 0x63, 0xaa, 0xa0, 0xf9, 0x89, 0x07, 0x5f, 0x05,
+    0x71, 0xb0, 0x87, 0x9e, 0x15, 0x92, 0x2f, 0x6f, 0x58, 0x93, 0x9c, 0x5f, 0xcb, 0x69, 0x2f, 0xd6,
+    0x69, 0xdc, 0x8a, 0x62, 0xf4, 0x1c, 0xf3, 0x22, 0x2c, 0xfd, 0xb6, 0xf0, 0xc3, 0x03, 0x88, 0x51,
+    0xfc, 0x77, 0xc6, 0x1f, 0xef, 0x13, 0xf4, 0xfa, 0xd1, 0x8f, 0x05, 0x53, 0x92, 0x00, 0x1a, 0x4c,
+    0x5b, 0x45, 0xd7, 0x80, 0x24, 0xdf, 0xf0, 0xf4, 0x06, 0x05, 0x79, 0x9d, 0x73, 0x8b, 0x3c, 0xe0,
+    0x70, 0x9d, 0x92, 0x6b, 0x7d, 0x35, 0x8f, 0x16, 0x5c, 0xce, 0x08, 0xbd, 0x6d, 0xf0, 0x86, 0xf0,
+    0xe8, 0x0f, 0xe8, 0x81, 0x4c, 0x0b, 0x41, 0xd4, 0x1c, 0x5b, 0x76, 0xcb, 0xf6, 0x84, 0x10, 0x42,
+    0x59, 0x6b, 0xef, 0xc4, 0x80, 0x8f, 0xfa, 0x51, 0xb5, 0xe6, 0xdf, 0xc1, 0x4f, 0xfd, 0x35, 0xe3,
+    0x81, 0xe6, 0xdd, 0xd0, 0xa4, 0x25, 0xec, 0x22, 0xba, 0x42, 0x53, 0x09, 0x9e, 0x3f, 0x4c, 0x92,
+    0x56, 0x76, 0x22, 0x67, 0x29, 0x77, 0xb3, 0x2c, 0x0d, 0x47, 0x82, 0x00, 0x0a, 0x86, 0xd2, 0x0c,
+    0x50, 0xca, 0x82, 0xf2, 0x9a, 0x58, 0x10, 0x4c, 0x0c, 0x84, 0x40, 0xba, 0x40, 0x73, 0x5a, 0x23,
+    0x08, 0xb3, 0xe6, 0x49, 0x1a, 0xfd, 0x1b, 0x93, 0x3f, 0x0b, 0xa0, 0x9e, 0x0f, 0x6f, 0x60, 0xfe,
+    0xae, 0x21, 0x6e, 0xc3, 0x08, 0xd8, 0x92, 0x80, 0x81, 0xc6, 0x79, 0xe4, 0xab, 0x2d, 0x6e, 0x8a,
+    0x16, 0x1a, 0xce, 0x62, 0x9d, 0xc2, 0x68, 0xf3, 0x34, 0x8a, 0x2f, 0x35, 0xb1, 0x8d, 0x61, 0xd8,
+    0x9a, 0xab, 0xc5, 0xb8, 0x36, 0xe6, 0xb6, 0xd3, 0x0c, 0x33, 0x78, 0x30, 0xd8, 0xf8, 0xfa, 0x94,
+    0x84, 0xea, 0x37, 0xbf, 0x23, 0xe8, 0xc6, 0xed, 0x7d, 0xe9, 0x32, 0xbf, 0x41, 0x1a, 0xd5, 0xf3,
+    0x11, 0x7b, 0x81, 0xca, 0x5d, 0x67, 0x05, 0x64, 0x06, 0x21, 0x98, 0x58, 0x53, 0x4c, 0x6d, 0x9c,
+    0x63, 0x40, 0x56, 0x2c, 0xf1, 0x43, 0x19, 0x0e, 0x09, 0x77, 0x99, 0xcd, 0x0a, 0x93, 0x71, 0xf3,
+    0x1e, 0x9e, 0xf7, 0x06, 0x44, 0x2f, 0x08, 0xd6, 0x01, 0xee, 0xba, 0x6c, 0x78, 0x88, 0xbb, 0xfe,
+    0x52, 0xc4, 0xd4, 0x32, 0xda, 0x11, 0x2e, 0xc3, 0x37, 0x8b, 0x7a, 0x1e, 0xa7, 0x5b, 0x89, 0xd5,
+    0xef, 0x2a, 0xea, 0x62, 0x82, 0x9a, 0x03, 0x1c, 0xb4, 0x11, 0x5e, 0xce, 0x7a, 0x65, 0x49, 0xfa,
+    0x68, 0xdd, 0xaa, 0x34, 0x48, 0xae, 0x62, 0xcd, 0xc0, 0xd4, 0x17, 0x46, 0x6a, 0x29, 0x5f, 0x71,
+    0x56, 0x32, 0x6c, 0xb6, 0xe2, 0x3c, 0xc8, 0xa0, 0xa3, 0x50, 0x19, 0x09, 0x08, 0x7d, 0xaa, 0xc1,
+    0xa2, 0x69, 0xd8, 0x1c, 0x98, 0x3e, 0x48, 0xd6, 0x10, 0x3c, 0xc3, 0x6a, 0x63, 0x4c, 0xad, 0x80,
+    0x5e, 0x82, 0x3a, 0x68, 0x97, 0x31, 0x54, 0x19, 0x54, 0x67, 0x0b, 0xce, 0x57, 0x1a, 0x4b, 0x29,
+    0x16, 0x8f, 0x21, 0x9e, 0xcf, 0x21, 0x32, 0x04, 0x79, 0xa4, 0x94, 0xc7, 0x8a, 0xcd, 0xf8, 0x1e,
+    0x0d, 0xf2, 0x31, 0xb9, 0x82, 0x71, 0xdf, 0xb3, 0x18, 0x9a, 0x2c, 0x41, 0x32, 0x1f, 0x5f, 0xdd,
+    0x66, 0x8f, 0x83, 0xf2, 0xa9, 0x84, 0xdd, 0xeb, 0x18, 0xf3, 0x01, 0xc1, 0xb7, 0xae, 0x2f, 0x4d,
+    0x95, 0xff, 0x55, 0x5d, 0xfe, 0x08, 0x8e, 0x9f, 0x21, 0x52, 0x42, 0x5d, 0xfa, 0x55, 0x11, 0x16,
+    0x61, 0x94, 0x2f, 0x0b, 0x6f, 0xad, 0x88, 0x11, 0x7b, 0xc3, 0x83, 0x63, 0xac, 0x77, 0xc9, 0x55,
+    0x4b, 0x10, 0x96, 0xd0, 0xf8, 0x56, 0x12, 0x2d, 0x92, 0xab, 0xd5, 0x55, 0xfa, 0x37, 0x8a, 0x80,
+    0x48, 0xe9, 0x5d, 0xa5, 0x3f, 0xc7, 0x61, 0x82, 0x10, 0x9b, 0xac, 0xb5, 0x57, 0x57, 0x7e, 0x95,
+    0x52, 0x2b, 0x32, 0x04, 0xa5, 0x5a, 0x2b, 0x0a, 0x1a, 0x8a, 0xed, 0x70, 0xed, 0x0b, 0xd2, 0xc4,
+    0x73, 0x15, 0xec, 0x27, 0x2c, 0x40, 0xe9, 0x7c, 0xc5, 0x43, 0xb6, 0x5e, 0xe4, 0xd9, 0x8e, 0xc4,
+    0xc5, 0x1e, 0x7d, 0x99, 0x49, 0x30, 0xaa, 0xd2, 0x2c, 0xc4, 0xea, 0x73, 0xca, 0xc2, 0x30, 0xf2,
+    0xb5, 0x4f, 0x45, 0x9e, 0x6b, 0x8f, 0x58, 0xed, 0x48, 0xb3, 0xe0, 0xf9, 0x41, 0x45, 0xdc, 0x9a,
+    0x90, 0xbe, 0xce, 0x6c, 0xe3, 0x04, 0xb1, 0x5f, 0xa6, 0xa5, 0xec, 0x4a, 0x6a, 0xd9, 0xdf, 0xb9,
+    0x77, 0x9e, 0xf8, 0x97, 0xa4, 0x21, 0x28, 0xbb, 0x45, 0x09, 0xce, 0x28, 0xf5, 0x97, 0x01, 0xe8,
+    0xa8, 0x6c, 0x05, 0xaa, 0x1b, 0x1d, 0x99, 0x44, 0x0b, 0x01, 0xd1, 0xb9, 0x64, 0x41, 0x74, 0x47,
+    0x40, 0x81, 0xa1, 0xce, 0xb9, 0x8a, 0xc0, 0x7c, 0xe6, 0x09, 0x44, 0x52, 0x1d, 0x51, 0xf2, 0x07,
+    0xa6, 0xb5, 0xdb, 0xab, 0x9b, 0x36, 0xc6, 0x06, 0x1a, 0x26, 0xfa, 0xb3, 0x9c, 0xfc, 0x45, 0x0d,
+    0x74, 0x0f, 0x1e, 0x98, 0xb8, 0x4a, 0xa3, 0x1c, 0xcc, 0x3e, 0xf8, 0x3b, 0x5c, 0x64, 0xfa, 0x52,
+    0xf4, 0x74, 0xa0, 0x32, 0x84, 0xd8, 0xb4, 0x91, 0xec, 0xfb, 0x3a, 0x0b, 0x5b, 0xf2, 0x0d, 0x2e,
+    0x48, 0xca, 0xfd, 0x7a, 0xc6, 0x1f, 0x0a, 0x3e, 0x93, 0xb0, 0x10, 0x03, 0xe1, 0x06, 0xe5, 0x96,
+    0x8d, 0x65, 0x0f, 0x70, 0xcd, 0x3c, 0xe5, 0xa1, 0x7b, 0xd4, 0x29, 0x72, 0x95, 0x1d, 0x54, 0xe7,
+    0x78, 0xc2, 0xa3, 0x5c, 0x35, 0x3a, 0x5c, 0x12, 0x60, 0x35, 0xa3, 0xbd, 0x51, 0xdc, 0x8c, 0x3d,
+    0x3a, 0x7b, 0x25, 0x9b, 0x9d, 0x76, 0xd8, 0x5f, 0xf0, 0x0f, 0x60, 0xb4, 0x97, 0xcb, 0xc0, 0xd0,
+    0xfd, 0x05, 0x67, 0x29, 0x26, 0xd5, 0x5e, 0xe2, 0xc3, 0x7e, 0x4b, 0x7e, 0xb0, 0xb4, 0x02, 0xe0,
+    0x7d, 0xd2, 0x4a, 0x86, 0x80, 0xc5, 0xa0, 0x62, 0xae, 0x60, 0x2c, 0xcd, 0xf0, 0xa4, 0xfb, 0xbd,
+    0x64, 0x2b, 0xf3, 0xaf, 0x73, 0xae, 0x80, 0xf8, 0x3b, 0x61, 0x5f, 0xf2, 0xac, 0xcf, 0xe2, 0x0d,
+    0xcb, 0xc4, 0xe6, 0x16, 0xd4, 0xbc, 0x87, 0x78, 0x58, 0x38, 0x64, 0x10, 0x59, 0xf4, 0x86, 0x40,
+    0x73, 0x3a, 0xa8, 0x02, 0x21, 0x56, 0xbf, 0x0a, 0x06, 0x95, 0x43, 0x32, 0xf5, 0xc0, 0xa8, 0x79,
+    0xfa, 0x87, 0xc6, 0x3f, 0xed, 0x88, 0x31, 0xbe, 0x96, 0x3e, 0x88, 0x4e, 0x8d, 0x40, 0xdf, 0xcd,
+    0xe5, 0x43, 0x66, 0x40, 0x32, 0x08, 0x7d, 0x13, 0x82, 0x8c, 0xcd, 0x0f, 0xf4, 0xf5, 0xf6, 0xaa,
+    0xb0, 0x0a, 0x1c, 0xaa, 0x2f, 0xa0, 0xe2, 0x1e, 0x06, 0x69, 0x2c, 0xf2, 0x87, 0xcf, 0xcf, 0xc1,
+    0xd7, 0x4c, 0x97, 0x57, 0xe8, 0x28, 0xfc, 0xba, 0x02, 0x19, 0xe5, 0x7f, 0x7d, 0x7d, 0x1b, 0x80,
+    0x76, 0xfb, 0x01, 0xca, 0x99, 0x28, 0x41, 0x66, 0x51, 0xf0, 0x3f, 0xe9, 0xbd, 0x9c, 0x53, 0x90,
+    0xf8, 0x6b, 0xf4, 0x25, 0xda, 0x33, 0x9e, 0xbf, 0x5e, 0x90, 0x5b, 0xf1, 0xe2, 0xe6, 0x67, 0x90,
+    0x82, 0xf0, 0xea, 0x0d, 0x84, 0x48, 0xba, 0xd9, 0xa6, 0x86, 0x38, 0xe3, 0x82, 0x60, 0x2b, 0x10,
+    0x0c, 0x28, 0xc2, 0x58, 0x21, 0x48, 0xd9, 0x4c, 0x6b, 0x7b, 0xc0, 0xb0, 0x21, 0x34, 0x06, 0x16,
+    0x4a, 0x79, 0xb9, 0x84, 0x0d, 0xab, 0x8d, 0x0d, 0x8a, 0xa3, 0x02, 0x6f, 0xe8, 0x19, 0x4f, 0x2d,
+    0xae, 0x80, 0xe1, 0xb0, 0x7f, 0x39, 0x69, 0xf5, 0x98, 0xd2, 0xd1, 0x83, 0x3e, 0x44, 0x71, 0xcc,
+    0xaa, 0xdc, 0xe4, 0x9a, 0x89, 0x5d, 0xf6, 0x1a, 0xeb, 0x14, 0x87, 0x0d, 0xb0, 0x9a, 0x8e, 0x1a,
+    0x08, 0x60, 0x8f, 0x39, 0xe4, 0x49, 0xce, 0xea, 0x0e, 0xf9, 0x2e, 0x0f, 0x62, 0xef, 0x3a, 0x49,
+    0xcf, 0x42, 0xae, 0xf2, 0x39, 0x6e, 0x4a, 0xa5, 0x0f, 0x39, 0x34, 0xd5, 0xc6, 0xed, 0x7a, 0x15,
+    0xac, 0xd3, 0x45, 0x6d, 0xcf, 0xf9, 0x64, 0xd0, 0xd8, 0xc7, 0x9d, 0xe7, 0xf9, 0x6a, 0xd2, 0xe9,
+    0x54, 0xdb, 0xb9, 0x8e, 0x3d, 0x19, 0xdb, 0x63, 0xbb, 0x73, 0xa0, 0xc3, 0xf3, 0x12, 0xfd, 0x15,
+    0x0d, 0x13, 0xda, 0x4b, 0x46, 0x81, 0x1b, 0x66, 0x4c, 0xbf, 0xcd, 0xe9, 0x01, 0xb4, 0xf1, 0x90,
+    0xc9, 0x57, 0x78, 0x3d, 0x5f, 0x25, 0x77, 0x34, 0x98, 0xa0, 0x26, 0xf2, 0xa1, 0x98, 0xc0, 0x2f,
+    0xb8, 0xcd, 0xf4, 0xcd, 0xaa, 0x79, 0x05, 0x66, 0x70, 0xa7, 0x6e, 0x2e, 0x7f, 0x33, 0x3f, 0x8d,
+    0x56, 0xf9, 0xd9, 0x93, 0x05, 0x48, 0xbb, 0xbf, 0x4e, 0xf1, 0x3c, 0x36, 0xe5, 0xe1, 0x5c, 0x7b,
+    0x4a, 0x65, 0x10, 0x70, 0x60, 0x06, 0x32, 0x73, 0xbf, 0x0c, 0xac, 0xbe, 0xf8, 0xff, 0x42, 0xd4,
+    0xd0, 0x74, 0x65, 0x9d, 0x63, 0x75, 0xe1, 0x7f, 0xc7, 0x72, 0xca, 0xba, 0x9b, 0xf7, 0xe0, 0xa8,
+    0x8e, 0xa7, 0x4f, 0x60, 0xba, 0x60, 0xb3, 0xff, 0xc3, 0x05, 0x6c, 0xce, 0xf6, 0x09, 0x63, 0x14,
+    0x98, 0xd3, 0x27, 0x4f, 0xc2, 0x75, 0x2c, 0x4e, 0x16, 0x80, 0xe2, 0x21, 0x14, 0x8c, 0xdc, 0xbc,
+    0x15, 0x67, 0x2a, 0x2b, 0xac, 0xe8, 0xb0, 0x78, 0x09, 0xe7, 0x5f, 0x6b, 0x9e, 0xde, 0x9c, 0x53,
+    0xfe, 0x38, 0x49, 0x9f, 0x2f, 0x16, 0x86, 0x2e, 0xcf, 0x7d, 0x83, 0x5c, 0x83, 0x5f, 0xf1, 0x9a,
+    0xf9, 0x73, 0x23, 0x73, 0xcf, 0x6e, 0x89, 0x6a, 0x59, 0x9b, 0xd6, 0xe2, 0x5d, 0x94, 0xe5, 0xf2,
+    0x0c, 0xa9, 0xa1, 0x8b, 0xc3, 0x94, 0xba, 0xb5, 0xc2, 0x5b, 0x51, 0x3f, 0xc7, 0xb9, 0x91, 0xb5,
+    0xd1, 0xbd, 0x00, 0x0c, 0xda, 0xb9, 0xe9, 0xba, 0x6e, 0x6e, 0xe2, 0x78, 0xf7, 0xf0, 0xf7, 0xfd,
+    0x93, 0xbf, 0x32, 0x6a, 0xd6, 0x86, 0xa8, 0xfc, 0xf5, 0x06, 0x7a, 0xe1, 0xb0, 0x3c, 0xe6, 0x29,
+    0xda, 0x5f, 0x58, 0x75, 0xdd, 0x32, 0x4c, 0xf7, 0xac, 0x9c, 0xe9, 0xce, 0xf1, 0x4d, 0x1c, 0x16,
+    0x29, 0xf3, 0x1f, 0x86, 0x2e, 0xb6, 0x7a, 0x60, 0x80, 0x24, 0x26, 0x3e, 0x75, 0x0b, 0x6a, 0x19,
+    0xe6, 0x6d, 0x59, 0xfd, 0x1b, 0x5b, 0x40, 0x0b, 0x14, 0xb7, 0x97, 0xf2, 0xfe, 0x16, 0x06, 0x69,
+    0x6d, 0x4a, 0xc1, 0xdf, 0x4f, 0x11, 0x8c, 0xd8, 0xd9, 0xd8, 0x0b, 0xa6, 0xdc, 0xf8, 0x78, 0x08,
+    0x4c, 0xb5, 0x50, 0x92, 0x37, 0x28, 0x4f, 0x6d, 0x6c, 0xcc, 0xdb, 0x94, 0xe7, 0x60, 0xdf, 0xb5,
+    0xcd, 0xb1, 0xae, 0x19, 0xfa, 0xf1, 0xe6, 0xa7, 0xfe, 0xf8, 0x58, 0x5f, 0x5d, 0x9b, 0xfa, 0x7d,
+    0xd5, 0xa5, 0x64, 0x9a, 0xbd, 0x9d, 0xba, 0xc3, 0xad, 0x4e, 0x6b, 0x92, 0x0d, 0xec, 0x75, 0x4e,
+    0x32, 0x07, 0xfe, 0x35, 0x12, 0x77, 0x03, 0x1e, 0xc5, 0xd2, 0x2d, 0x49, 0x87, 0xf8, 0x63, 0xd4,
+    0x0a, 0xb8, 0x13, 0xaa, 0xb4, 0x74, 0x50, 0x28, 0x33, 0xf3, 0x45, 0xb1, 0x5b, 0x70, 0xf4, 0x97,
+    0xe5, 0x45, 0xbd, 0xc5, 0xf6, 0xbc, 0xeb, 0x13, 0xac, 0xfa, 0x15, 0xa0, 0xcb, 0x5c, 0x78, 0x09,
+    0xbc, 0x12, 0x8a, 0x0a, 0xbc, 0x9a, 0x31, 0x6f, 0x0c, 0xd0, 0x20, 0x47, 0xad, 0x37, 0x31, 0x5d,
+    0x0d, 0xff, 0x1d, 0x8b, 0x76, 0x00, 0x19, 0xac, 0x4d, 0x55, 0x59, 0x2d, 0x24, 0x4d, 0x41, 0x99,
+    0x92, 0xbb, 0x99, 0x1e, 0x4e, 0x09, 0x44, 0x8d, 0xf8, 0x49, 0x25, 0xc0, 0x77, 0xc7, 0xae, 0x46,
+    0x0d, 0x81, 0xdf, 0xe1, 0xa4, 0xac, 0x70, 0x2c, 0xc6, 0xdb, 0x21, 0x89, 0x94, 0x11, 0xd5, 0xad,
+    0x2d, 0xfe, 0xaa, 0xa9, 0x23, 0x75, 0x3f, 0x1a, 0xf7, 0xcb, 0x2d, 0xdc, 0x0f, 0x17, 0x9a, 0x89,
+    0x74, 0x1b, 0xf8, 0x6e, 0x6e, 0xa9, 0x1b, 0xfc, 0x94, 0x03, 0x28, 0xa9, 0xdc, 0x50, 0xa0, 0x36,
+    0xba, 0x39, 0x85, 0x16, 0x42, 0xf7, 0xe0, 0x36, 0xbe, 0xab, 0x97, 0x07, 0x5c, 0x75, 0x9c, 0x25,
+    0x56, 0x46, 0x31, 0xe0, 0xf3, 0xf6, 0xf3, 0xfb, 0x77, 0xae, 0x2e, 0xcd, 0x50, 0x79, 0x32, 0x2d,
+    0x00, 0x4f, 0x42, 0x35, 0xa3, 0x8a, 0xe9, 0x1c, 0x35, 0x2d, 0xa7, 0x73, 0x54, 0x6c, 0xb7, 0xe9,
+    0xc7, 0x4f, 0x44, 0x52, 0x34, 0xe0, 0x6d, 0x0a, 0xa5, 0x7c, 0x6e, 0x74, 0x8e, 0x3a, 0x33, 0x4b,
+    0x7f, 0xfa, 0xaf, 0x75, 0x92, 0x4f, 0x75, 0xf3, 0x58, 0x2f, 0x4d, 0x9e, 0x1c, 0x0b, 0xa7, 0xb5,
+    0x77, 0xac, 0x9e, 0xd3, 0x18, 0xec, 0x39, 0x5e, 0xc8, 0xd4, 0x3e, 0xff, 0xd6, 0x1c, 0x12, 0xa1,
+    0x3c, 0x34, 0x64, 0xdd, 0x2c, 0x06, 0x7c, 0xa1, 0xec, 0x17, 0x2c, 0x21, 0xa4, 0x3b, 0x3a, 0x7b,
+    0x8a, 0x7b, 0xca, 0xd9, 0xb4, 0xb4, 0x7e, 0x25, 0x95, 0x6a, 0x7a, 0x17, 0x94, 0x2e, 0x74, 0x26,
+    0xb6, 0x13, 0x66, 0x54, 0x61, 0x3b, 0x6c, 0x9c, 0x12, 0x34, 0xc3, 0xbc, 0x97, 0x42, 0x58, 0x9e,
+    0x56, 0x40, 0x4e, 0x58, 0xad, 0x78, 0x1c, 0xbc, 0x9c, 0x47, 0x8b, 0xc0, 0x80, 0xb6, 0x24, 0x68,
+    0xd5, 0x7a, 0x83, 0x71, 0xa2, 0xf5, 0xa6, 0x33, 0x17, 0x46, 0x7d, 0xa1, 0x33, 0xf7, 0x01, 0x2b,
+    0xf0, 0x8f, 0x72, 0x0c, 0xad, 0x3a, 0xc4, 0xac, 0x13, 0x2b, 0x0b, 0x00, 0x2c, 0x4d, 0xdd, 0x2f,
+    0x17, 0x72, 0x3a, 0x59, 0x69, 0x2b, 0xd2, 0xc2, 0x42, 0x89, 0x56, 0xbe, 0x9b, 0x6e, 0x4d, 0xd5,
+    0x57, 0x44, 0xa6, 0x9d, 0x43, 0x68, 0x6a, 0x10, 0xd8, 0xa2, 0x4b, 0xbc, 0xa3, 0x0b, 0x2e, 0xc4,
+    0xce, 0x2e, 0x51, 0x68, 0xf8, 0x26, 0xa0, 0xd2, 0x5e, 0xad, 0xb3, 0xb9, 0x71, 0x8b, 0xa0, 0x27,
+    0x3e, 0x31, 0xf5, 0x24, 0xbe, 0x2f, 0xed, 0x1d, 0xe0, 0x28, 0x14, 0x33, 0xb4, 0xac, 0xd3, 0x07,
+    0xbd, 0x6c, 0x85, 0x40, 0x34, 0xd3, 0x8c, 0xc8, 0xd4, 0x20, 0xb3, 0xc2, 0xd5, 0xb4, 0x86, 0x30,
+    0xb0, 0x68, 0xfc, 0xf4, 0xa9, 0xf8, 0x6d, 0x0b, 0xee, 0x32, 0xc5, 0xec, 0x65, 0x59, 0x41, 0x95,
+    0xc8, 0x3d, 0x53, 0x25, 0x2f, 0x22, 0x1a, 0xdc, 0xdd, 0xe9, 0xba, 0x15, 0xd1, 0xdc, 0xf0, 0xd1,
+    0x14, 0xe8, 0x22, 0x7a, 0x82, 0x10, 0xef, 0x9e, 0xff, 0xd7, 0x1f, 0x1f, 0x3e, 0x7e, 0x3e, 0x77,
+    0xe9, 0xea, 0x1e, 0xed, 0x0f, 0x7c, 0xd1, 0x45, 0xce, 0x54, 0xb7, 0x04, 0x72, 0xf0, 0x8b, 0x90,
+    0x7c, 0xf8, 0xcd, 0xc0, 0xb3, 0xc0, 0x88, 0x0f, 0x1e, 0x17, 0xa4, 0x14, 0xc2, 0x25, 0x56, 0xaf,
+    0x30, 0x5d, 0xa6, 0x5f, 0x60, 0x3e, 0x15, 0xfd, 0x2b, 0x80, 0xe0, 0x40, 0x69, 0x17, 0xfe, 0xf4,
+    0xe1, 0xcf, 0x10, 0xfe, 0x8c, 0xe0, 0xcf, 0x58, 0xb4, 0x20, 0xe7, 0x8b, 0xc6, 0x40, 0x28, 0xa8,
+    0x7a, 0xe0, 0xb7, 0x68, 0xdf, 0x93, 0x7d, 0x06, 0x65, 0x3f, 0xea, 0x33, 0x87, 0x0e, 0x78, 0x93,
+    0x06, 0x51, 0xa1, 0x93, 0xe5, 0xf0, 0x20, 0xec, 0x3b, 0x55, 0x6f, 0xa0, 0x1a, 0xbc, 0x6d, 0xb5,
+    0x16, 0xc0, 0x26, 0x57, 0x05, 0x74, 0x79, 0x91, 0x18, 0x9f, 0x68, 0xcf, 0x04, 0xb9, 0xac, 0x78,
+    0x16, 0x10, 0x84, 0x1b, 0xf8, 0x45, 0x0f, 0x67, 0x50, 0x01, 0x46, 0x1d, 0xfe, 0x66, 0x0b, 0x0e,
+    0x86, 0xff, 0x02, 0x75, 0xa2, 0x62, 0x8c, 0x25, 0xc3, 0x18, 0x97, 0x16, 0xf0, 0x09, 0xad, 0x83,
+    0x5c, 0x75, 0xbd, 0x38, 0x9e, 0x40, 0xbb, 0x73, 0x97, 0x28, 0xde, 0x97, 0x28, 0xbf, 0xfa, 0x71,
+    0x41, 0xe2, 0x2f, 0x97, 0x17, 0x6d, 0x08, 0xe3, 0x8d, 0xc4, 0x15, 0x4e, 0xa9, 0x2e, 0x77, 0xfc,
+    0xf5, 0x63, 0xe3, 0x3c, 0xc7, 0x34, 0x8c, 0x81, 0x20, 0xc1, 0x87, 0x4a, 0x9e, 0xe9, 0xf2, 0x38,
+    0x3c, 0x0f, 0xf4, 0x89, 0x8e, 0x7a, 0x00, 0xc0, 0x24, 0xc7, 0x7a, 0x79, 0x14, 0x00, 0x78, 0xe5,
+    0xcf, 0x24, 0x8a, 0x0d, 0xaa, 0x2b, 0x0f, 0x04, 0xe8, 0xc8, 0x76, 0x2a, 0xae, 0xbf, 0xac, 0x97,
+    0x02, 0x51, 0x8b, 0x34, 0x46, 0x1d, 0xdd, 0x5d, 0x19, 0xd4, 0x3a, 0xee, 0x95, 0xa2, 0x42, 0xcc,
+    0xee, 0xee, 0x6c, 0x54, 0x48, 0x85, 0xf2, 0xd1, 0x8f, 0xe9, 0x81, 0xa6, 0x58, 0x1b, 0xb7, 0xda,
+    0x55, 0x11, 0x3c, 0x0e, 0x4c, 0xfc, 0x90, 0x0a, 0x90, 0xfb, 0x3b, 0x5a, 0x71, 0xc4, 0x1e, 0xa6,
+    0x26, 0x98, 0xfc, 0xcc, 0x15, 0x3e, 0xb1, 0x29, 0x30, 0x9e, 0xfe, 0x75, 0xf3, 0x51, 0x40, 0xde,
+    0x36, 0x1e, 0xd5, 0x7a, 0xea, 0xc4, 0xfb, 0xba, 0x95, 0x89, 0x33, 0xf3, 0x20, 0x2b, 0x82, 0xf7,
+    0xcd, 0x63, 0xb5, 0x0d, 0x30, 0x37, 0x35, 0x81, 0xdf, 0xbb, 0xbb, 0xbe, 0x29, 0x14, 0xb8, 0xd2,
+    0x80, 0x0c, 0x3b, 0x34, 0xc0, 0x5f, 0x00, 0x21, 0xf8, 0xaf, 0x06, 0x62, 0x8e, 0xd5, 0x73, 0xac,
+    0x43, 0x76, 0xa6, 0x2a, 0x5c, 0x25, 0xfd, 0x1a, 0xcb, 0xaf, 0x2d, 0xbd, 0xd8, 0x4c, 0xd3, 0xb7,
+    0x81, 0x6f, 0xb0, 0xc9, 0x06, 0xba, 0x22, 0xab, 0x57, 0x3d, 0x6f, 0xb0, 0xf8, 0xc6, 0xd2, 0x6f,
+    0xaa, 0x9e, 0x4a, 0x27, 0x62, 0x6c, 0x6c, 0x41, 0x0f, 0xd0, 0x19, 0x99, 0xbb, 0x82, 0x4d, 0x10,
+    0xc4, 0x66, 0x1c, 0xe1, 0x4d, 0x4f, 0x96, 0xae, 0x6e, 0xcf, 0x11, 0x8b, 0xfd, 0xff, 0x32, 0x42,
+    0x92, 0x3b, 0xf6, 0x98, 0xa0, 0x9a, 0x86, 0x2d, 0xb6, 0xdd, 0x48, 0x91, 0x71, 0x08, 0x2e, 0x0c,
+    0xbd, 0x23, 0xb6, 0x7f, 0xd1, 0xef, 0x99, 0xf3, 0x18, 0xcd, 0x46, 0xda, 0xfe, 0x33, 0xc3, 0xc1,
+    0x64, 0x49, 0x50, 0x18, 0x12, 0x19, 0x7e, 0x05, 0x20, 0xa0, 0xd7, 0x77, 0x77, 0x63, 0xa1, 0xf7,
+    0x6b, 0xe3, 0x37, 0x75, 0xb3, 0xa6, 0x19, 0x41, 0x3b, 0x5b, 0x24, 0x79, 0x76, 0x77, 0xf7, 0xe5,
+    0xa2, 0x8a, 0x63, 0x4a, 0xf6, 0x97, 0x86, 0xa1, 0xed, 0x63, 0xa0, 0x63, 0x60, 0xf0, 0x72, 0x7b,
+    0x5f, 0xc7, 0x5a, 0xdd, 0x2c, 0xac, 0x8c, 0x26, 0xc1, 0x94, 0x56, 0xef, 0x2b, 0x05, 0x67, 0x8f,
+    0x7d, 0xcc, 0xdc, 0xdb, 0x7b, 0x81, 0x72, 0xba, 0x03, 0xd0, 0x17, 0x21, 0xf4, 0x17, 0x4a, 0x7f,
+    0x0e, 0xfd, 0xb3, 0x2f, 0xbc, 0x8c, 0xac, 0x2e, 0x2f, 0x5c, 0x2e, 0xa3, 0x19, 0x69, 0x12, 0xbf,
+    0x48, 0x59, 0x40, 0xbe, 0x45, 0x0e, 0x2c, 0x78, 0xe8, 0xa2, 0x84, 0x71, 0x49, 0x30, 0xa0, 0x67,
+    0x15, 0xa9, 0xc1, 0x9b, 0x09, 0x5a, 0xe4, 0xbe, 0x32, 0xab, 0x42, 0x52, 0x7e, 0x70, 0x5d, 0x32,
+    0x07, 0x4f, 0x9f, 0x56, 0xef, 0x52, 0x74, 0x44, 0x81, 0x02, 0x83, 0xde, 0x25, 0x00, 0xa2, 0x94,
+    0x30, 0xca, 0x99, 0x62, 0x86, 0x1b, 0x8b, 0x6f, 0xdd, 0x2e, 0x79, 0x3e, 0x4f, 0x82, 0x89, 0xfe,
+    0xf1, 0xc3, 0xf9, 0x67, 0xdd, 0x12, 0x57, 0x5a, 0xb2, 0xc9, 0xad, 0x2e, 0x1d, 0xe1, 0xd6, 0x67,
+    0xd0, 0x81, 0xa0, 0x67, 0xf1, 0x8b, 0x19, 0x91, 0x4f, 0xe9, 0xe3, 0x0e, 0x72, 0x89, 0x7e, 0x2f,
+    0x36, 0x08, 0xf1, 0x56, 0xcc, 0xe4, 0x7f, 0x9c, 0x7f, 0xf8, 0xa5, 0x9d, 0x91, 0x9a, 0x8e, 0xc2,
+    0x1b, 0xe3, 0x96, 0xc6, 0xbe, 0x37, 0xef, 0x1f, 0x67, 0xad, 0x62, 0x15, 0x96, 0xae, 0xe0, 0xa7,
+    0xf7, 0xd9, 0x4c, 0x97, 0x13, 0x10, 0xca, 0xb1, 0x9d, 0x5c, 0x9a, 0xb7, 0x4b, 0x55, 0x61, 0x2d,
+    0xb3, 0x99, 0x96, 0x5c, 0xea, 0xd3, 0x65, 0xcd, 0x5f, 0xd7, 0xe5, 0xd9, 0x02, 0x64, 0x9b, 0xa0,
+    0xad, 0x4f, 0xef, 0x25, 0x0c, 0xf0, 0xef, 0xf9, 0x76, 0x7f, 0x9e, 0xa6, 0xfb, 0x00, 0xa4, 0xfc,
+    0x4f, 0xb2, 0x2d, 0x13, 0x0d, 0x34, 0x7b, 0x80, 0x77, 0xf2, 0x48, 0x33, 0x3c, 0x03, 0xb4, 0x04,
+    0xcc, 0x3a, 0xd7, 0xee, 0x42, 0xff, 0xa0, 0xe1, 0x94, 0xbb, 0x0f, 0x34, 0x06, 0xe2, 0x6c, 0x6e,
+    0xbb, 0x46, 0xd5, 0x1e, 0x90, 0x2a, 0xba, 0xc5, 0x96, 0xce, 0x01, 0xc2, 0x0b, 0x88, 0xe1, 0x15,
+    0x90, 0x32, 0xa4, 0x04, 0xb9, 0x84, 0x57, 0x74, 0x77, 0x4a, 0x39, 0x2e, 0x6e, 0x6f, 0x28, 0x6d,
+    0xf0, 0xb5, 0xd6, 0x46, 0x5c, 0x92, 0x50, 0x5a, 0x88, 0x82, 0xad, 0x36, 0x78, 0x18, 0xbd, 0xd1,
+    0x0a, 0x8b, 0x40, 0x6d, 0xd8, 0x65, 0x3b, 0x71, 0xd8, 0x5f, 0x69, 0x25, 0x0a, 0xee, 0xee, 0x46,
+    0x65, 0x93, 0x32, 0x41, 0x51, 0x34, 0x11, 0x05, 0x77, 0x77, 0xbd, 0xe9, 0x03, 0xf9, 0x09, 0xb5,
+    0x59, 0x01, 0x49, 0x9e, 0x2a, 0x2d, 0x41, 0xbd, 0x67, 0xf9, 0xbc, 0x4d, 0x7e, 0x9a, 0x01, 0xcb,
+    0x2b, 0x6b, 0xa1, 0x83, 0x6d, 0xdb, 0x66, 0xc7, 0xc1, 0xbf, 0xd5, 0xae, 0x5e, 0x6d, 0x36, 0xa2,
+    0x00, 0xf1, 0x7c, 0x20, 0xbb, 0xa1, 0x36, 0x2b, 0x21, 0xa9, 0x41, 0x2a, 0xb6, 0x58, 0x92, 0xf7,
+    0x69, 0x97, 0xb2, 0x4e, 0x34, 0xa0, 0xe0, 0xd4, 0x2c, 0x53, 0x64, 0x55, 0x19, 0x5e, 0x47, 0x86,
+    0xf8, 0xc7, 0x54, 0x9a, 0x57, 0xd1, 0xac, 0xa9, 0x64, 0xce, 0xd4, 0xf2, 0x7a, 0xa7, 0x1d, 0x49,
+    0x0f, 0xa9, 0x27, 0x8a, 0xa4, 0x51, 0x20, 0x3e, 0x76, 0x80, 0x9e, 0x4c, 0xb5, 0x0c, 0x74, 0x1a,
+    0x09, 0xd3, 0xda, 0xe2, 0x62, 0x34, 0x52, 0x98, 0x8a, 0x40, 0x0b, 0x85, 0x0c, 0x44, 0xab, 0x6c,
+    0x29, 0x37, 0xbb, 0x95, 0xa6, 0x3f, 0xfc, 0x80, 0x26, 0x80, 0x4a, 0xeb, 0xad, 0xf2, 0xe5, 0x9e,
+    0xc5, 0x90, 0xb5, 0x77, 0x77, 0x43, 0x7b, 0xc7, 0x6a, 0x88, 0xbd, 0xe2, 0xc6, 0x00, 0xa2, 0xb0,
+    0xc2, 0x97, 0x8e, 0x54, 0x34, 0xda, 0x88, 0xc2, 0xb2, 0x0d, 0x5d, 0xf0, 0x68, 0x34, 0xa1, 0xb2,
+    0xb2, 0x85, 0xc8, 0x2b, 0x2b, 0xcb, 0x25, 0x0a, 0x6a, 0xbc, 0x2e, 0x93, 0xb8, 0x0d, 0x38, 0xb2,
+    0xb4, 0x6c, 0x15, 0x5e, 0x35, 0x98, 0x03, 0xfc, 0x14, 0xd4, 0x2a, 0xe1, 0x95, 0x54, 0x29, 0xc2,
+    0xbe, 0xd6, 0x43, 0xa0, 0xa0, 0x2d, 0x83, 0xa0, 0xaa, 0xf6, 0xd7, 0x38, 0xca, 0xa1, 0x62, 0xaf,
+    0xd5, 0x7c, 0xd2, 0xe9, 0x68, 0xaf, 0xaf, 0xf3, 0x94, 0x55, 0x77, 0x3c, 0xb2, 0x89, 0x86, 0x97,
+    0x08, 0xb4, 0xae, 0x96, 0xc4, 0x57, 0x2c, 0x0d, 0x32, 0x0b, 0x22, 0xee, 0x75, 0x86, 0x67, 0xb9,
+    0xfc, 0x39, 0x5d, 0xfa, 0xc0, 0x0d, 0xce, 0xe2, 0x18, 0x54, 0x36, 0x07, 0x6b, 0x59, 0xd7, 0x3c,
+    0xc5, 0x98, 0x8d, 0x88, 0x15, 0xe7, 0x2e, 0xef, 0x38, 0xe8, 0xa6, 0x85, 0xdf, 0x78, 0x2a, 0x8a,
+    0xf0, 0xbe, 0x82, 0x1a, 0x9f, 0x62, 0x19, 0xb2, 0x24, 0xfd, 0xa2, 0x1f, 0x50, 0x86, 0xaa, 0x35,
+    0x77, 0x01, 0x41, 0x6c, 0x39, 0x10, 0xd4, 0xa7, 0x34, 0x97, 0xc6, 0xda, 0x8a, 0xcc, 0xba, 0xd9,
+    0x8e, 0xdd, 0xe8, 0xb8, 0x2b, 0xed, 0xb6, 0x00, 0x99, 0x41, 0x44, 0xf2, 0x3c, 0xf8, 0x93, 0x61,
+    0x94, 0x83, 0x90, 0x80, 0x1b, 0xe8, 0xf2, 0x3e, 0xc7, 0x88, 0x4c, 0x5a, 0x03, 0x7d, 0x7f, 0xa2,
+    0x1f, 0xa7, 0x0b, 0x2a, 0x3f, 0x3e, 0xd6, 0xb5, 0xc3, 0xae, 0x8d, 0xad, 0x41, 0x1d, 0x1e, 0x47,
+    0xe8, 0xf4, 0xd7, 0x32, 0x19, 0xe2, 0x5a, 0x89, 0x8b, 0xfe, 0x66, 0xb1, 0xc5, 0x20, 0x73, 0x19,
+    0x87, 0x0e, 0x7f, 0xd0, 0x0d, 0xad, 0x35, 0x29, 0x5a, 0x31, 0xfe, 0xfe, 0x3b, 0x5a, 0x7a, 0x25,
+    0x3e, 0x02, 0xdd, 0x82, 0xa7, 0xd7, 0xed, 0x86, 0xee, 0x2e, 0xe0, 0x55, 0x0d, 0x54, 0xb5, 0x2d,
+    0x7d, 0x07, 0x70, 0x51, 0x31, 0x1d, 0x1f, 0xbb, 0xce, 0x34, 0x3e, 0x75, 0xc5, 0x1a, 0x89, 0x78,
+    0xe4, 0x18, 0x4a, 0x8e, 0x8f, 0x4d, 0x5a, 0x4b, 0x70, 0xf2, 0x8c, 0x98, 0x5f, 0x69, 0x1f, 0x28,
+    0x1c, 0x33, 0xf4, 0x62, 0x6a, 0x56, 0x2c, 0x02, 0xec, 0x9d, 0x8d, 0xc0, 0xdb, 0x82, 0xe0, 0x37,
+    0xe0, 0x78, 0x4c, 0x0f, 0x7f, 0xd1, 0x6b, 0x02, 0x8f, 0x23, 0xd7, 0x95, 0x3e, 0xa5, 0x01, 0xc3,
+    0x8a, 0x67, 0xb2, 0x7e, 0x22, 0xc3, 0x43, 0xc1, 0x67, 0x77, 0x77, 0x4e, 0xdd, 0x8d, 0x9c, 0xf1,
+    0x5c, 0x30, 0xb2, 0xc2, 0xc7, 0x60, 0xe6, 0xa5, 0x0b, 0x59, 0xcc, 0x28, 0x72, 0xed, 0x69, 0x45,
+    0xa3, 0x69, 0x04, 0x53, 0x81, 0x46, 0x32, 0xa5, 0x11, 0xad, 0x26, 0x4d, 0xfa, 0xc9, 0x0c, 0x88,
+    0x85, 0x34, 0x9a, 0xa8, 0xd9, 0xc8, 0x06, 0x19, 0x4d, 0x24, 0x60, 0x2d, 0xff, 0x01, 0x60, 0xeb,
+    0x46, 0xbe, 0x7e, 0x7e, 0xa4, 0x42, 0x12, 0x1d, 0x2b, 0xb7, 0xe9, 0x58, 0x09, 0x8d, 0x0d, 0xf4,
+    0x99, 0x34, 0xcc, 0xba, 0x60, 0x70, 0xb4, 0xda, 0x93, 0x1d, 0x06, 0x5d, 0xd4, 0x0a, 0x8b, 0x3d,
+    0xd9, 0x32, 0xe6, 0x55, 0xed, 0xd6, 0x74, 0x9a, 0x16, 0xdd, 0x14, 0x6d, 0x85, 0xbd, 0xae, 0xb5,
+    0xac, 0xdb, 0x74, 0xd9, 0x4e, 0x58, 0xe3, 0x5a, 0xbb, 0xba, 0x61, 0x97, 0xed, 0xa4, 0x15, 0xae,
+    0x35, 0x6c, 0xd8, 0x6d, 0xf3, 0x27, 0xb4, 0x06, 0x65, 0x73, 0xaf, 0x81, 0x68, 0xdd, 0x54, 0x17,
+    0x60, 0xd1, 0xca, 0x4e, 0x1e, 0x48, 0x16, 0x17, 0x93, 0x21, 0x7b, 0x39, 0x29, 0x1e, 0x2c, 0x19,
+    0xf4, 0x14, 0x86, 0x74, 0x52, 0x3d, 0x8a, 0x2a, 0xb2, 0x93, 0x13, 0x75, 0x23, 0x49, 0x4e, 0x97,
+    0x4c, 0xe3, 0x64, 0x87, 0xdd, 0xb4, 0xa4, 0x4b, 0x4e, 0xd6, 0x70, 0xb2, 0xcb, 0x5c, 0x2a, 0x2d,
+    0xf2, 0x65, 0x0d, 0xe7, 0x86, 0xcd, 0x54, 0x09, 0x21, 0xac, 0xdf, 0x64, 0x87, 0x71, 0x94, 0x08,
+    0x91, 0xe5, 0x9b, 0xec, 0x30, 0x8c, 0x92, 0x5f, 0xd0, 0xec, 0x4d, 0xb6, 0x6d, 0xa2, 0x55, 0xb8,
+    0x0c, 0x60, 0xf5, 0x26, 0x5b, 0x06, 0xb1, 0x60, 0xfe, 0xd2, 0xaf, 0x00, 0x8b, 0x37, 0xd9, 0x65,
+    0x12, 0x2d, 0x25, 0x11, 0x37, 0x69, 0xe4, 0x41, 0x65, 0x6f, 0x14, 0xcd, 0x49, 0x25, 0xa3, 0x92,
+    0x0a, 0x28, 0xd8, 0x93, 0x9a, 0x55, 0x91, 0xb2, 0x0f, 0xb1, 0x8f, 0x90, 0xfa, 0xaa, 0xfb, 0xc3,
+    0xed, 0x9e, 0x81, 0x6b, 0xc1, 0xc3, 0x28, 0x06, 0x7f, 0xbe, 0x26, 0xa6, 0x8d, 0x0e, 0xe6, 0x56,
+    0x7c, 0x54, 0x7a, 0xd8, 0xdf, 0x12, 0x21, 0xa1, 0x0c, 0xdf, 0x9b, 0x84, 0xea, 0xd7, 0x45, 0x42,
+    0xca, 0x91, 0xad, 0xbf, 0x18, 0x0e, 0x95, 0x97, 0xd6, 0x44, 0x40, 0xa4, 0x9d, 0x27, 0x4b, 0x5e,
+    0x9e, 0xd9, 0x4e, 0xf9, 0xbf, 0xd6, 0x51, 0x8a, 0xb7, 0x1b, 0xbd, 0x24, 0xc9, 0xff, 0x52, 0xb4,
+    0xf4, 0x1a, 0x63, 0x16, 0x04, 0x8e, 0x27, 0xa4, 0x0a, 0x74, 0x4b, 0x48, 0x75, 0x1f, 0xe5, 0xb1,
+    0xf9, 0xfd, 0xd5, 0x78, 0x49, 0x0e, 0x55, 0xd7, 0xa7, 0x8d, 0x93, 0x73, 0x32, 0xc9, 0xf6, 0x03,
+    0x0c, 0x1e, 0x46, 0xe9, 0xd2, 0xd0, 0xc5, 0x49, 0x14, 0x86, 0xe6, 0xa6, 0x20, 0x11, 0x1e, 0x21,
+    0x63, 0x18, 0xf2, 0xdf, 0x68, 0x81, 0x3c, 0x5d, 0x07, 0xbe, 0x99, 0x92, 0x5a, 0xfb, 0xae, 0x4c,
+    0xb1, 0x3f, 0x6c, 0x26, 0xd4, 0x27, 0x79, 0x8a, 0x99, 0x84, 0x22, 0x76, 0x26, 0x02, 0xd6, 0x03,
+    0xc1, 0xa9, 0x9a, 0xd0, 0x99, 0x56, 0x0e, 0xe0, 0xbb, 0x68, 0xc3, 0x35, 0xf1, 0x9d, 0x88, 0x89,
+    0x86, 0xa6, 0x8b, 0x07, 0x74, 0xaa, 0x4d, 0xeb, 0x70, 0xdc, 0xa8, 0xca, 0x34, 0x03, 0x8f, 0xb1,
+    0x69, 0xf2, 0x53, 0x12, 0x47, 0x96, 0x38, 0x81, 0x8b, 0xf9, 0xaa, 0x9c, 0x1d, 0x69, 0xa2, 0x0d,
+    0x00, 0x03, 0x48, 0xe0, 0xda, 0x2f, 0x32, 0xfa, 0x12, 0x13, 0xd2, 0x66, 0x95, 0x2c, 0x16, 0xb8,
+    0xca, 0x1d, 0xd1, 0x51, 0xdc, 0x06, 0x10, 0xb7, 0x6c, 0xf3, 0x94, 0xb3, 0x25, 0x1e, 0x90, 0xc3,
+    0x23, 0x67, 0x6d, 0xda, 0xab, 0xcf, 0x72, 0x4a, 0xa8, 0x28, 0xeb, 0x01, 0x12, 0x98, 0x8a, 0x7b,
+    0x5d, 0xaa, 0x7d, 0x0b, 0xdc, 0x2c, 0x97, 0x79, 0x2c, 0xf9, 0x95, 0x0a, 0x3a, 0x3d, 0x53, 0xf2,
+    0x01, 0x14, 0x8a, 0x08, 0x1c, 0x8d, 0xd9, 0x33, 0x1d, 0x48, 0x37, 0xd1, 0xc9, 0xc2, 0xc8, 0x4e,
+    0x59, 0xd1, 0xa7, 0xc6, 0x25, 0xe2, 0x73, 0x16, 0x55, 0x3f, 0xf0, 0xa5, 0x57, 0x62, 0x2b, 0x38,
+    0x68, 0xa7, 0x60, 0x30, 0x8f, 0xf5, 0xe0, 0xc5, 0xd2, 0x04, 0x50, 0xe0, 0xf8, 0xca, 0x0b, 0xd7,
+    0x3c, 0x28, 0x61, 0x8a, 0x8f, 0x59, 0xec, 0xc1, 0x03, 0x6d, 0xe1, 0x4e, 0x3c, 0x44, 0x97, 0x1a,
+    0x1a, 0xf2, 0xab, 0x17, 0x4a, 0xbf, 0x6a, 0xb0, 0x3d, 0x63, 0xd3, 0xd7, 0x2d, 0xb6, 0x42, 0x49,
+    0x3c, 0x45, 0x1d, 0x3c, 0xd3, 0xdf, 0xff, 0xfa, 0xf9, 0xb5, 0x3e, 0xa1, 0x80, 0xb0, 0x6c, 0xfe,
+    0xb3, 0x48, 0xc1, 0x36, 0x3a, 0x90, 0xb6, 0x05, 0xcf, 0xae, 0xd5, 0xd2, 0xcb, 0x96, 0x74, 0x05,
+    0x6f, 0xab, 0x25, 0x6d, 0x5b, 0x14, 0x2d, 0x15, 0x8f, 0x09, 0x97, 0x5b, 0x5d, 0xae, 0x92, 0xf9,
+    0xa9, 0xec, 0xe1, 0x8c, 0x03, 0x2c, 0x7e, 0x30, 0xad, 0xaf, 0xf8, 0x74, 0x57, 0xbc, 0x82, 0x8c,
+    0x82, 0xe3, 0xe0, 0x29, 0xe6, 0xd4, 0x8d, 0x81, 0x2d, 0x15, 0x8e, 0xa1, 0x2f, 0xb4, 0x7c, 0x14,
+    0x4c, 0x07, 0x28, 0xa0, 0xf4, 0x96, 0x6d, 0xcd, 0xdb, 0xaa, 0x5b, 0x86, 0x16, 0x25, 0xe7, 0x29,
+    0x68, 0x70, 0xa3, 0x42, 0xda, 0xea, 0x52, 0xd4, 0xa8, 0xce, 0x62, 0x7a, 0xaf, 0xe6, 0x15, 0xf3,
+    0x64, 0x55, 0x03, 0xae, 0xc0, 0xa6, 0xb3, 0x8c, 0x35, 0x98, 0xa2, 0x62, 0xda, 0xc0, 0xb5, 0x0e,
+    0x0f, 0xb0, 0xa5, 0x9d, 0x60, 0x45, 0xdb, 0x5c, 0x45, 0x31, 0x48, 0x44, 0x9b, 0x8a, 0xc5, 0x9d,
+    0x49, 0xf3, 0xb6, 0x3e, 0xad, 0xa9, 0xd4, 0x2e, 0xf7, 0xa5, 0x40, 0x40, 0xf8, 0x8e, 0x0e, 0xb1,
+    0xd2, 0x07, 0x88, 0x2e, 0xa4, 0x52, 0x30, 0x09, 0xdf, 0x75, 0xfc, 0x43, 0xae, 0x8a, 0xc5, 0x05,
+    0xf5, 0x49, 0xa5, 0x90, 0xa5, 0x33, 0x44, 0x86, 0xd2, 0xdc, 0x5e, 0x8e, 0xbd, 0xb0, 0x48, 0x13,
+    0x08, 0x50, 0x1f, 0x3c, 0xcc, 0x82, 0xb5, 0x41, 0x0a, 0xa2, 0x59, 0x6c, 0x64, 0xb9, 0xb5, 0x0d,
+    0x78, 0x3f, 0xe4, 0x24, 0x4e, 0xc0, 0xb7, 0x71, 0x15, 0x4a, 0x97, 0x15, 0xa4, 0xba, 0x5d, 0x95,
+    0x14, 0x53, 0x4d, 0xc3, 0xe0, 0xb5, 0x9a, 0xb5, 0x76, 0x09, 0xfe, 0x0e, 0xda, 0xa8, 0x3c, 0xbd,
+    0x41, 0xb5, 0x03, 0x34, 0x06, 0xdf, 0x40, 0x03, 0x05, 0xb3, 0x95, 0x1c, 0xa3, 0x93, 0xe8, 0x75,
+    0x2e, 0x15, 0xbb, 0x6d, 0x07, 0xa5, 0xc5, 0xe4, 0xb1, 0xf0, 0xa6, 0xec, 0xbe, 0xce, 0xf2, 0xb6,
+    0x06, 0x46, 0x33, 0x65, 0x33, 0xae, 0xa1, 0xde, 0x60, 0x9b, 0xd9, 0x1f, 0xcb, 0xe7, 0xed, 0x3c,
+    0x79, 0x83, 0x77, 0x7d, 0x0c, 0xc7, 0x04, 0x85, 0xb2, 0x7c, 0x5e, 0x06, 0x75, 0xa8, 0x6a, 0xd8,
+    0x25, 0x07, 0x79, 0x5a, 0xc7, 0x10, 0x95, 0x68, 0xff, 0x6b, 0x6d, 0xdb, 0xde, 0x48, 0xc3, 0xb2,
+    0x56, 0x9e, 0xb4, 0xc4, 0xdd, 0x2a, 0x80, 0x41, 0xb0, 0xa8, 0x25, 0x01, 0xcc, 0x4a, 0x80, 0x36,
+    0x01, 0xcc, 0x68, 0x33, 0xeb, 0xa1, 0x00, 0xff, 0x23, 0x6a, 0x6f, 0x3c, 0x19, 0x29, 0xf5, 0xb0,
+    0x21, 0x72, 0x3a, 0xe2, 0x3b, 0x0e, 0xa9, 0xd9, 0x20, 0x0d, 0x34, 0x36, 0xd4, 0x3d, 0xad, 0x82,
+    0x40, 0x49, 0xce, 0x3a, 0x78, 0x8e, 0xeb, 0x90, 0xbc, 0x3f, 0x9e, 0x38, 0x77, 0xf5, 0x4f, 0xeb,
+    0x38, 0xc6, 0x85, 0xd8, 0x90, 0x12, 0x15, 0x2f, 0x4a, 0x26, 0x0a, 0xb1, 0x21, 0x8f, 0x6b, 0xbd,
+    0xc2, 0xf9, 0x22, 0x4a, 0xba, 0x99, 0x1f, 0xbb, 0x25, 0x25, 0xf0, 0xea, 0x48, 0xa2, 0x51, 0xb9,
+    0xe8, 0x86, 0x5e, 0x46, 0xa3, 0x6f, 0x71, 0x64, 0x19, 0x40, 0xd7, 0x3b, 0x2b, 0x15, 0x02, 0x01,
+    0xb6, 0x61, 0xd1, 0x02, 0xef, 0x67, 0xa0, 0x6e, 0x25, 0x8e, 0x05, 0x9a, 0x1b, 0xf4, 0x60, 0x8a,
+    0xfd, 0xc0, 0x22, 0xd8, 0x06, 0x82, 0x2b, 0xf9, 0x25, 0x68, 0x0c, 0xec, 0xd7, 0xa1, 0x12, 0x08,
+    0x94, 0x71, 0x70, 0xf0, 0xe8, 0x2d, 0x87, 0xfc, 0x69, 0x58, 0x81, 0x1f, 0xf7, 0x23, 0x97, 0x5d,
+    0x46, 0xab, 0x15, 0xaa, 0x6a, 0x15, 0xb1, 0x06, 0x32, 0x3a, 0x2c, 0x38, 0x30, 0x2d, 0x7e, 0x76,
+    0x23, 0x20, 0xcb, 0x69, 0x41, 0x41, 0x84, 0x16, 0x9b, 0x8e, 0xa4, 0x33, 0x0d, 0x64, 0x9b, 0xe3,
+    0xd1, 0x74, 0x50, 0x31, 0xd9, 0x03, 0x84, 0xc0, 0xaf, 0x7d, 0x30, 0x04, 0x52, 0x1f, 0xad, 0x2c,
+    0xde, 0x1a, 0xd7, 0x92, 0x5e, 0x1c, 0x52, 0x6e, 0x2f, 0x54, 0x12, 0xbb, 0x3a, 0x44, 0x04, 0x43,
+    0xc5, 0x7b, 0x3b, 0x91, 0x17, 0xbf, 0xb5, 0x20, 0x45, 0x69, 0xbb, 0xdd, 0xae, 0xb2, 0x07, 0xc5,
+    0xc1, 0xc0, 0xe6, 0x41, 0x2f, 0x99, 0xa0, 0x11, 0x1c, 0x28, 0x41, 0x6f, 0xb1, 0x78, 0x81, 0x5d,
+    0xcd, 0x0a, 0xd5, 0x4e, 0x31, 0xaa, 0x02, 0x5e, 0xf2, 0x6f, 0xc3, 0x07, 0xab, 0x39, 0x4c, 0x4a,
+    0xa2, 0x08, 0x55, 0xb7, 0x8b, 0x85, 0x95, 0x54, 0x88, 0x86, 0xa0, 0x2d, 0x4b, 0xd7, 0x14, 0x77,
+    0x5b, 0xf2, 0xda, 0x9c, 0xef, 0xee, 0x44, 0x81, 0xca, 0x98, 0x45, 0x59, 0x14, 0xe0, 0x51, 0x5f,
+    0x4c, 0x9c, 0x8a, 0x4b, 0x38, 0x64, 0x29, 0x2c, 0x25, 0x5b, 0x79, 0xaf, 0xe4, 0x56, 0xd5, 0x26,
+    0x03, 0xd9, 0xa2, 0x92, 0xe9, 0xe2, 0xd6, 0x44, 0x71, 0x76, 0x9f, 0x2c, 0x23, 0xbc, 0x7c, 0x88,
+    0x45, 0x7e, 0xd5, 0xc2, 0xab, 0x01, 0xbb, 0x8c, 0x24, 0xe2, 0x54, 0x5c, 0xb5, 0xa8, 0x13, 0xa8,
+    0x00, 0x75, 0x80, 0x80, 0x8b, 0x81, 0x40, 0xa8, 0xa9, 0x4b, 0x29, 0xd6, 0xb0, 0xa0, 0xe2, 0x8a,
+    0x42, 0x63, 0x39, 0xa9, 0xf9, 0x33, 0xfd, 0x1c, 0xb7, 0x58, 0x27, 0x3a, 0xdd, 0x53, 0xd0, 0xd5,
+    0x1e, 0x3b, 0x38, 0xc0, 0x90, 0x7d, 0x3e, 0x15, 0x23, 0x94, 0xec, 0x47, 0xa2, 0x1a, 0xb4, 0xc5,
+    0xd5, 0x0e, 0x10, 0x1f, 0xf1, 0x60, 0x11, 0x5f, 0xd2, 0x1d, 0x0f, 0x28, 0x13, 0x97, 0x3d, 0xb0,
+    0xac, 0xd2, 0xb5, 0xde, 0x4d, 0xce, 0xb3, 0x8e, 0x63, 0x77, 0xfb, 0x66, 0x5d, 0x83, 0xfe, 0xf3,
+    0x05, 0xb9, 0x5b, 0x41, 0x9a, 0xa0, 0xb0, 0x3e, 0xab, 0x31, 0xba, 0x2c, 0x84, 0x56, 0xf2, 0xa9,
+    0xa1, 0x29, 0x64, 0x53, 0xba, 0xee, 0x41, 0x50, 0xf0, 0xe9, 0x0f, 0x65, 0x28, 0x01, 0xbf, 0xd4,
+    0x7a, 0x34, 0xab, 0xa7, 0x4f, 0x7f, 0x28, 0x56, 0xc7, 0x2c, 0x97, 0x49, 0x75, 0x4a, 0xd4, 0x35,
+    0xb2, 0x7a, 0x15, 0x7b, 0xa0, 0x87, 0x20, 0x21, 0x94, 0x00, 0x1a, 0xbe, 0x47, 0x59, 0x3e, 0xad,
+    0x33, 0xc0, 0xfd, 0x63, 0xdb, 0xa6, 0xf2, 0x5a, 0x86, 0x5f, 0xb8, 0x22, 0x3e, 0x71, 0x35, 0xdd,
+    0xd1, 0x00, 0x7c, 0xcb, 0x28, 0xe8, 0x15, 0xe8, 0xa1, 0x9c, 0x2b, 0x9f, 0xb8, 0x81, 0xf9, 0xee,
+    0x8e, 0x79, 0xca, 0x5b, 0x25, 0xfa, 0xb1, 0xff, 0x80, 0xc8, 0x29, 0xac, 0xde, 0x9c, 0xb6, 0xb9,
+    0x85, 0x61, 0x71, 0xd9, 0xe5, 0x56, 0x62, 0x2b, 0x99, 0x24, 0x13, 0x8c, 0x45, 0xde, 0x01, 0x6d,
+    0xb7, 0x91, 0xd5, 0xab, 0xee, 0x7b, 0x2c, 0xd9, 0x6a, 0x02, 0xee, 0x40, 0x0b, 0xf3, 0x42, 0xda,
+    0x0a, 0xb4, 0xa9, 0xcf, 0x41, 0xa8, 0x64, 0x96, 0x09, 0xef, 0xf2, 0xb8, 0xda, 0x32, 0x81, 0x9f,
+    0xab, 0x24, 0x8d, 0xeb, 0x92, 0x22, 0xae, 0x21, 0xa8, 0x52, 0x52, 0x66, 0x68, 0x1e, 0x93, 0x91,
+    0xe2, 0x14, 0x15, 0xa6, 0xd5, 0xc4, 0x45, 0x10, 0xdd, 0xb4, 0xae, 0x5d, 0x1f, 0x4f, 0x1d, 0x13,
+    0x97, 0x5f, 0xe7, 0x86, 0xde, 0x0d, 0x8a, 0x30, 0xfd, 0xba, 0x1d, 0x46, 0xe8, 0x79, 0xe2, 0x79,
+    0x6a, 0x1d, 0xaf, 0x7e, 0xe8, 0x53, 0x51, 0xf4, 0x09, 0x4f, 0x1c, 0xd8, 0x96, 0x6d, 0xf9, 0x6d,
+    0xf1, 0x0f, 0x1f, 0xf8, 0x6d, 0x71, 0x87, 0x44, 0x76, 0x04, 0x87, 0x1c, 0x66, 0xa3, 0xe4, 0xbc,
+    0x37, 0x4a, 0xce, 0xbb, 0x3c, 0xf2, 0x25, 0x36, 0xe1, 0xff, 0xc8, 0x9e, 0x6d, 0x3a, 0xf2, 0x69,
+    0x62, 0x17, 0xf9, 0x81, 0xda, 0xd0, 0xe9, 0xcc, 0x63, 0x46, 0x77, 0x30, 0xb0, 0x6a, 0x46, 0x10,
+    0x7c, 0xe3, 0x9f, 0x0c, 0xa7, 0x05, 0xce, 0x1b, 0x18, 0x0e, 0x1b, 0xea, 0x58, 0x29, 0x43, 0x3d,
+    0x28, 0x32, 0xf5, 0x3a, 0x2c, 0xc2, 0xd9, 0x88, 0x7e, 0xc4, 0x60, 0x61, 0x91, 0x99, 0x3f, 0x09,
+    0x1c, 0x2d, 0x02, 0x18, 0x2e, 0x92, 0x24, 0x35, 0xa2, 0x4e, 0xa3, 0xae, 0xf6, 0xd3, 0x50, 0x87,
+    0x62, 0x0e, 0x73, 0x37, 0x73, 0xcf, 0x8c, 0xac, 0x83, 0xb7, 0x0e, 0xcd, 0xba, 0x57, 0x35, 0x57,
+    0xf6, 0x24, 0xe5, 0x2d, 0x97, 0xa6, 0x77, 0xf6, 0xbe, 0x58, 0x60, 0x5a, 0x7c, 0x10, 0xd6, 0xb9,
+    0x21, 0x09, 0x81, 0x53, 0x52, 0xfc, 0x36, 0x2a, 0xe7, 0x2c, 0xc6, 0x8a, 0x52, 0xce, 0x29, 0x02,
+    0x6e, 0x79, 0xe5, 0x47, 0x62, 0x34, 0x4c, 0x84, 0x80, 0xbc, 0x01, 0x68, 0x53, 0x6c, 0xf7, 0x8a,
+    0xab, 0x9f, 0x95, 0xf6, 0x10, 0xc7, 0x46, 0x48, 0x89, 0x88, 0x47, 0x79, 0xb6, 0xc8, 0x02, 0xf5,
+    0x81, 0x3b, 0x35, 0x60, 0x0a, 0xd0, 0xff, 0xc0, 0x5f, 0xe1, 0x7e, 0x4c, 0xca, 0xae, 0xab, 0xf2,
+    0xa3, 0x00, 0x5a, 0x19, 0x30, 0x3e, 0x22, 0xbb, 0xe5, 0x8d, 0x99, 0xad, 0xb4, 0x05, 0xdd, 0xae,
+    0x22, 0x79, 0x2d, 0x44, 0x61, 0xb7, 0xb8, 0x0a, 0xbe, 0xee, 0x10, 0x28, 0xfd, 0x70, 0x79, 0xc5,
+    0x51, 0x2b, 0x59, 0x45, 0xb9, 0x13, 0x77, 0xf0, 0x28, 0x54, 0xa5, 0xef, 0x02, 0x18, 0xcb, 0x57,
+    0xbf, 0x9c, 0x2b, 0x4e, 0x26, 0xee, 0x18, 0xbd, 0x11, 0x9e, 0x95, 0x12, 0xd5, 0xf3, 0x05, 0x0a,
+    0x0a, 0x7d, 0x8f, 0x0e, 0x26, 0xcc, 0x17, 0xbb, 0x4e, 0xed, 0xfd, 0x80, 0x7e, 0x1b, 0xfe, 0x0b,
+    0x20, 0xd5, 0x89, 0xbd, 0x7a, 0xc3, 0xc3, 0x2e, 0x0c, 0xfe, 0x92, 0x48, 0x1c, 0x69, 0x34, 0xed,
+    0x06, 0xbf, 0x32, 0xb7, 0x3a, 0xd3, 0xd5, 0xc0, 0xaa, 0x1a, 0xa8, 0x90, 0xaa, 0xeb, 0xba, 0x58,
+    0x7b, 0x7b, 0xcf, 0x4a, 0x89, 0x83, 0x3a, 0x85, 0x54, 0x7b, 0x6a, 0x46, 0x60, 0xeb, 0xf2, 0x85,
+    0x3e, 0xf5, 0xda, 0x84, 0x70, 0x5b, 0x5c, 0x6e, 0x71, 0x75, 0xfc, 0x66, 0x29, 0xfe, 0xb1, 0x35,
+    0x5b, 0x2f, 0x20, 0xd4, 0xcc, 0xe2, 0xb5, 0x3c, 0x74, 0x78, 0xdd, 0x9e, 0x03, 0x43, 0x23, 0xef,
+    0x97, 0xd6, 0xea, 0xba, 0x1d, 0xad, 0xca, 0x3e, 0x74, 0x8c, 0x48, 0x34, 0x2a, 0xca, 0x8a, 0xc3,
+    0x41, 0xc4, 0x41, 0xdb, 0x3b, 0xf3, 0xb2, 0xf1, 0xae, 0xed, 0xf8, 0x6b, 0xda, 0xd3, 0x99, 0xde,
+    0x17, 0x1e, 0x5f, 0xed, 0xd8, 0x90, 0xa7, 0x78, 0x26, 0xe5, 0x22, 0x57, 0x9f, 0x22, 0x94, 0x07,
+    0x32, 0xe5, 0xd7, 0x0a, 0x01, 0xa4, 0xfc, 0x6a, 0x5a, 0xe0, 0x62, 0xbe, 0x4a, 0xe5, 0xc0, 0x82,
+    0x65, 0x1e, 0x77, 0xd0, 0x28, 0xbe, 0x48, 0x23, 0x08, 0x7c, 0xed, 0xe9, 0x2e, 0x8f, 0x6d, 0x0b,
+    0xe2, 0x21, 0xe7, 0x49, 0x80, 0xc1, 0xd0, 0x89, 0xf5, 0x19, 0xc5, 0x29, 0x77, 0x77, 0x62, 0x00,
+    0xd7, 0xb5, 0xcd, 0xa7, 0x4f, 0x8f, 0x8f, 0xe9, 0xed, 0xd4, 0xb1, 0x21, 0x1c, 0xdf, 0xe9, 0xbe,
+    0x91, 0x07, 0xdc, 0xe0, 0x4e, 0x95, 0xd3, 0x55, 0xee, 0x22, 0x0f, 0x4f, 0xad, 0xdb, 0x4d, 0x1f,
+    0x65, 0x9f, 0xbc, 0x2e, 0xfd, 0x0f, 0x35, 0xdf, 0xe7, 0x41, 0x96, 0x4e, 0x66, 0xe5, 0x42, 0x62,
+    0x44, 0xf8, 0x2b, 0x5d, 0x56, 0x93, 0xa7, 0x56, 0xf1, 0x0e, 0x1b, 0xed, 0xc9, 0x96, 0x37, 0xd8,
+    0xc0, 0x62, 0x89, 0x6b, 0x64, 0x24, 0x9c, 0xf2, 0xaa, 0xda, 0xf4, 0xc9, 0x17, 0x1d, 0x6f, 0xa4,
+    0x15, 0x87, 0x42, 0xf1, 0x99, 0xa8, 0x7c, 0xa1, 0x1e, 0x75, 0x12, 0x1f, 0x09, 0x6f, 0xa6, 0x0a,
+    0xb8, 0xc5, 0x37, 0x30, 0x03, 0xbe, 0x69, 0xaf, 0x52, 0x4a, 0x51, 0xc8, 0x5b, 0xc9, 0x86, 0x39,
+    0xa5, 0x0e, 0xd5, 0xd5, 0x18, 0xdc, 0xe7, 0x2b, 0xee, 0xc5, 0x98, 0xf7, 0x66, 0x39, 0xea, 0x02,
+    0xbf, 0xc7, 0x47, 0xa3, 0x82, 0xcd, 0xff, 0xae, 0x23, 0xca, 0x53, 0x72, 0xf5, 0x41, 0x77, 0x03,
+    0x15, 0xa3, 0x0b, 0xc8, 0xb0, 0xf2, 0x00, 0x1c, 0x33, 0x1b, 0x9f, 0xe9, 0x63, 0xef, 0x3c, 0x45,
+    0x13, 0x58, 0x71, 0x81, 0xa0, 0xe6, 0x9b, 0xdf, 0x77, 0xb7, 0xfa, 0x62, 0x5f, 0x98, 0xb8, 0x24,
+    0x82, 0xb8, 0x0f, 0x5c, 0x0e, 0xa0, 0x95, 0x87, 0xb1, 0x64, 0xc3, 0xdd, 0x43, 0xa8, 0x95, 0x05,
+    0x64, 0x5c, 0xea, 0xf3, 0xb7, 0xcf, 0x5b, 0xdd, 0xc1, 0xb0, 0xf8, 0x14, 0x64, 0xb4, 0x84, 0xd5,
+    0xb3, 0x80, 0x47, 0xe2, 0x5c, 0x5e, 0x76, 0x9e, 0xe3, 0x17, 0x1e, 0x10, 0x08, 0xdd, 0x95, 0x96,
+    0xdb, 0x30, 0xc5, 0x67, 0x0b, 0x05, 0x5b, 0xb7, 0x11, 0x90, 0x9f, 0xde, 0xac, 0xf2, 0xa4, 0x9d,
+    0xad, 0x3d, 0xd0, 0x2f, 0xe2, 0x6b, 0x90, 0xfc, 0x1a, 0x70, 0xc5, 0xaf, 0x41, 0xe2, 0x37, 0x16,
+    0xd7, 0x29, 0xd7, 0x0c, 0xbc, 0x3a, 0x97, 0x99, 0x5a, 0x02, 0xd6, 0x12, 0xc2, 0x4f, 0xfa, 0x8a,
+    0xe4, 0x6a, 0xc1, 0xf0, 0x1f, 0x36, 0x82, 0x0a, 0x84, 0x82, 0x57, 0x12, 0xb3, 0x4c, 0x7c, 0xb0,
+    0xb2, 0x3a, 0x4a, 0x50, 0x4f, 0x1e, 0x67, 0x73, 0x06, 0x18, 0xff, 0x99, 0xb5, 0x55, 0xcb, 0x21,
+    0x8a, 0x0c, 0xf2, 0xaf, 0x15, 0xe3, 0xf1, 0x4f, 0xf7, 0x8b, 0x7d, 0xdd, 0xef, 0x8e, 0x59, 0x37,
+    0x3c, 0x19, 0x5b, 0xf6, 0xf5, 0xc8, 0xe9, 0x8d, 0xfa, 0xfd, 0x13, 0x07, 0x1e, 0xbd, 0x81, 0x6f,
+    0x87, 0x9e, 0x1f, 0xc2, 0x23, 0x3f, 0xf1, 0x06, 0x81, 0xc7, 0x06, 0xf0, 0xd8, 0x3b, 0x19, 0x0c,
+    0xfd, 0xee, 0xc0, 0x83, 0xc7, 0xc1, 0x49, 0xe8, 0x38, 0x4e, 0x88, 0x6d, 0x4f, 0xba, 0xbd, 0x70,
+    0xdc, 0x65, 0x7d, 0x78, 0x64, 0x9e, 0xe3, 0x0f, 0x78, 0x30, 0x10, 0x49, 0x77, 0xfb, 0x3a, 0x18,
+    0xdb, 0x23, 0xc6, 0x08, 0xb8, 0xd3, 0x1d, 0xf7, 0x06, 0x9e, 0x8d, 0x1d, 0xba, 0xfd, 0x9e, 0x33,
+    0x1e, 0x78, 0x1c, 0xc1, 0x0c, 0x6c, 0x7f, 0x14, 0xf8, 0x3d, 0x1c, 0xbd, 0xeb, 0xf1, 0x41, 0x30,
+    0x42, 0x30, 0x63, 0x3b, 0xe0, 0x9e, 0x13, 0x62, 0x83, 0x13, 0x2f, 0xf0, 0xed, 0x21, 0x1b, 0xc1,
+    0xa3, 0xef, 0x9c, 0x78, 0xa1, 0x03, 0x0d, 0x24, 0x70, 0xde, 0x3f, 0xf1, 0x86, 0x27, 0x3e, 0x42,
+    0xe4, 0xa1, 0xc7, 0xfb, 0xa3, 0xf1, 0x10, 0x1e, 0xed, 0x10, 0xda, 0x05, 0xfe, 0x90, 0xc6, 0xb1,
+    0x7d, 0xe6, 0xf8, 0x3e, 0x3e, 0x06, 0xfc, 0xa4, 0xeb, 0x0f, 0x71, 0x3e, 0x7d, 0x36, 0xea, 0x8f,
+    0xfb, 0x8c, 0xe1, 0xe8, 0xbe, 0x67, 0x33, 0x68, 0x8c, 0xa3, 0x0f, 0x81, 0x06, 0xe3, 0x80, 0x15,
+    0xc0, 0x4f, 0xc6, 0x3d, 0x3e, 0x70, 0x06, 0x5d, 0x9c, 0xd4, 0xb8, 0xe7, 0xf8, 0xc3, 0x61, 0x80,
+    0x64, 0xb1, 0xed, 0x5e, 0x77, 0xe4, 0xe3, 0x7c, 0xbc, 0x70, 0x70, 0x32, 0x0a, 0x7d, 0x42, 0x6c,
+    0xc8, 0xc1, 0x96, 0x84, 0x38, 0x89, 0x60, 0xc0, 0x46, 0x27, 0x4e, 0x1f, 0x4b, 0xed, 0xa1, 0xcf,
+    0x86, 0xbd, 0x01, 0xa2, 0xe7, 0xf4, 0xbb, 0x27, 0xdd, 0x93, 0xe1, 0xa8, 0x00, 0xde, 0x1d, 0x79,
+    0x23, 0x9b, 0x8d, 0x91, 0xa4, 0x5d, 0xee, 0x78, 0x5d, 0xa7, 0x87, 0x10, 0xfb, 0x01, 0x60, 0x18,
+    0x84, 0x88, 0xcd, 0xa0, 0xd7, 0x03, 0x1a, 0x38, 0x08, 0x71, 0x38, 0xb0, 0xd9, 0xa8, 0x37, 0xe8,
+    0x13, 0x8e, 0x43, 0x66, 0x33, 0x0f, 0xc9, 0x3f, 0x76, 0xfc, 0xae, 0x7f, 0xd2, 0x25, 0x0a, 0x75,
+    0x47, 0xdd, 0xae, 0x3f, 0x2e, 0x69, 0xce, 0xba, 0x5e, 0xc8, 0xc7, 0xcc, 0x21, 0xcc, 0x1d, 0x36,
+    0x1c, 0xf6, 0xb1, 0x83, 0xdf, 0xed, 0x7b, 0x63, 0x18, 0x15, 0x1f, 0x47, 0x43, 0x7f, 0xe0, 0x30,
+    0x42, 0xd7, 0x01, 0x18, 0x63, 0xe7, 0x04, 0x1f, 0x87, 0x27, 0x27, 0xf6, 0xb0, 0x8b, 0xe3, 0x84,
+    0x7d, 0x9b, 0xf7, 0x06, 0x84, 0x9e, 0x03, 0xb4, 0x67, 0xf6, 0xc8, 0x2e, 0x80, 0x3b, 0x27, 0xac,
+    0xef, 0x3b, 0x0e, 0x52, 0xd7, 0xe1, 0x3d, 0x00, 0x64, 0x23, 0xe6, 0x5d, 0xa0, 0xe8, 0x68, 0xd4,
+    0x47, 0xcc, 0x7b, 0x7d, 0xcf, 0xf6, 0x7c, 0x4f, 0x70, 0x8b, 0xe3, 0xdb, 0xbe, 0x87, 0xe3, 0xf4,
+    0x79, 0x30, 0x66, 0xac, 0x4f, 0x34, 0xf7, 0x4e, 0x7c, 0x9f, 0xf5, 0x71, 0x25, 0x86, 0xe3, 0x2e,
+    0x1f, 0x86, 0x40, 0x37, 0x09, 0x1c, 0xa0, 0x00, 0x23, 0x71, 0x9c, 0xd4, 0x68, 0xcc, 0x06, 0xc3,
+    0x1e, 0xad, 0xd7, 0xb8, 0xef, 0x8f, 0x47, 0x63, 0x87, 0xf8, 0xc2, 0xf7, 0x47, 0x76, 0x97, 0x86,
+    0x3c, 0xb1, 0x3d, 0x1e, 0x86, 0x21, 0x42, 0x64, 0xfd, 0x01, 0xd0, 0x9a, 0xe3, 0x2c, 0xa1, 0xec,
+    0x84, 0xf5, 0x42, 0xb1, 0x28, 0x23, 0x67, 0x34, 0x0e, 0xbb, 0x17, 0xd5, 0x01, 0x99, 0xb7, 0xc8,
+    0xef, 0x40, 0xc2, 0x13, 0x3e, 0x1c, 0x62, 0x13, 0xcf, 0x1b, 0x8e, 0x18, 0xa7, 0x79, 0xf6, 0x60,
+    0x0d, 0xc3, 0xde, 0x88, 0x96, 0x7b, 0xd0, 0x0f, 0xc3, 0x41, 0x8f, 0x70, 0x75, 0x6c, 0x3e, 0xe8,
+    0x8e, 0x42, 0xe2, 0x43, 0x7b, 0x30, 0x1c, 0x8f, 0x71, 0x8a, 0x4e, 0x38, 0xee, 0x05, 0x27, 0x8c,
+    0xa4, 0xc0, 0xe3, 0xb6, 0x0f, 0x44, 0x54, 0x06, 0x89, 0x5d, 0x12, 0x33, 0xa9, 0x63, 0x2c, 0xf8,
+    0x71, 0x0d, 0x23, 0x3e, 0x3e, 0x39, 0x1e, 0xf6, 0xcc, 0xb3, 0xb3, 0xa1, 0x79, 0x7a, 0x3a, 0xb4,
+    0x96, 0x94, 0x79, 0xfe, 0x35, 0x8a, 0xf3, 0xf1, 0xf3, 0x34, 0x65, 0x37, 0x06, 0xb4, 0x22, 0x2b,
+    0xb3, 0x6c, 0x83, 0x01, 0x92, 0x72, 0x3a, 0x5d, 0x7e, 0x89, 0x2f, 0x5c, 0x14, 0x86, 0x0a, 0x78,
+    0xb0, 0xa1, 0x9e, 0xaf, 0x40, 0x1f, 0xe2, 0x76, 0xaa, 0xb1, 0x6c, 0x7b, 0xeb, 0x10, 0x94, 0xa2,
+    0x69, 0x5d, 0x95, 0x20, 0x7b, 0x5d, 0x01, 0x73, 0xd8, 0x27, 0x90, 0xc1, 0x06, 0x61, 0x8a, 0x0a,
+    0x1c, 0xa7, 0x35, 0x56, 0xe3, 0x89, 0xb8, 0x03, 0xab, 0x67, 0x8b, 0xff, 0x40, 0x6f, 0x6f, 0x35,
+    0xee, 0x5b, 0x46, 0xfc, 0xd3, 0x18, 0x10, 0x3f, 0xb3, 0x6b, 0x47, 0x52, 0x12, 0x70, 0x21, 0x92,
+    0x53, 0x68, 0x31, 0x4d, 0x8e, 0x5d, 0x18, 0x49, 0x78, 0x03, 0xea, 0xf1, 0x8e, 0xe8, 0xd4, 0x19,
+    0xd2, 0xc1, 0x8e, 0xab, 0x2f, 0xd1, 0x85, 0x0b, 0x80, 0x67, 0x25, 0xe0, 0xe4, 0x38, 0xfa, 0xa9,
+    0x2f, 0x0d, 0x6e, 0xd5, 0x05, 0x9b, 0x9f, 0x0e, 0xfb, 0xd4, 0xa7, 0x1e, 0x85, 0x5d, 0xbb, 0x00,
+    0xa3, 0xe5, 0x0c, 0x2e, 0xac, 0x1b, 0x7a, 0x12, 0x6b, 0x8a, 0xff, 0x11, 0x6c, 0xaa, 0x1c, 0x5e,
+    0x1c, 0x1b, 0xc6, 0x35, 0xe0, 0x39, 0xba, 0xbb, 0x3e, 0x3d, 0xed, 0x0e, 0xcc, 0xff, 0x4d, 0x6f,
+    0xce, 0x18, 0x5f, 0x9d, 0xbe, 0x7c, 0xed, 0x41, 0x20, 0x86, 0xcd, 0x47, 0xd8, 0xfa, 0x06, 0xeb,
+    0x47, 0x77, 0x37, 0x50, 0x8f, 0xcd, 0xe9, 0xf5, 0x84, 0x5e, 0x7b, 0xc5, 0xab, 0x6d, 0x16, 0x21,
+    0x55, 0xe9, 0x40, 0x7d, 0x61, 0x96, 0x67, 0xf9, 0x56, 0x60, 0x71, 0x2b, 0xb4, 0x66, 0xd6, 0xfc,
+    0xc2, 0x7d, 0x3b, 0xdd, 0x31, 0xf9, 0x9d, 0x13, 0xc9, 0x1d, 0x77, 0x0e, 0x03, 0x73, 0x00, 0x3d,
+    0xbc, 0xe3, 0x80, 0xe6, 0x10, 0x06, 0xc2, 0x37, 0xc7, 0xa1, 0x57, 0x47, 0xbe, 0x76, 0x07, 0xf8,
+    0x3a, 0x02, 0x64, 0xa1, 0xf1, 0xd3, 0x10, 0x4a, 0xff, 0x0f, 0x7f, 0x3a, 0x83, 0xd7, 0x7f, 0xc2,
+    0x7c, 0x71, 0x02, 0x17, 0x77, 0x65, 0x14, 0x2a, 0x21, 0x77, 0x81, 0xcb, 0x18, 0x76, 0xbd, 0x63,
+    0xa7, 0xa7, 0x3d, 0x1b, 0xba, 0xe0, 0x9b, 0xd3, 0xc3, 0x57, 0xe7, 0x44, 0xbe, 0x76, 0xa9, 0x16,
+    0x67, 0x05, 0x80, 0xd9, 0x53, 0x0f, 0x8b, 0x9f, 0xfa, 0xf0, 0xb7, 0x07, 0x7f, 0x9b, 0x15, 0xcc,
+    0xb9, 0x3b, 0x9b, 0xce, 0xdc, 0x70, 0x1a, 0xba, 0x7c, 0xca, 0xdd, 0xe0, 0x38, 0x77, 0xa0, 0x2e,
+    0x70, 0xfd, 0xa9, 0xef, 0x7a, 0x53, 0xcf, 0x65, 0x53, 0xe6, 0xe6, 0xce, 0x71, 0xde, 0x2d, 0x7a,
+    0x08, 0xea, 0x6c, 0x51, 0x66, 0x2b, 0xb6, 0x7e, 0x8b, 0xcb, 0x85, 0x7f, 0x1d, 0x6f, 0x8a, 0x93,
+    0xd7, 0xf7, 0x55, 0xc6, 0xfc, 0x2d, 0x5d, 0x48, 0x01, 0xdf, 0xc0, 0xd8, 0x10, 0xbf, 0x41, 0xac,
+    0x2a, 0xcf, 0x1a, 0x39, 0x43, 0xb3, 0xbd, 0x62, 0x01, 0x65, 0xc0, 0x8c, 0xb1, 0xa5, 0xdb, 0x10,
+    0x8a, 0x95, 0x77, 0x4e, 0xea, 0xa7, 0xd8, 0xc9, 0xd6, 0xbd, 0xe5, 0xd7, 0x06, 0x08, 0x46, 0x11,
+    0xd5, 0xc9, 0xdd, 0x21, 0x61, 0x84, 0x9f, 0x3e, 0xad, 0x19, 0x63, 0xf3, 0x56, 0x4d, 0x99, 0xd6,
+    0xaa, 0xc0, 0x47, 0x9c, 0xf1, 0x0c, 0x62, 0x13, 0xe9, 0x06, 0xe8, 0x16, 0xc2, 0x2c, 0x1d, 0x60,
+    0x49, 0x2b, 0x12, 0xb6, 0x36, 0x7e, 0x53, 0xc9, 0x68, 0x08, 0x75, 0x00, 0x48, 0xe2, 0x8c, 0x3c,
+    0xf7, 0xcc, 0xdb, 0x33, 0x97, 0x6e, 0x63, 0x2e, 0x4d, 0x92, 0x7c, 0x04, 0xb0, 0x51, 0x86, 0x37,
+    0xf2, 0xb2, 0x64, 0x01, 0x4e, 0x56, 0x69, 0xca, 0x1b, 0x43, 0x21, 0x62, 0x66, 0x63, 0x63, 0xbe,
+    0xf2, 0x6e, 0x22, 0x39, 0x4d, 0x8c, 0x05, 0xf1, 0x85, 0x62, 0x21, 0x08, 0xbd, 0x83, 0xec, 0x77,
+    0xf0, 0x62, 0x0c, 0x1d, 0x3f, 0x71, 0x00, 0x63, 0xab, 0x81, 0x1a, 0x9d, 0x1a, 0x10, 0xdf, 0x19,
+    0x38, 0xf4, 0xc0, 0xc0, 0x47, 0xca, 0xb4, 0xcb, 0xbb, 0x42, 0x1a, 0xab, 0x3e, 0xbc, 0xd0, 0x2e,
+    0x63, 0x44, 0x39, 0x39, 0x39, 0x44, 0x36, 0xab, 0x0d, 0x82, 0xea, 0x2f, 0x9b, 0xed, 0x3c, 0x6a,
+    0x01, 0xc5, 0x8d, 0xb3, 0x09, 0xcb, 0xd5, 0x9a, 0x72, 0xfd, 0x72, 0x69, 0x8a, 0xe4, 0x38, 0x0d,
+    0xc7, 0x90, 0x24, 0x2f, 0x48, 0x2f, 0x96, 0xb9, 0xe7, 0x82, 0x2d, 0xaa, 0x77, 0x0c, 0xc9, 0xe3,
+    0x82, 0x3c, 0x16, 0x14, 0x34, 0xe9, 0xd7, 0xac, 0xae, 0xfc, 0xa6, 0xeb, 0x79, 0x4a, 0xda, 0xf6,
+    0x3f, 0xdf, 0xbf, 0x7b, 0x0b, 0xae, 0xd9, 0x27, 0xfe, 0xaf, 0x35, 0xf2, 0x89, 0x72, 0x14, 0x13,
+    0x3f, 0xe8, 0xe0, 0x8a, 0x73, 0x3e, 0xf4, 0xdd, 0x07, 0x08, 0x08, 0x3c, 0x96, 0x16, 0x25, 0x2f,
+    0xf0, 0x03, 0x2e, 0xd6, 0x8e, 0xf9, 0x63, 0xa5, 0x8c, 0x6c, 0xa5, 0x77, 0x07, 0xd1, 0x2f, 0xfe,
+    0xc3, 0x34, 0x82, 0x06, 0x8d, 0x1a, 0xfc, 0x08, 0x05, 0x84, 0xc2, 0x2c, 0x95, 0x15, 0xe2, 0x73,
+    0x29, 0xba, 0x8d, 0x3b, 0x2b, 0x00, 0x0c, 0xb0, 0x6c, 0xe3, 0xbe, 0xa0, 0x21, 0xcf, 0x4c, 0xe8,
+    0x1d, 0xb1, 0x7f, 0xf5, 0x4c, 0x10, 0xc3, 0xd5, 0x8f, 0xe1, 0xe1, 0x58, 0x7f, 0x4a, 0x77, 0x1a,
+    0xf4, 0x63, 0x22, 0x5d, 0x79, 0x9f, 0x01, 0x3b, 0x0b, 0x06, 0x82, 0xf8, 0xb7, 0xf8, 0x96, 0x45,
+    0x75, 0x3f, 0xa6, 0x10, 0x1b, 0x74, 0xe2, 0xa5, 0xa5, 0x13, 0x6b, 0x82, 0x31, 0x95, 0xd9, 0x44,
+    0x49, 0x49, 0x88, 0x41, 0x6b, 0x80, 0xc9, 0x83, 0x0e, 0x07, 0x89, 0xc8, 0xd9, 0xa2, 0xb6, 0x19,
+    0x74, 0x5f, 0x8c, 0x9c, 0xd0, 0x16, 0x40, 0xe3, 0x2a, 0x32, 0x8d, 0x86, 0xb5, 0x62, 0x3b, 0x0e,
+    0x42, 0x4c, 0x30, 0x5c, 0xa5, 0x82, 0x3d, 0x94, 0x75, 0xe4, 0x67, 0x2f, 0x36, 0xf8, 0x2f, 0x8b,
+    0x46, 0xe0, 0xab, 0x1b, 0x85, 0x8f, 0x4f, 0xe4, 0x90, 0x67, 0xb8, 0x6d, 0xcb, 0xe9, 0x02, 0x56,
+    0xc0, 0x55, 0x66, 0x5b, 0xfb, 0x54, 0x6c, 0xf7, 0x54, 0x3b, 0x30, 0xb5, 0x38, 0x51, 0xec, 0x75,
+    0x88, 0x33, 0x27, 0x20, 0xa8, 0x88, 0xb9, 0x61, 0x5a, 0x63, 0x65, 0x77, 0x82, 0x4e, 0xf9, 0xec,
+    0xc7, 0x53, 0x08, 0xd3, 0x1e, 0x44, 0x43, 0x06, 0xeb, 0x42, 0x97, 0x23, 0x70, 0xea, 0xc5, 0x67,
+    0x98, 0x3e, 0x43, 0xcb, 0x4a, 0xf5, 0x2a, 0x74, 0x13, 0xfb, 0xbd, 0x0a, 0xe1, 0xbe, 0x62, 0x3c,
+    0x8a, 0x63, 0xca, 0xbb, 0x11, 0xc4, 0x43, 0x82, 0x9b, 0xc3, 0x80, 0xd8, 0xfd, 0x4d, 0x92, 0x2e,
+    0xd1, 0xf3, 0x00, 0x46, 0x0f, 0x03, 0x99, 0xcb, 0xc0, 0x90, 0x5a, 0x7c, 0xed, 0x45, 0xb7, 0x48,
+    0xcf, 0x14, 0xa8, 0xa0, 0xf4, 0x18, 0x61, 0x20, 0x64, 0xaa, 0x71, 0x9e, 0xe6, 0x49, 0xed, 0x40,
+    0xcd, 0x13, 0x65, 0x67, 0x59, 0xbe, 0xd0, 0xae, 0x91, 0x78, 0xae, 0xf6, 0x5c, 0xc4, 0xbb, 0x48,
+    0xd7, 0x4d, 0x9f, 0xd4, 0x8e, 0x01, 0x4c, 0xf1, 0x9f, 0x8f, 0x91, 0x5f, 0xc2, 0x38, 0xed, 0xc8,
+    0x7f, 0x38, 0xa6, 0x23, 0xfe, 0x41, 0xdd, 0xff, 0x0b, 0x78, 0x0b, 0x88, 0x32, 0x61, 0x77, 0x00,
+    0x00,
 };
-$('dmode').addEventListener('change',updateSizeSliders);
-
-function addInputRow(code,name){
-  const row=document.createElement('div');row.className='input-row';
-  row.innerHTML='<input class="code" type="text" maxlength="7" placeholder="h1" value="'+
-    code.replace(/"/g,'&quot;')+'"><input class="name" type="text" maxlength="31" placeholder="Apple TV" value="'+
-    name.replace(/"/g,'&quot;')+'"><button class="del" title="Remove">&times;</button>';
-  row.querySelector('.del').onclick=function(){row.remove()};
-  $('inputRows').appendChild(row);
-}
-
-function getInputNames(){
-  const rows=document.querySelectorAll('#inputRows .input-row');
-  const arr=[];
-  rows.forEach(r=>{
-    const c=r.querySelector('.code').value.trim();
-    const n=r.querySelector('.name').value.trim();
-    if(c)arr.push({code:c,name:n});
-  });
-  return arr;
-}
-
-function loadInputNames(inputs){
-  $('inputRows').innerHTML='';
-  if(inputs&&inputs.length){
-    inputs.forEach(i=>addInputRow(i.code||'',i.name||''));
-  }
-}
-
-function loadSettings(){
-  fetch('/settings').then(r=>r.json()).then(d=>{
-    $('ssid').value=d.ssid||'';
-    $('wifipass').value=d.pass||'';
-    $('htp1ip').value=d.htp1ip||'';
-    $('htp1port').value=d.htp1port||80;
-    $('voloff').value=d.voloff||7;
-    $('bright').value=d.bright||3;$('brightVal').textContent=d.bright||3;
-    $('dimtime').value=Math.round((d.dimtime||3000)/1000);
-    $('dimbrt').value=d.dimbrt||7;$('dimbrtVal').textContent=d.dimbrt||7;
-    $('dmode').value=d.dmode||0;
-    if(d.volSizes)volSizes=d.volSizes.slice();
-    if(d.labelSizes)labelSizes=d.labelSizes.slice();
-    updateSizeSliders();
-    setTheme(d.theme||0);
-    $('sleepen').checked=!!d.sleepen;
-    $('sleeptm').value=Math.round((d.sleeptm||60000)/1000);
-    $('fw').textContent='v'+(d.fw||'?');
-    loadInputNames(d.inputs);
-  }).catch(()=>{});
-}
-
-function saveSettings(){
-  const body=JSON.stringify({
-    ssid:$('ssid').value,
-    pass:$('wifipass').value,
-    htp1ip:$('htp1ip').value,
-    htp1port:parseInt($('htp1port').value),
-    voloff:parseInt($('voloff').value),
-    bright:parseInt($('bright').value),
-    dimtime:parseInt($('dimtime').value)*1000,
-    dimbrt:parseInt($('dimbrt').value),
-    dmode:parseInt($('dmode').value),
-    volSizes:volSizes,
-    labelSizes:labelSizes,
-    theme:currentTheme,
-    sleepen:$('sleepen').checked,
-    sleeptm:parseInt($('sleeptm').value)*1000,
-    inputs:getInputNames()
-  });
-  fetch('/settings',{method:'POST',headers:{'Content-Type':'application/json'},body})
-    .then(r=>r.json()).then(d=>{
-      const m=$('settingsMsg');
-      if(d.ok){m.className='msg ok';m.textContent='Settings saved. Some changes require reboot.';}
-      else{m.className='msg err';m.textContent='Error saving settings.';}
-    }).catch(()=>{
-      const m=$('settingsMsg');m.className='msg err';m.textContent='Connection error.';
-    });
-}
-
-function resetSettings(){
-  if(!confirm('Reset all settings to factory defaults?'))return;
-  fetch('/settings',{method:'POST',headers:{'Content-Type':'application/json'},
-    body:JSON.stringify({reset:true})}).then(()=>loadSettings());
-}
-
-function pollStatus(){
-  fetch('/status').then(r=>r.json()).then(d=>{
-    $('dotWifi').className='dot '+(d.wifi?'on':'off');
-    $('stWifi').textContent='WiFi: '+(d.wifi?d.ip+' ('+d.rssi+'dBm)':'disconnected');
-    $('dotHtp').className='dot '+(d.htp1?'on':'off');
-    $('stHtp').textContent='HTP-1: '+(d.htp1?'connected':'disconnected');
-    $('stVol').textContent=d.muted?'MUTE':d.vol;
-    $('stInput').textContent=d.input||'--';
-    $('stCodec').textContent=d.codec||'--';
-  }).catch(()=>{});
-}
-
-// OTA Upload
-const zone=$('uploadZone'),fwFile=$('fwFile');
-['dragenter','dragover'].forEach(e=>zone.addEventListener(e,ev=>{ev.preventDefault();zone.classList.add('active')}));
-['dragleave','drop'].forEach(e=>zone.addEventListener(e,ev=>{ev.preventDefault();zone.classList.remove('active')}));
-zone.addEventListener('drop',ev=>{if(ev.dataTransfer.files.length)uploadFW(ev.dataTransfer.files[0])});
-fwFile.addEventListener('change',()=>{if(fwFile.files.length)uploadFW(fwFile.files[0])});
-
-function uploadFW(file){
-  if(!file.name.endsWith('.bin')){
-    const m=$('otaMsg');m.className='msg err';m.textContent='Please select a .bin file.';return;
-  }
-  const xhr=new XMLHttpRequest();
-  const prog=$('progWrap'),bar=$('progBar'),msg=$('otaMsg');
-  prog.style.display='block';msg.style.display='none';bar.style.width='0%';
-
-  xhr.open('POST','/update');
-  xhr.upload.onprogress=function(e){
-    if(e.lengthComputable)bar.style.width=Math.round(e.loaded/e.total*100)+'%';
-  };
-  xhr.onload=function(){
-    if(xhr.status===200){
-      msg.className='msg ok';msg.textContent='Update successful! Rebooting...';
-      setTimeout(()=>location.reload(),8000);
-    }else{
-      msg.className='msg err';msg.textContent='Update failed: '+xhr.responseText;
-    }
-  };
-  xhr.onerror=function(){msg.className='msg err';msg.textContent='Upload error.';};
-
-  const fd=new FormData();fd.append('firmware',file);
-  xhr.send(fd);
-}
-
-loadSettings();
-setInterval(pollStatus,2000);
-pollStatus();
-</script>
-</body>
-</html>)rawliteral";
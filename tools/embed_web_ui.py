@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Embed the web UI into the firmware as a pre-gzipped PROGMEM array.
+
+Reads HTP1_Display/web_ui.html and writes HTP1_Display/web_ui.h with:
+
+  WEB_UI_GZ[]     gzip-compressed page (served with Content-Encoding: gzip)
+  WEB_UI_GZ_LEN   its length in bytes
+  WEB_UI_ETAG     strong ETag: quoted SHA-256 prefix of the uncompressed page
+
+The output is deterministic (gzip mtime = 0, no file name), so the same
+HTML always produces the same header and the same ETag.
+
+Run after every edit to web_ui.html:
+
+    python3 tools/embed_web_ui.py
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "HTP1_Display", "web_ui.html")
+DST = os.path.join(ROOT, "HTP1_Display", "web_ui.h")
+
+BYTES_PER_LINE = 16
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else SRC
+    dst = sys.argv[2] if len(sys.argv) > 2 else DST
+
+    with open(src, "rb") as f:
+        html = f.read()
+
+    gz = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(html).hexdigest()[:16]
+
+    lines = []
+    for i in range(0, len(gz), BYTES_PER_LINE):
+        chunk = gz[i:i + BYTES_PER_LINE]
+        lines.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+    out = [
+        "#pragma once",
+        "",
+        "// Generated by tools/embed_web_ui.py from web_ui.html — do not edit.",
+        "// %d bytes HTML -> %d bytes gzip (%.0f%% smaller)"
+        % (len(html), len(gz), 100.0 * (1 - len(gz) / len(html))),
+        "",
+        "#include <Arduino.h>",
+        "",
+        '#define WEB_UI_ETAG "\\"%s\\""' % etag,
+        "#define WEB_UI_GZ_LEN %d" % len(gz),
+        "",
+        "static const uint8_t WEB_UI_GZ[WEB_UI_GZ_LEN] PROGMEM = {",
+        *lines,
+        "};",
+        "",
+    ]
+
+    with open(dst, "w", newline="\n") as f:
+        f.write("\n".join(out))
+
+    print("%s: %d -> %d bytes, ETag %s" % (os.path.basename(dst), len(html), len(gz), etag))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,171 @@
+"""Minimal HTP-1 stand-in: /ircmd over HTTP and /ws/controller over WebSocket.
+
+Shared plumbing for the host-side tools that play an HTP-1 to a display
+(replay_htp1.py). Standard library only. One port serves both endpoints,
+like the real processor; point the display's HTP-1 address at this host
+and its port at the one given here.
+
+An application object supplies the behaviour:
+
+    class App:
+        def ircmd(self):        -> str or None (None = 503)
+        def on_ws(self, ws):    called on the connection's thread; returns
+                                when the connection should close
+"""
+
+import base64
+import hashlib
+import http.server
+import socket
+import struct
+import sys
+import threading
+
+WS_PATH = "/ws/controller"   # Must match HTP1_WS_PATH in config.h
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+OP_TEXT, OP_BINARY, OP_CLOSE, OP_PING, OP_PONG = 0x1, 0x2, 0x8, 0x9, 0xA
+
+
+# ============================================================
+# WebSocket (RFC 6455, server side)
+# ============================================================
+
+class WebSocket:
+    def __init__(self, sock, peer):
+        self.sock = sock
+        self.peer = peer
+        self.open = True
+        self._send_lock = threading.Lock()
+
+    def _recv_exact(self, n):
+        buf = b""
+        while len(buf) < n:
+            chunk = self.sock.recv(n - len(buf))
+            if not chunk:
+                raise ConnectionError("closed")
+            buf += chunk
+        return buf
+
+    def _send_frame(self, op, payload):
+        head = bytes([0x80 | op])
+        n = len(payload)
+        if n < 126:
+            head += bytes([n])
+        elif n < 65536:
+            head += bytes([126]) + struct.pack(">H", n)
+        else:
+            head += bytes([127]) + struct.pack(">Q", n)
+        with self._send_lock:
+            self.sock.sendall(head + payload)
+
+    def send_text(self, text):
+        """Send one text message; returns False once the peer is gone."""
+        if not self.open:
+            return False
+        try:
+            self._send_frame(OP_TEXT, text.encode() if isinstance(text, str) else text)
+            return True
+        except OSError:
+            self.open = False
+            return False
+
+    def recv(self, timeout=None):
+        """Next text message, "" on timeout, None when the connection closed."""
+        self.sock.settimeout(timeout)
+        message = b""
+        try:
+            while True:
+                b0, b1 = self._recv_exact(2)
+                self.sock.settimeout(None)   # The rest of a started frame follows
+                op, n = b0 & 0x0F, b1 & 0x7F
+                if n == 126:
+                    n = struct.unpack(">H", self._recv_exact(2))[0]
+                elif n == 127:
+                    n = struct.unpack(">Q", self._recv_exact(8))[0]
+                mask = self._recv_exact(4) if b1 & 0x80 else None
+                data = self._recv_exact(n)
+                if mask:
+                    data = bytes(c ^ mask[i & 3] for i, c in enumerate(data))
+                if op == OP_CLOSE:
+                    self.close()
+                    return None
+                if op == OP_PING:
+                    self._send_frame(OP_PONG, data)
+                    continue
+                if op == OP_PONG:
+                    continue
+                message += data
+                if b0 & 0x80:
+                    return message.decode(errors="replace")
+        except socket.timeout:
+            return ""
+        except (OSError, ConnectionError):
+            self.open = False
+            return None
+
+    def close(self):
+        if self.open:
+            self.open = False
+            try:
+                self._send_frame(OP_CLOSE, b"")
+            except OSError:
+                pass
+        try:
+            self.sock.close()
+        except OSError:
+            pass
+
+
+# ============================================================
+# HTTP server
+# ============================================================
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"   # The display's WebSocket client expects 1.1
+
+    def log_message(self, fmt, *a):
+        if self.server.verbose:
+            sys.stderr.write("[htp1] %s %s\n" % (self.client_address[0], fmt % a))
+
+    def do_GET(self):
+        app = self.server.app
+        if self.path.split("?")[0] == WS_PATH and "websocket" in self.headers.get("Upgrade", "").lower():
+            key = self.headers.get("Sec-WebSocket-Key", "")
+            accept = base64.b64encode(hashlib.sha1((key + WS_GUID).encode()).digest()).decode()
+            self.send_response(101, "Switching Protocols")
+            self.send_header("Upgrade", "websocket")
+            self.send_header("Connection", "Upgrade")
+            self.send_header("Sec-WebSocket-Accept", accept)
+            self.end_headers()
+            self.wfile.flush()
+            self.close_connection = True
+            ws = WebSocket(self.connection, self.client_address[0])
+            try:
+                app.on_ws(ws)
+            finally:
+                ws.close()
+            return
+
+        if self.path.split("?")[0] == "/ircmd":
+            body = app.ircmd()
+            if body is None:
+                self.send_error(503, "No state yet")
+                return
+            data = body.encode() if isinstance(body, str) else body
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+            return
+
+        self.send_error(404)
+
+
+def make_server(app, port, host="", verbose=False):
+    server = http.server.ThreadingHTTPServer((host, port), Handler)
+    server.daemon_threads = True
+    server.app = app
+    server.verbose = verbose
+    return server
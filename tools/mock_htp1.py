@@ -0,0 +1,404 @@
+#!/usr/bin/env python3
+"""Mock HTP-1 for load and soak testing a display.
+
+Emulates the processor's /ws/controller WebSocket and /ircmd endpoint
+from a synthetic `mso` document (or one taken from a recording):
+
+  - `getmso` is answered with the full `mso` dump
+  - `changemso [...]` is applied and echoed as `msoupdate [...]`, as the
+    HTP-1 does, so button / REST commands round-trip
+  - a background stream of `msoupdate` patches (volume walk, mute, input,
+    codec, upmix), with optional bursts, e.g. 200 volume patches/s
+  - configurable latency and jitter, dropped frames, failing /ircmd
+    fetches and forced reconnects
+
+Point the display's HTP-1 address at this host and its port at --port.
+Examples:
+
+    # Gentle background traffic
+    python3 tools/mock_htp1.py --port 8080
+
+    # Soak: bursts, loss, reconnects, logging the display's heap to CSV
+    python3 tools/mock_htp1.py --port 8080 --rate 5 --burst-rate 200 \\
+        --burst-every 60 --drop 0.01 --latency 20 --jitter 30 \\
+        --reconnect-every 900 --device http://htp1-display.local/ \\
+        --csv soak.csv --duration 259200
+
+With --device, the display's /metrics are sampled every --report
+seconds: free heap and its low-water mark (leaks), reconnects (storms),
+and command round trips (latency) are printed and optionally written
+to CSV.
+"""
+
+import argparse
+import copy
+import heapq
+import itertools
+import json
+import random
+import sys
+import threading
+import time
+
+from htp1_server import make_server
+from replay_htp1 import KIND_WS, read_recording, scrape_metrics
+
+INPUTS = ["h1", "h2", "h3", "h4", "h5", "h6", "h7", "h8", "opt", "usb"]
+PROGRAMS = [("Dolby TrueHD (ATMOS)", "7.1.4"), ("DTS-HD MA", "5.1"),
+            ("Dolby Digital Plus (ATMOS)", "5.1.2"), ("PCM", "2.0"), ("DTS:X", "7.1.4")]
+UPMIXES = ["Native", "Dolby Surround", "DTS Neural:X", "Auro-3D"]
+LISTEN_FMTS = ["7.1.4", "5.1.4", "5.1", "2.0"]
+
+DEVICE_METRICS = [   # (label, series) sampled with --device
+    ("heap_free", "htp1_heap_free_bytes"),
+    ("heap_min", "htp1_heap_min_free_bytes"),
+    ("heap_block", "htp1_heap_largest_block_bytes"),
+    ("ws_rx", "htp1_ws_frames_received_total"),
+    ("ws_reconnects", "htp1_ws_reconnects_total"),
+    ("renders", "htp1_renders_total"),
+    ("echoes", "htp1_remote_echoes_total"),
+    ("rtt_s", "htp1_remote_rtt_seconds_total"),
+    ("loop_max_s", "htp1_loop_max_seconds"),
+]
+
+
+# ============================================================
+# Document
+# ============================================================
+
+def synthetic_mso():
+    """An mso document with the fields the display reads plus realistic bulk."""
+    return {
+        "volume": -40,
+        "muted": False,
+        "powerIsOn": True,
+        "input": "h1",
+        "inputs": {c: {"label": "Input " + c.upper(), "visible": True, "gain": 0,
+                       "format": "auto", "defaultUpmix": "native"} for c in INPUTS},
+        "status": {
+            "DECSourceProgram": PROGRAMS[0][0],
+            "DECProgramFormat": PROGRAMS[0][1],
+            "SurroundMode": UPMIXES[0],
+            "ENCListeningFormat": LISTEN_FMTS[0],
+            "DECSampleRate": "48 kHz",
+            "DECVideoSyncMode": "off",
+        },
+        "speakers": {"groups": {g: {"present": True, "size": "s", "fc": 80}
+                                for g in ["lr", "c", "sub1", "lrs", "lrb", "ltf", "ltr"]}},
+        "peq": {"slots": [{"channels": {ch: {"Fc": 1000, "gaindB": 0, "Q": 1.0}
+                                        for ch in ["lf", "rf", "c", "lfe", "ls", "rs", "lb", "rb"]}}
+                          for _ in range(16)]},
+    }
+
+
+def load_mso(path):
+    """A JSON file, or the first mso dump in a recorder file."""
+    with open(path, "rb") as f:
+        head = f.read(8)
+    if head == b"HTP1REC1":
+        for _, kind, text in read_recording(path):
+            if kind == KIND_WS and text.startswith("mso "):
+                return json.loads(text[4:])
+        sys.exit("no mso dump in %s" % path)
+    with open(path) as f:
+        return json.load(f)
+
+
+def pointer_parts(path):
+    return [p.replace("~1", "/").replace("~0", "~") for p in path.split("/")[1:]]
+
+
+def apply_op(doc, op):
+    """RFC 6902 replace / add / remove; returns False if it does not apply."""
+    parts = pointer_parts(op.get("path", ""))
+    if not parts:
+        return False
+    node = doc
+    try:
+        for p in parts[:-1]:
+            node = node[int(p)] if isinstance(node, list) else node[p]
+        last = parts[-1]
+        if isinstance(node, list):
+            i = len(node) if last == "-" else int(last)
+            if op["op"] == "remove":
+                del node[i]
+            elif op["op"] == "add":
+                node.insert(i, op["value"])
+            else:
+                node[i] = op["value"]
+        elif op["op"] == "remove":
+            del node[last]
+        else:
+            node[last] = op["value"]
+        return True
+    except (KeyError, IndexError, ValueError, TypeError):
+        return False
+
+
+# ============================================================
+# Mock server
+# ============================================================
+
+class Client:
+    """One display connection: frames go out in order after the configured latency."""
+
+    def __init__(self, ws, mock):
+        self.ws = ws
+        self.mock = mock
+        self.queue = []            # (due, n, text)
+        self.cv = threading.Condition()
+        self.counter = itertools.count()
+        threading.Thread(target=self._sender, daemon=True).start()
+
+    def send(self, text, droppable=True):
+        m = self.mock
+        if droppable and random.random() < m.args.drop:
+            m.stats["dropped"] += 1
+            return
+        delay = max(0.0, random.gauss(m.args.latency, m.args.jitter / 2.0) if m.args.jitter else m.args.latency)
+        with self.cv:
+            # Never overtake an earlier frame: in-order like one TCP stream
+            due = time.monotonic() + delay / 1000.0
+            if self.queue:
+                due = max(due, max(q[0] for q in self.queue))
+            heapq.heappush(self.queue, (due, next(self.counter), text))
+            self.cv.notify()
+
+    def _sender(self):
+        while self.ws.open:
+            with self.cv:
+                while not self.queue and self.ws.open:
+                    self.cv.wait(0.5)
+                if not self.queue:
+                    continue
+                due, _, text = self.queue[0]
+                wait = due - time.monotonic()
+                if wait > 0:
+                    self.cv.wait(wait)
+                    continue
+                heapq.heappop(self.queue)
+            if self.ws.send_text(text):
+                self.mock.stats["frames"] += 1
+
+
+class Mock:
+    def __init__(self, args, doc):
+        self.args = args
+        self.doc = doc
+        self.lock = threading.Lock()
+        self.clients = []
+        self.stats = dict.fromkeys(["connects", "frames", "dropped", "patches", "commands",
+                                    "getmso", "ircmd", "ircmd_failed", "kicked"], 0)
+
+    # --- htp1_server app ---
+    def ircmd(self):
+        if self.args.latency:
+            time.sleep(max(0.0, random.gauss(self.args.latency, self.args.jitter / 2.0)) / 1000.0)
+        if random.random() < self.args.http_fail:
+            self.stats["ircmd_failed"] += 1
+            return None
+        self.stats["ircmd"] += 1
+        with self.lock:
+            return json.dumps(self.doc)
+
+    def on_ws(self, ws):
+        client = Client(ws, self)
+        with self.lock:
+            self.clients.append(client)
+        self.stats["connects"] += 1
+        print("[mock] display connected from %s" % ws.peer)
+        try:
+            while ws.open:
+                msg = ws.recv(timeout=1.0)
+                if msg is None:
+                    break
+                if msg == "getmso":
+                    self.stats["getmso"] += 1
+                    with self.lock:
+                        dump = "mso " + json.dumps(self.doc)
+                    client.send(dump, droppable=False)
+                elif msg.startswith("changemso "):
+                    self.stats["commands"] += 1
+                    self.command(msg[10:])
+        finally:
+            with self.lock:
+                self.clients.remove(client)
+            print("[mock] display disconnected")
+
+    def command(self, body):
+        try:
+            ops = json.loads(body)
+        except ValueError:
+            return
+        if isinstance(ops, dict):
+            ops = [ops]
+        applied = []
+        with self.lock:
+            for op in ops:
+                if isinstance(op, dict) and apply_op(self.doc, op):
+                    applied.append(op)
+        if applied:
+            self.broadcast(applied)   # The HTP-1 echoes accepted changes to everyone
+
+    def broadcast(self, ops):
+        text = "msoupdate " + json.dumps(ops)
+        with self.lock:
+            clients = list(self.clients)
+        for c in clients:
+            c.send(text)
+        self.stats["patches"] += 1
+
+    def patch(self, ops):
+        with self.lock:
+            for op in ops:
+                apply_op(self.doc, op)
+        self.broadcast(ops)
+
+    # --- Traffic generators ---
+    def random_patch(self):
+        with self.lock:
+            vol = self.doc.get("volume", -40)
+        r = random.random()
+        if r < 0.6:
+            v = max(-100, min(0, vol + random.choice([-3, -2, -1, 1, 2, 3])))
+            return [{"op": "replace", "path": "/volume", "value": v}]
+        if r < 0.7:
+            return [{"op": "replace", "path": "/muted", "value": random.random() < 0.5}]
+        if r < 0.8:
+            return [{"op": "replace", "path": "/input", "value": random.choice(INPUTS)}]
+        if r < 0.95:
+            prog, fmt = random.choice(PROGRAMS)
+            return [{"op": "replace", "path": "/status/DECSourceProgram", "value": prog},
+                    {"op": "replace", "path": "/status/DECProgramFormat", "value": fmt}]
+        return [{"op": "replace", "path": "/status/SurroundMode", "value": random.choice(UPMIXES)},
+                {"op": "replace", "path": "/status/ENCListeningFormat", "value": random.choice(LISTEN_FMTS)}]
+
+    def run_traffic(self, stop):
+        a = self.args
+        next_burst = time.monotonic() + a.burst_every if a.burst_rate and a.burst_every else None
+        while not stop.is_set():
+            now = time.monotonic()
+            if next_burst and now >= next_burst:
+                self.run_burst(stop)
+                next_burst = time.monotonic() + a.burst_every
+                continue
+            if a.rate > 0:
+                self.patch(self.random_patch())
+                stop.wait(random.expovariate(a.rate))
+            else:
+                stop.wait(0.5)
+
+    def run_burst(self, stop):
+        """Volume ramp at --burst-rate patches/s for --burst-secs."""
+        a = self.args
+        print("[mock] burst: %d volume patches/s for %.0f s" % (a.burst_rate, a.burst_secs))
+        interval = 1.0 / a.burst_rate
+        t = time.monotonic()
+        end = t + a.burst_secs
+        step = 1
+        while t < end and not stop.is_set():
+            with self.lock:
+                vol = self.doc.get("volume", -40)
+            if not -80 < vol + step < 0:
+                step = -step
+            self.patch([{"op": "replace", "path": "/volume", "value": vol + step}])
+            t += interval
+            delay = t - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+
+    def run_reconnects(self, stop):
+        a = self.args
+        while not stop.wait(a.reconnect_every * random.uniform(0.5, 1.5)):
+            with self.lock:
+                clients = list(self.clients)
+            if clients:
+                print("[mock] dropping %d connection(s)" % len(clients))
+            for c in clients:
+                c.ws.close()
+                self.stats["kicked"] += 1
+
+
+# ============================================================
+# Soak report
+# ============================================================
+
+def report_loop(mock, args, stop):
+    start = time.monotonic()
+    csv = open(args.csv, "a") if args.csv else None
+    if csv and csv.tell() == 0:
+        csv.write(",".join(["elapsed_s"] + list(mock.stats) + [k for k, _ in DEVICE_METRICS]) + "\n")
+    first = None
+    while not stop.wait(args.report):
+        elapsed = time.monotonic() - start
+        s = mock.stats
+        line = ("[mock] %6.0fs clients=%d frames=%d dropped=%d patches=%d cmds=%d getmso=%d ircmd=%d/%d kicked=%d"
+                % (elapsed, len(mock.clients), s["frames"], s["dropped"], s["patches"], s["commands"],
+                   s["getmso"], s["ircmd"], s["ircmd"] + s["ircmd_failed"], s["kicked"]))
+        dev = {}
+        if args.device:
+            try:
+                m = scrape_metrics(args.device)
+                dev = {k: m.get(series, 0.0) for k, series in DEVICE_METRICS}
+                first = first or dev
+                line += (" | heap %d (min %d, %+d since start) reconnects=%d"
+                         % (dev["heap_free"], dev["heap_min"], dev["heap_free"] - first["heap_free"],
+                            dev["ws_reconnects"] - first["ws_reconnects"]))
+                echoes = dev["echoes"] - first["echoes"]
+                if echoes:
+                    line += " rtt=%.1fms" % ((dev["rtt_s"] - first["rtt_s"]) * 1000 / echoes)
+            except OSError as e:
+                line += " | device unreachable (%s)" % e
+        print(line)
+        if csv:
+            row = [elapsed] + list(s.values()) + [dev.get(k, "") for k, _ in DEVICE_METRICS]
+            csv.write(",".join(str(v) for v in row) + "\n")
+            csv.flush()
+        if args.duration and elapsed >= args.duration:
+            stop.set()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--port", type=int, default=8080)
+    ap.add_argument("--mso", help="mso document: JSON file or recorder file (default: synthetic)")
+    ap.add_argument("--rate", type=float, default=1.0, help="background msoupdate frames/s (Poisson)")
+    ap.add_argument("--burst-rate", type=int, default=0, help="volume patches/s during bursts")
+    ap.add_argument("--burst-secs", type=float, default=5.0)
+    ap.add_argument("--burst-every", type=float, default=60.0, help="seconds between bursts")
+    ap.add_argument("--latency", type=float, default=0.0, help="ms before each frame / /ircmd answer")
+    ap.add_argument("--jitter", type=float, default=0.0, help="ms, roughly the spread around --latency")
+    ap.add_argument("--drop", type=float, default=0.0, help="probability a patch frame is not sent")
+    ap.add_argument("--http-fail", type=float, default=0.0, help="probability /ircmd answers 503")
+    ap.add_argument("--reconnect-every", type=float, default=0.0, help="mean seconds between forced disconnects")
+    ap.add_argument("--duration", type=float, default=0.0, help="stop after this many seconds")
+    ap.add_argument("--report", type=float, default=10.0, help="seconds between status lines")
+    ap.add_argument("--device", help="display base URL to sample /metrics from")
+    ap.add_argument("--csv", help="append status rows to this CSV file")
+    ap.add_argument("--seed", type=int, help="random seed (repeatable runs)")
+    ap.add_argument("--verbose", action="store_true", help="log HTTP requests")
+    args = ap.parse_args()
+
+    if args.seed is not None:
+        random.seed(args.seed)
+    doc = load_mso(args.mso) if args.mso else synthetic_mso()
+    mock = Mock(args, copy.deepcopy(doc))
+
+    server = make_server(mock, args.port, verbose=args.verbose)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    print("[mock] HTP-1 on port %d (mso %d bytes), %.1f patches/s" % (args.port, len(json.dumps(doc)), args.rate))
+
+    stop = threading.Event()
+    threading.Thread(target=mock.run_traffic, args=(stop,), daemon=True).start()
+    if args.reconnect_every:
+        threading.Thread(target=mock.run_reconnects, args=(stop,), daemon=True).start()
+    try:
+        report_loop(mock, args, stop)
+    except KeyboardInterrupt:
+        pass
+    stop.set()
+    server.shutdown()
+
+
+if __name__ == "__main__":
+    main()
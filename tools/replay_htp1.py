@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+"""Replay a recorded HTP-1 session to a display.
+
+The display's traffic recorder (web UI -> Traffic Recorder, or
+POST /recorder/start) captures every WebSocket frame and /ircmd response
+it receives. Download the recording (GET /recorder/download), then:
+
+Summarise it:
+
+    python3 tools/replay_htp1.py info htp1-recording.bin
+
+Play it back as a fake HTP-1 (set the display's HTP-1 address to this
+host and its port to 8080):
+
+    python3 tools/replay_htp1.py serve htp1-recording.bin --port 8080 --speed 4 \\
+        --device http://htp1-display.local/
+
+Frames go out with their recorded spacing divided by --speed (0 = as fast
+as the socket takes them). /ircmd answers with the latest recorded
+response at the current replay position, and a `getmso` from the display
+is answered with the latest recorded `mso` dump. The clock starts when
+the display connects. With --device, the display's /metrics counters are
+sampled before and after the run and the differences printed: parse,
+render and latency figures from real traffic, for comparing builds.
+
+File format: see HTP1_Display/recorder.h.
+"""
+
+import argparse
+import re
+import struct
+import sys
+import threading
+import time
+import urllib.request
+
+from htp1_server import make_server
+
+SEG_MAGIC = b"HTP1REC1"
+SEG_HEADER = struct.Struct("<8sII")      # magic, seq, reserved
+REC_HEADER = struct.Struct("<IB3xI")     # ms, kind, len
+KIND_WS, KIND_IRCMD = 0, 1
+KIND_NAMES = {KIND_WS: "ws", KIND_IRCMD: "ircmd"}
+
+
+# ============================================================
+# Recording file
+# ============================================================
+
+def read_recording(path):
+    """[(ms, kind, text)], times rebased so the first record is at 0."""
+    with open(path, "rb") as f:
+        data = f.read()
+    records = []
+    pos = 0
+    while pos < len(data):
+        if data[pos:pos + 8] == SEG_MAGIC:
+            pos += SEG_HEADER.size
+            continue
+        if pos + REC_HEADER.size > len(data):
+            sys.stderr.write("truncated record header at %d, ignoring the rest\n" % pos)
+            break
+        ms, kind, n = REC_HEADER.unpack_from(data, pos)
+        pos += REC_HEADER.size
+        if pos + n > len(data):
+            sys.stderr.write("truncated record at %d, ignoring the rest\n" % pos)
+            break
+        records.append((ms, kind, data[pos:pos + n].decode(errors="replace")))
+        pos += n
+    if records:
+        t0 = records[0][0]
+        records = [(ms - t0, kind, text) for ms, kind, text in records]
+    return records
+
+
+def cmd_info(args):
+    records = read_recording(args.file)
+    if not records:
+        sys.exit("no records")
+    duration = records[-1][0] / 1000.0
+    print("%d records over %.1f s" % (len(records), duration))
+    for kind, name in KIND_NAMES.items():
+        sizes = [len(t) for _, k, t in records if k == kind]
+        if sizes:
+            print("  %-6s %6d  avg %6d B  max %6d B" % (name, len(sizes), sum(sizes) // len(sizes), max(sizes)))
+
+    ws = [(ms, t) for ms, k, t in records if k == KIND_WS]
+    dumps = sum(1 for _, t in ws if t.startswith("mso "))
+    patches = [(ms, t) for ms, t in ws if t.startswith("msoupdate ")]
+    print("  mso dumps %d, msoupdate frames %d" % (dumps, len(patches)))
+
+    # Burstiest second of patch traffic
+    peak, j = 0, 0
+    for i, (ms, _) in enumerate(patches):
+        while patches[j][0] <= ms - 1000:
+            j += 1
+        peak = max(peak, i - j + 1)
+    print("  peak msoupdate rate %d/s" % peak)
+
+    paths = {}
+    for _, t in patches:
+        for p in re.findall(r'"path"\s*:\s*"([^"]*)"', t):
+            paths[p] = paths.get(p, 0) + 1
+    for p, n in sorted(paths.items(), key=lambda kv: -kv[1])[:args.top]:
+        print("  %6d  %s" % (n, p))
+
+
+# ============================================================
+# Replay server
+# ============================================================
+
+class Replay:
+    def __init__(self, records, speed, loop):
+        self.records = records
+        self.speed = speed
+        self.loop = loop
+        self.lock = threading.Lock()
+        self.clients = []
+        self.started = threading.Event()
+        self.finished = threading.Event()
+        # Until the clock reaches them, serve the first recorded state
+        self.ircmd_body = next((t for _, k, t in records if k == KIND_IRCMD), None)
+        self.dump = next((t for _, k, t in records if k == KIND_WS and t.startswith("mso ")), None)
+        self.sent = 0
+        self.commands = 0
+
+    # --- htp1_server app ---
+    def ircmd(self):
+        with self.lock:
+            return self.ircmd_body
+
+    def on_ws(self, ws):
+        print("[replay] display connected from %s" % ws.peer)
+        with self.lock:
+            self.clients.append(ws)
+        self.started.set()
+        try:
+            while ws.open:
+                msg = ws.recv(timeout=1.0)
+                if msg is None:
+                    break
+                if msg == "getmso":
+                    with self.lock:
+                        dump = self.dump
+                    if dump:
+                        ws.send_text(dump)
+                elif msg:
+                    self.commands += 1
+                    print("[replay] display sent: %s" % msg[:120])
+        finally:
+            with self.lock:
+                self.clients.remove(ws)
+            print("[replay] display disconnected")
+
+    # --- Timeline ---
+    def play(self):
+        while True:
+            start = time.monotonic()
+            for ms, kind, text in self.records:
+                if self.speed > 0:
+                    delay = start + ms / 1000.0 / self.speed - time.monotonic()
+                    if delay > 0:
+                        time.sleep(delay)
+                with self.lock:
+                    if kind == KIND_IRCMD:
+                        self.ircmd_body = text
+                        continue
+                    if text.startswith("mso "):
+                        self.dump = text
+                    clients = list(self.clients)
+                for ws in clients:
+                    if ws.send_text(text):
+                        self.sent += 1
+            if not self.loop:
+                break
+        self.finished.set()
+
+
+def scrape_metrics(url):
+    """{series: value} from a display's /metrics."""
+    with urllib.request.urlopen(url.rstrip("/") + "/metrics", timeout=5) as r:
+        text = r.read().decode()
+    out = {}
+    for line in text.splitlines():
+        if line and not line.startswith("#"):
+            series, _, value = line.rpartition(" ")
+            try:
+                out[series] = float(value)
+            except ValueError:
+                pass
+    return out
+
+
+def print_metric_deltas(before, after, wall):
+    print("\nDisplay counters during the replay (%.1f s):" % wall)
+    for series in sorted(after):
+        name = series.split("{")[0]
+        if not name.endswith("_total"):
+            continue
+        d = after[series] - before.get(series, 0.0)
+        if d:
+            print("  %-60s %12.3f  (%.1f/s)" % (series, d, d / wall if wall else 0))
+
+    def delta(s):
+        return after.get(s, 0.0) - before.get(s, 0.0)
+
+    renders = delta("htp1_renders_total")
+    if renders:
+        print("  avg render %.2f ms" % (delta("htp1_render_seconds_total") * 1000 / renders))
+    echoes = delta("htp1_remote_echoes_total")
+    if echoes:
+        print("  avg command round trip %.1f ms" % (delta("htp1_remote_rtt_seconds_total") * 1000 / echoes))
+
+
+def cmd_serve(args):
+    records = read_recording(args.file)
+    if not records:
+        sys.exit("no records")
+    replay = Replay(records, args.speed, args.loop)
+    server = make_server(replay, args.port, verbose=args.verbose)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    print("[replay] %d records, %.1f s at %sx; waiting for the display on port %d"
+          % (len(records), records[-1][0] / 1000.0, args.speed or "max", args.port))
+
+    before = scrape_metrics(args.device) if args.device else None
+    replay.started.wait()
+    if args.settle:
+        time.sleep(args.settle)   # Let the display take the initial dump
+    t0 = time.monotonic()
+    threading.Thread(target=replay.play, daemon=True).start()
+    try:
+        replay.finished.wait()
+        wall = time.monotonic() - t0
+        print("[replay] done: %d frames sent in %.1f s, %d commands from the display"
+              % (replay.sent, wall, replay.commands))
+        if before is not None:
+            time.sleep(2)   # Let the display drain what it received
+            print_metric_deltas(before, scrape_metrics(args.device), wall)
+        if args.hold:
+            print("[replay] holding the final state, Ctrl-C to exit")
+            threading.Event().wait()
+    except KeyboardInterrupt:
+        pass
+    server.shutdown()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    sub = ap.add_subparsers(dest="cmd", required=True)
+
+    i = sub.add_parser("info", help="summarise a recording")
+    i.add_argument("file")
+    i.add_argument("--top", type=int, default=10, help="most frequent patch paths to list")
+
+    s = sub.add_parser("serve", help="play a recording to a display as a fake HTP-1")
+    s.add_argument("file")
+    s.add_argument("--port", type=int, default=8080)
+    s.add_argument("--speed", type=float, default=1.0, help="time scale (0 = no delays)")
+    s.add_argument("--loop", action="store_true", help="repeat the recording forever")
+    s.add_argument("--settle", type=float, default=1.0, help="seconds between connect and playback")
+    s.add_argument("--device", help="display base URL; print /metrics deltas for the run")
+    s.add_argument("--hold", action="store_true", help="keep serving the final state when done")
+    s.add_argument("--verbose", action="store_true", help="log HTTP requests")
+
+    args = ap.parse_args()
+    {"info": cmd_info, "serve": cmd_serve}[args.cmd](args)
+
+
+if __name__ == "__main__":
+    main()
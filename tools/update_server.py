@@ -0,0 +1,377 @@
+#!/usr/bin/env python3
+"""Local update server for HTP-1 Display pull OTA.
+
+Build a release directory (full image + delta patches + manifest):
+
+    python3 tools/update_server.py build --new build/HTP1_Display.ino.bin \\
+        --version 1.0.3 --old releases/1.0.2.bin --old releases/1.0.1.bin \\
+        --out updates/
+
+Serve it to the displays (set the update URL in the web UI to
+http://<this-host>:8080/):
+
+    python3 tools/update_server.py serve --dir updates/ --port 8080
+
+Manifest (manifest.json):
+
+    {
+      "version": "1.0.3",
+      "full":   {"url": "HTP1_Display-1.0.3.bin", "size": N, "sha256": "<image>"},
+      "deltas": [{"from": "<running image id>", "url": "...hpatch",
+                  "size": n, "sha256": "<image>"}]
+    }
+
+`from` is the image id the device reports for its running partition
+(esp_partition_get_sha256): the SHA-256 appended to the image when the
+build appends one, else the SHA-256 of the whole file.
+
+Delta format: an ENDSLEY/BSDIFF43 patch (16-byte magic, 8-byte new size,
+then interleaved control triples / diff bytes / extra bytes) compressed
+as a heatshrink bitstream (window 2^10, lookahead 2^4). The device
+decompresses and patches against its running partition while streaming,
+so neither the patch nor the new image is ever held in RAM.
+"""
+
+import argparse
+import hashlib
+import http.server
+import json
+import os
+import sys
+
+BSDIFF_MAGIC = b"ENDSLEY/BSDIFF43"
+HS_WINDOW = 10      # Must match OTA_HS_WINDOW in config.h
+HS_LOOKAHEAD = 4    # Must match OTA_HS_LOOKAHEAD in config.h
+
+
+# ============================================================
+# ESP image id
+# ============================================================
+
+def image_id(img):
+    """SHA-256 the device reports for a running image."""
+    # esp_image_header_t.hash_appended lives at offset 23
+    if len(img) > 32 and img[23] == 1:
+        return img[-32:].hex()
+    return hashlib.sha256(img).hexdigest()
+
+
+# ============================================================
+# bsdiff (ENDSLEY/BSDIFF43 stream format)
+# ============================================================
+
+def offtout(x):
+    """bsdiff signed 64-bit: magnitude little-endian, sign in the top bit."""
+    b = bytearray(abs(x).to_bytes(8, "little"))
+    if x < 0:
+        b[7] |= 0x80
+    return bytes(b)
+
+
+def offtin(b):
+    y = int.from_bytes(bytes(b[:7]) + bytes([b[7] & 0x7F]), "little")
+    return -y if b[7] & 0x80 else y
+
+
+class Matcher:
+    """Longest-match search into `old` via an index of 8-byte keys.
+
+    Only every 4th old position is indexed; bsdiff calls search() at every
+    new position, so any match of 11+ bytes is still found.
+    """
+
+    KEY = 8
+    STRIDE = 4
+    MAX_CANDIDATES = 16
+
+    def __init__(self, old):
+        self.old = old
+        self.index = {}
+        for p in range(0, len(old) - self.KEY + 1, self.STRIDE):
+            lst = self.index.setdefault(old[p:p + self.KEY], [])
+            if len(lst) < self.MAX_CANDIDATES:
+                lst.append(p)
+
+    def _extend(self, new, s, p):
+        old = self.old
+        n = 0
+        step = 64
+        while step:
+            if old[p + n:p + n + step] == new[s + n:s + n + step] and \
+                    p + n + step <= len(old) and s + n + step <= len(new):
+                n += step
+                step *= 2
+            else:
+                step //= 2
+        while p + n < len(old) and s + n < len(new) and old[p + n] == new[s + n]:
+            n += 1
+        return n
+
+    def search(self, new, s):
+        best_len, best_pos = 0, 0
+        for p in self.index.get(new[s:s + self.KEY], ()):
+            n = self._extend(new, s, p)
+            if n > best_len:
+                best_len, best_pos = n, p
+        return best_len, best_pos
+
+
+def bsdiff(old, new):
+    """Return an uncompressed ENDSLEY/BSDIFF43 patch turning old into new."""
+    m = Matcher(old)
+    oldsize, newsize = len(old), len(new)
+    out = bytearray(BSDIFF_MAGIC + offtout(newsize))
+
+    scan = length = pos = 0
+    lastscan = lastpos = lastoffset = 0
+
+    while scan < newsize:
+        oldscore = 0
+        scan += length
+        scsc = scan
+        while scan < newsize:
+            length, pos = m.search(new, scan)
+            while scsc < scan + length:
+                if scsc + lastoffset < oldsize and old[scsc + lastoffset] == new[scsc]:
+                    oldscore += 1
+                scsc += 1
+            if (length == oldscore and length != 0) or length > oldscore + 8:
+                break
+            if scan + lastoffset < oldsize and old[scan + lastoffset] == new[scan]:
+                oldscore -= 1
+            scan += 1
+
+        if length != oldscore or scan == newsize:
+            # Extend the previous match forward...
+            s = sf = lenf = i = 0
+            while lastscan + i < scan and lastpos + i < oldsize:
+                if old[lastpos + i] == new[lastscan + i]:
+                    s += 1
+                i += 1
+                if s * 2 - i > sf * 2 - lenf:
+                    sf, lenf = s, i
+
+            # ...and the new one backward
+            lenb = 0
+            if scan < newsize:
+                s = sb = 0
+                i = 1
+                while scan >= lastscan + i and pos >= i:
+                    if old[pos - i] == new[scan - i]:
+                        s += 1
+                    if s * 2 - i > sb * 2 - lenb:
+                        sb, lenb = s, i
+                    i += 1
+
+            # Resolve overlap
+            if lastscan + lenf > scan - lenb:
+                overlap = (lastscan + lenf) - (scan - lenb)
+                s = ss = lens = 0
+                for i in range(overlap):
+                    if new[lastscan + lenf - overlap + i] == old[lastpos + lenf - overlap + i]:
+                        s += 1
+                    if new[scan - lenb + i] == old[pos - lenb + i]:
+                        s -= 1
+                    if s > ss:
+                        ss, lens = s, i + 1
+                lenf += lens - overlap
+                lenb -= lens
+
+            extra_len = (scan - lenb) - (lastscan + lenf)
+            out += offtout(lenf)
+            out += offtout(extra_len)
+            out += offtout((pos - lenb) - (lastpos + lenf))
+            out += bytes((new[lastscan + i] - old[lastpos + i]) & 0xFF for i in range(lenf))
+            out += new[lastscan + lenf:lastscan + lenf + extra_len]
+
+            lastscan = scan - lenb
+            lastpos = pos - lenb
+            lastoffset = pos - scan
+
+    return bytes(out)
+
+
+def bspatch(old, patch):
+    """Reference patcher — used to verify every generated delta."""
+    if patch[:16] != BSDIFF_MAGIC:
+        raise ValueError("bad magic")
+    newsize = offtin(patch[16:24])
+    new = bytearray()
+    p, oldpos = 24, 0
+    while len(new) < newsize:
+        add, copy, seek = (offtin(patch[p + i * 8:p + i * 8 + 8]) for i in range(3))
+        p += 24
+        new += bytes((patch[p + i] + old[oldpos + i]) & 0xFF for i in range(add))
+        p += add
+        oldpos += add
+        new += patch[p:p + copy]
+        p += copy
+        oldpos += seek
+    return bytes(new)
+
+
+# ============================================================
+# heatshrink bitstream (LZSS)
+# ============================================================
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def put(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.n += 1
+            if self.n == 8:
+                self.out.append(self.acc)
+                self.acc = self.n = 0
+
+    def finish(self):
+        if self.n:
+            self.out.append(self.acc << (8 - self.n))
+        return bytes(self.out)
+
+
+def heatshrink_encode(data, w=HS_WINDOW, la=HS_LOOKAHEAD):
+    window, maxlen = 1 << w, 1 << la
+    bw = BitWriter()
+    chains = {}
+    i, n = 0, len(data)
+
+    def insert(pos):
+        if pos + 3 <= n:
+            chains.setdefault(data[pos:pos + 3], []).append(pos)
+
+    while i < n:
+        best_len, best_off = 0, 0
+        for c in reversed(chains.get(data[i:i + 3], ())):
+            off = i - c
+            if off > window:
+                break
+            length = 0
+            while length < maxlen and i + length < n and data[c + length] == data[i + length]:
+                length += 1
+            if length > best_len:
+                best_len, best_off = length, off
+                if length == maxlen:
+                    break
+        if best_len >= 2:
+            bw.put(0, 1)
+            bw.put(best_off - 1, w)
+            bw.put(best_len - 1, la)
+            for k in range(best_len):
+                insert(i + k)
+            i += best_len
+        else:
+            bw.put(1, 1)
+            bw.put(data[i], 8)
+            insert(i)
+            i += 1
+        # Keep chains short: drop positions that left the window
+        if i & 0xFFF == 0:
+            for k in list(chains):
+                chains[k] = [p for p in chains[k] if i - p <= window]
+                if not chains[k]:
+                    del chains[k]
+    return bw.finish()
+
+
+def heatshrink_decode(data, w=HS_WINDOW, la=HS_LOOKAHEAD):
+    out = bytearray()
+    bits = "".join(format(b, "08b") for b in data)
+    p = 0
+    while True:
+        if p >= len(bits):
+            break
+        if bits[p] == "1":
+            if p + 9 > len(bits):
+                break
+            out.append(int(bits[p + 1:p + 9], 2))
+            p += 9
+        else:
+            if p + 1 + w + la > len(bits):
+                break
+            off = int(bits[p + 1:p + 1 + w], 2) + 1
+            cnt = int(bits[p + 1 + w:p + 1 + w + la], 2) + 1
+            for _ in range(cnt):
+                out.append(out[-off])
+            p += 1 + w + la
+    return bytes(out)
+
+
+# ============================================================
+# Commands
+# ============================================================
+
+def cmd_build(args):
+    os.makedirs(args.out, exist_ok=True)
+    with open(args.new, "rb") as f:
+        new = f.read()
+
+    full_name = "HTP1_Display-%s.bin" % args.version
+    with open(os.path.join(args.out, full_name), "wb") as f:
+        f.write(new)
+    new_sha = hashlib.sha256(new).hexdigest()
+
+    manifest = {
+        "version": args.version,
+        "full": {"url": full_name, "size": len(new), "sha256": new_sha},
+        "deltas": [],
+    }
+
+    for old_path in args.old or []:
+        with open(old_path, "rb") as f:
+            old = f.read()
+        from_id = image_id(old)
+        patch = bsdiff(old, new)
+        if bspatch(old, patch) != new:
+            sys.exit("delta from %s failed verification" % old_path)
+        packed = heatshrink_encode(patch)
+        if heatshrink_decode(packed) != patch:
+            sys.exit("heatshrink round trip failed for %s" % old_path)
+
+        name = "delta-%s-%s.hpatch" % (from_id[:12], args.version)
+        with open(os.path.join(args.out, name), "wb") as f:
+            f.write(packed)
+        manifest["deltas"].append({
+            "from": from_id, "url": name, "size": len(packed), "sha256": new_sha})
+        print("%s: %d bytes (%.1f%% of full image)"
+              % (name, len(packed), 100.0 * len(packed) / len(new)))
+
+    with open(os.path.join(args.out, "manifest.json"), "w") as f:
+        json.dump(manifest, f, indent=2)
+    print("manifest.json: version %s, %d delta(s)" % (args.version, len(manifest["deltas"])))
+
+
+def cmd_serve(args):
+    os.chdir(args.dir)
+
+    class Handler(http.server.SimpleHTTPRequestHandler):
+        def log_message(self, fmt, *a):
+            sys.stderr.write("[update] %s %s\n" % (self.client_address[0], fmt % a))
+
+    http.server.ThreadingHTTPServer(("", args.port), Handler).serve_forever()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    sub = ap.add_subparsers(dest="cmd", required=True)
+
+    b = sub.add_parser("build", help="write full image, deltas and manifest")
+    b.add_argument("--new", required=True, help="new firmware .bin")
+    b.add_argument("--version", required=True, help="version string of the new firmware")
+    b.add_argument("--old", action="append", help="previous .bin to build a delta from (repeatable)")
+    b.add_argument("--out", required=True, help="output directory")
+
+    s = sub.add_parser("serve", help="serve a release directory over HTTP")
+    s.add_argument("--dir", required=True)
+    s.add_argument("--port", type=int, default=8080)
+
+    args = ap.parse_args()
+    {"build": cmd_build, "serve": cmd_serve}[args.cmd](args)
+
+
+if __name__ == "__main__":
+    main()